@@ -19,8 +19,87 @@ const char* const AP_PASS = NULL;
 #define I2C_SDA 6
 #define I2C_SCL 7
 
+// GNSS Acquisition Task (owns the u-blox module and the I2C bus)
+#define GPS_TASK_STACK_SIZE 6144    // bytes
+#define GPS_TASK_PRIORITY 5         // Above loopTask (1) and async_tcp (3)
+#define GPS_TASK_POLL_MS 5          // I2C poll period from shortly before an epoch is due until it is read
+#define GPS_TASK_IDLE_MS 100        // Task sleep while acquisition is paused or the module is missing
+#define GPS_LOST_INTERVALS 10       // Measurement intervals without a NAV-PVT before the module counts as lost
+#define GPS_SAT_TABLE_MAX 64        // Satellites kept from each NAV-SAT frame for the sky view
+#define GPS_PVT_LATENCY_MS 25       // Nominal NAV-PVT output delay after its solution time, used when there is no TIMEPULSE edge
+#define GPS_PPS_PIN -1              // GPIO wired to the module's TIMEPULSE (PPS) output, -1 = not connected
+
+// ESP-NOW (settings inside #ifndef may also come from build flags, as in tools/espnow_sim)
+#ifndef ESPNOW_MAX_CLIENTS
+#define ESPNOW_MAX_CLIENTS 8        // Receivers tracked for pong liveness (at most 127)
+#endif
+#ifndef ESPNOW_BROADCAST_MODE
+#define ESPNOW_BROADCAST_MODE false // true = one broadcast frame per epoch, whatever the number of receivers
+#endif
+#define ESPNOW_GROUP_ID 0x4E41      // Broadcast frames carry this id; receivers ignore other groups
+#ifndef ESPNOW_RX_RING_SIZE
+#define ESPNOW_RX_RING_SIZE 16      // Received frames queued for the loop task (power of two)
+#endif
+#define ESPNOW_RTT_BINS 11          // Round-trip histogram bins: <1, 2, 5, 10, 20, 50, 100, 200, 500, 1000 ms, above
+#define ESPNOW_FAILURE_THRESHOLD 5  // Unacknowledged frames in a row before a unicast peer counts as down
+#define ESPNOW_TX_TASK_STACK_SIZE 4096 // bytes
+#define ESPNOW_TX_TASK_PRIORITY 4   // Below the GNSS task, above async_tcp (3)
+#define ESPNOW_TX_TIMEOUT_MS 50     // Wait this long for a send callback before treating the frame as lost
+#define ESPNOW_TX_MAX_RETRIES 3     // Resends per frame and peer
+#define ESPNOW_TX_BACKOFF_MS 5      // First retry delay; doubles per retry
+#define ESPNOW_TX_BACKOFF_MAX_MS 40
+#define ESPNOW_TX_CONTROL_DEPTH 4   // Pair acks waiting for the TX task
+#ifndef ESPNOW_PACKET_VERSION
+#define ESPNOW_PACKET_VERSION 3     // 3 = typed messages (position, sky view, stats, health); 2 = position frame with CRC; 1 = legacy layout
+#endif
+#define ESPNOW_SATS_DIVIDER 10      // v3: satellite table every Nth epoch (0 = only when a receiver connects)
+#define ESPNOW_STATS_DIVIDER 60     // v3: session records every Nth epoch
+#define ESPNOW_HEALTH_DIVIDER 30    // v3: sender health every Nth epoch
+#define ESPNOW_PAIRING_ENABLED true // Receivers may join by announcing themselves (default; toggled at runtime and kept in NVS)
+#define ESPNOW_PEER_EVICT_MS 600000 // Drop a paired (not pinned) receiver after this long without a pong
+
 // Network Ports
 #define TCP_PORT 2947
 #define WEB_PORT 80
 
+// TCP Broadcast Buffers
+#define TCP_MAX_CLIENTS 8           // Client slots; further connections are turned away
+#define TCP_FRAME_SIZE 768          // One epoch: NMEA block + gpsd TPV and SKY lines
+#define TCP_FRAME_POOL_SIZE 6       // Shared frames that may be queued or awaiting client ACKs
+#define TCP_CLIENT_INFLIGHT 8       // Unacknowledged writes tracked per client
+#define TCP_CLIENT_QUEUE_DEPTH 4    // Epochs held for a slow client before the oldest is dropped
+#define TCP_CMD_MAX_LEN 256         // Longest gpsd command line; longer lines are discarded
+#define TCP_CMD_RATE_LIMIT 10       // gpsd commands per second per client; extra ones are ignored
+#define TCP_CMD_QUEUE_DEPTH 4       // gpsd commands held while a client is being served elsewhere (power of two)
+
+// UDP Output (one datagram per epoch, however many listeners)
+#define UDP_OUTPUT_ENABLED false    // true = also send every epoch over UDP
+#define UDP_PORT 10110              // Destination port (10110 is the usual NMEA-over-UDP port)
+const char* const UDP_MULTICAST_GROUP = ""; // e.g. "239.192.0.1"; empty = subnet broadcast
+#define UDP_SEND_NMEA true          // Datagram with the NMEA block
+#define UDP_SEND_JSON false         // Datagram with the gpsd TPV + SKY lines
+
+// Raw UBX Passthrough (u-center, RTKLIB str2str, ...)
+#define UBX_RAW_ENABLED false       // Serve the module's UBX frames on UBX_RAW_PORT
+#define UBX_RAW_PORT 2948           // TCP port for the binary stream
+#define UBX_RAW_MAX_CLIENTS 2
+#define UBX_RAW_FILE_BUFFER 2048    // Library buffer the logged frames are stored in between polls
+#define UBX_RAW_RING_SIZE 4096      // Bytes awaiting client ACKs (power of two)
+#define UBX_RAW_COMMAND_BUFFER 512  // Tool -> module bytes waiting for the GNSS task
+
+// RTCM Corrections (RTK-capable modules such as the ZED-F9P)
+#define RTCM_INPUT_ENABLED false    // true = accept RTCM3 and write it to the module
+#define RTCM_INPUT_PORT 2102        // Raw RTCM3 pushed over TCP (e.g. str2str -out tcpcli://<ip>:2102)
+#define RTCM_BUFFER_SIZE 4096       // Checked frames waiting for the GNSS task to write them over I2C
+const char* const NTRIP_HOST = "";  // Caster to pull corrections from; empty = no NTRIP client
+#define NTRIP_PORT 2101
+const char* const NTRIP_MOUNTPOINT = "";
+const char* const NTRIP_USER = "";
+const char* const NTRIP_PASS = "";
+#define NTRIP_GGA_INTERVAL_MS 10000 // Position reported to the caster (VRS / nearest base); 0 = never
+#define NTRIP_RETRY_MS 10000        // Wait between caster connection attempts
+
+// NMEA Output
+#define NMEA_EXTENDED_SENTENCES 0   // 1 = append VTG and ZDA to the RMC/GGA/GSA block
+
 #endif
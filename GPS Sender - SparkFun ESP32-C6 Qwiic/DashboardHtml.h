@@ -0,0 +1,747 @@
+// Generated by tools/build_dashboard.py from index_decompressed.html. Do not edit.
+#ifndef DASHBOARD_HTML_H
+#define DASHBOARD_HTML_H
+
+#include <Arduino.h>
+
+// 48608 bytes of HTML, 11724 gzipped
+#define DASHBOARD_ETAG "\"c325b6da43b153cd\""
+#define DASHBOARD_HTML_GZ_LEN 11724
+
+const uint8_t dashboard_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xeb, 0x7f, 0xdb, 0x36,
+  0xb2, 0xe8, 0xf7, 0xfc, 0x15, 0xa8, 0xfa, 0x90, 0xd4, 0x4a, 0xb2, 0x28, 0x59, 0xf2, 0x2b, 0x76,
+  0xaf, 0x6b, 0x3b, 0xa9, 0xcf, 0xda, 0x8e, 0x4f, 0xec, 0xf4, 0x71, 0x7b, 0xf3, 0x6b, 0x68, 0x91,
+  0x92, 0xb8, 0xa1, 0x48, 0x1d, 0x92, 0xb2, 0xec, 0xe6, 0xf8, 0x7f, 0xbf, 0x33, 0x03, 0x80, 0x04,
+  0x48, 0x90, 0x92, 0x9c, 0x6c, 0xf7, 0x7c, 0x38, 0xed, 0x6e, 0x4d, 0x11, 0xc0, 0x60, 0xde, 0x18,
+  0x00, 0x03, 0xf0, 0xe5, 0x57, 0xa7, 0x6f, 0x4e, 0x6e, 0x7f, 0xbf, 0x3e, 0x63, 0xd3, 0x64, 0xe6,
+  0x1f, 0xbd, 0x78, 0x89, 0x7f, 0x98, 0x6f, 0x07, 0x93, 0xc3, 0x9a, 0x1b, 0xd4, 0xf0, 0x85, 0x6b,
+  0x3b, 0x47, 0x2f, 0x18, 0x7b, 0x39, 0x73, 0x13, 0x9b, 0x8d, 0xa6, 0x76, 0x14, 0xbb, 0xc9, 0x61,
+  0xed, 0xdd, 0xed, 0xab, 0xf6, 0x6e, 0x2d, 0x2b, 0x08, 0xec, 0x99, 0x7b, 0x58, 0xbb, 0xf7, 0xdc,
+  0xe5, 0x3c, 0x8c, 0x92, 0x1a, 0x1b, 0x85, 0x41, 0xe2, 0x06, 0x50, 0x71, 0xe9, 0x39, 0xc9, 0xf4,
+  0xd0, 0x71, 0xef, 0xbd, 0x91, 0xdb, 0xa6, 0x1f, 0x2d, 0xe6, 0x05, 0x5e, 0xe2, 0xd9, 0x7e, 0x3b,
+  0x1e, 0xd9, 0xbe, 0x7b, 0x68, 0x75, 0xba, 0x1c, 0x50, 0xe2, 0x25, 0xbe, 0x7b, 0x74, 0x76, 0x73,
+  0xdd, 0xef, 0xb1, 0xd7, 0xd7, 0x37, 0xec, 0xd4, 0x8e, 0xa7, 0x77, 0xa1, 0x1d, 0x39, 0x2f, 0xb7,
+  0x78, 0x11, 0x56, 0x8a, 0x93, 0x47, 0xfe, 0xc4, 0xd8, 0x7e, 0x14, 0x86, 0x09, 0xfb, 0x44, 0xcf,
+  0x8c, 0xb5, 0xdb, 0x77, 0x93, 0xf6, 0x28, 0xf4, 0xc3, 0x68, 0x9f, 0x7d, 0x6d, 0xf5, 0xf0, 0xdf,
+  0x83, 0xb4, 0x68, 0x04, 0x50, 0xa0, 0x1c, 0x4b, 0x5c, 0xfc, 0x37, 0x2b, 0xb1, 0x47, 0x23, 0xc0,
+  0x13, 0x0a, 0xba, 0x5d, 0x77, 0x30, 0x1e, 0x67, 0x05, 0x89, 0xfb, 0x90, 0xb4, 0x67, 0xb6, 0x17,
+  0x40, 0xd9, 0x98, 0xfe, 0xc9, 0x97, 0x2d, 0x12, 0xd7, 0x81, 0x42, 0x9b, 0xfe, 0xc9, 0x0a, 0xe3,
+  0x05, 0x80, 0x8c, 0x63, 0x02, 0x39, 0xda, 0x1d, 0xf4, 0xb3, 0x92, 0xa5, 0x1d, 0x05, 0x5e, 0x30,
+  0x21, 0x80, 0xce, 0xb0, 0xdb, 0xcd, 0x4a, 0x1c, 0xe0, 0xb8, 0x8b, 0x88, 0x3b, 0x83, 0x6e, 0x37,
+  0x2b, 0xd8, 0xfa, 0x9e, 0x5d, 0xda, 0x73, 0x76, 0x33, 0x77, 0x47, 0xde, 0xd8, 0x1b, 0xb1, 0x13,
+  0x24, 0x2f, 0x66, 0xdf, 0x6f, 0xa5, 0x0d, 0x67, 0xf6, 0x1c, 0xc0, 0x26, 0xd4, 0xd6, 0x1a, 0xe2,
+  0xbf, 0x07, 0x5a, 0x19, 0x88, 0x12, 0x71, 0xec, 0x8d, 0xf1, 0x5f, 0xbd, 0xe8, 0x2e, 0x8c, 0x1c,
+  0x6a, 0xd7, 0x77, 0xf0, 0x5f, 0xbd, 0x70, 0x12, 0x79, 0xd0, 0x2e, 0x9a, 0xdc, 0xd9, 0x8d, 0x6e,
+  0x8b, 0xf5, 0x7a, 0x7b, 0xf0, 0x9f, 0xc1, 0xa0, 0xc5, 0xba, 0x9d, 0xee, 0xa0, 0xc9, 0xab, 0x3e,
+  0xd1, 0x7f, 0xbf, 0x67, 0x9f, 0xd8, 0xcc, 0x8e, 0x26, 0xc8, 0xa7, 0xee, 0x01, 0x9b, 0xdb, 0x8e,
+  0x43, 0x24, 0xc2, 0xf3, 0x5d, 0xf8, 0xd0, 0x8e, 0xbd, 0xbf, 0xe8, 0x27, 0xef, 0x0c, 0xfa, 0x7c,
+  0x38, 0x10, 0x0d, 0xef, 0x42, 0xe7, 0x11, 0xda, 0x8e, 0x41, 0x51, 0xda, 0x63, 0x7b, 0xe6, 0xf9,
+  0x8f, 0xfb, 0xac, 0x7e, 0xe3, 0x4e, 0x42, 0x97, 0xbd, 0x3b, 0xaf, 0xb7, 0xd8, 0xdb, 0xf0, 0x2e,
+  0x4c, 0xc2, 0x16, 0xfb, 0xd9, 0xf5, 0xef, 0xdd, 0xc4, 0x1b, 0xd9, 0x2d, 0x76, 0x1c, 0x81, 0xd6,
+  0xb4, 0x58, 0x6c, 0x07, 0x71, 0x3b, 0x76, 0x23, 0x6f, 0x0c, 0x7d, 0xd8, 0xa3, 0x8f, 0x93, 0x28,
+  0x5c, 0x20, 0x95, 0xf7, 0x76, 0xd4, 0xc8, 0xb4, 0xa0, 0x79, 0xc0, 0x84, 0x36, 0xf0, 0xf7, 0xa9,
+  0x3c, 0x9b, 0x0a, 0x96, 0x56, 0xe4, 0xce, 0x24, 0x42, 0x2f, 0x04, 0xc7, 0x2f, 0xec, 0xc7, 0x70,
+  0x91, 0x48, 0x26, 0x77, 0x50, 0x93, 0xa1, 0x95, 0x1b, 0x11, 0xa1, 0x0f, 0x5c, 0x87, 0xa1, 0x65,
+  0xaf, 0xdb, 0x9d, 0x03, 0x31, 0x29, 0xed, 0xcc, 0x5e, 0x24, 0xa1, 0x84, 0xd5, 0x41, 0xb3, 0xa1,
+  0x26, 0x8e, 0x17, 0xcf, 0x7d, 0x1b, 0x68, 0x1b, 0xfb, 0x2e, 0x54, 0xff, 0xe7, 0x22, 0x4e, 0xbc,
+  0xf1, 0x63, 0x5b, 0xd8, 0xc7, 0x3e, 0x8b, 0xe7, 0x36, 0x18, 0xc6, 0x9d, 0x9b, 0x2c, 0x5d, 0x37,
+  0x38, 0x60, 0xb6, 0xef, 0x4d, 0x82, 0xb6, 0x97, 0xb8, 0x33, 0x50, 0x20, 0xd4, 0x4c, 0x37, 0x92,
+  0x7d, 0x00, 0xf3, 0x92, 0x24, 0x9c, 0x41, 0xd7, 0x9d, 0x01, 0xa1, 0x9d, 0xf1, 0x1a, 0xc4, 0x32,
+  0x50, 0x28, 0xe9, 0xc4, 0x89, 0x9d, 0x2c, 0xe2, 0xf6, 0x9d, 0xed, 0x4c, 0xdc, 0x22, 0x0e, 0xc6,
+  0x3e, 0x26, 0xf6, 0x7c, 0x9f, 0xed, 0x22, 0x45, 0x2a, 0x4b, 0x49, 0x01, 0x50, 0xf0, 0xf2, 0xff,
+  0xdd, 0x8e, 0xa5, 0xf2, 0x6f, 0x38, 0x7f, 0x00, 0x4e, 0x50, 0x2b, 0x2e, 0xe0, 0xc8, 0x76, 0xbc,
+  0x05, 0x80, 0xed, 0x11, 0x73, 0x48, 0xb8, 0xa0, 0x02, 0x2e, 0xe0, 0xd8, 0xd9, 0x33, 0x60, 0xe8,
+  0xa0, 0x01, 0x33, 0xc9, 0x52, 0x6a, 0x33, 0x75, 0xbd, 0xc9, 0x34, 0x91, 0xbf, 0x72, 0x60, 0x07,
+  0xdd, 0x6f, 0x4d, 0x32, 0xcf, 0xec, 0xb1, 0x29, 0xd4, 0x6e, 0x6a, 0x3b, 0xe1, 0x92, 0x38, 0x83,
+  0x44, 0xb1, 0xd1, 0x22, 0x8a, 0x80, 0x50, 0xb2, 0x9f, 0x03, 0x96, 0x44, 0xa0, 0x41, 0xe0, 0x82,
+  0x42, 0x90, 0x9b, 0xed, 0xfb, 0x80, 0x5b, 0x3f, 0xce, 0x6b, 0xc1, 0x6b, 0x30, 0x00, 0x76, 0xf3,
+  0x18, 0x03, 0x97, 0x52, 0x55, 0x70, 0xa4, 0x43, 0x52, 0x79, 0x8a, 0x96, 0x72, 0x40, 0xff, 0x05,
+  0x34, 0x66, 0xf0, 0x2e, 0x71, 0x51, 0x01, 0x17, 0xb3, 0x00, 0xf0, 0x8d, 0xdc, 0xb9, 0x6b, 0x27,
+  0x0d, 0x54, 0x8d, 0xf6, 0xd8, 0x4b, 0x5a, 0x6c, 0xe6, 0x05, 0xa0, 0x44, 0x8d, 0x3e, 0x2a, 0x4f,
+  0x8b, 0x59, 0xe3, 0xa8, 0xd9, 0x14, 0xbc, 0x57, 0x55, 0xb1, 0x33, 0xe2, 0x9d, 0x14, 0x29, 0x15,
+  0x8e, 0xac, 0x59, 0xe0, 0x8c, 0x35, 0x44, 0x76, 0x65, 0x8a, 0x2d, 0x14, 0x42, 0x67, 0xc6, 0x36,
+  0xb0, 0x02, 0x45, 0x26, 0xec, 0x9a, 0xfe, 0xed, 0xf4, 0x53, 0x60, 0xd0, 0x0c, 0x0a, 0xe3, 0xd0,
+  0x07, 0xd2, 0x0d, 0x92, 0x47, 0xcb, 0x57, 0x11, 0x6c, 0x93, 0x57, 0x96, 0x36, 0x2c, 0xc5, 0xbc,
+  0xcb, 0x3b, 0x26, 0x91, 0x10, 0xa3, 0xc7, 0x61, 0x04, 0x4a, 0xbb, 0x98, 0xcf, 0xdd, 0x68, 0x64,
+  0xc7, 0xee, 0x01, 0xf3, 0xdd, 0x04, 0x54, 0xae, 0x8d, 0x9a, 0xcf, 0x71, 0x45, 0xcc, 0x0d, 0xb6,
+  0x2a, 0xe4, 0x99, 0xd7, 0x7e, 0x02, 0xbf, 0xa1, 0x59, 0xe9, 0xb2, 0xbd, 0x7d, 0x9c, 0x87, 0x93,
+  0xc8, 0x9e, 0x4f, 0x1f, 0x53, 0xd1, 0xde, 0x79, 0x93, 0xf6, 0xbd, 0xed, 0x2f, 0x72, 0xe4, 0xf4,
+  0xa8, 0x33, 0x7a, 0xb1, 0x14, 0x7a, 0x09, 0xa2, 0x2b, 0x92, 0xd0, 0x06, 0x03, 0x9c, 0xa7, 0xae,
+  0xad, 0xb3, 0x80, 0x01, 0x4e, 0x07, 0xc4, 0xb1, 0x5e, 0x49, 0xa4, 0xef, 0x8e, 0xa1, 0x8b, 0x6d,
+  0x05, 0xd4, 0x2c, 0x0c, 0xc2, 0x82, 0x9b, 0x3c, 0x09, 0x17, 0x91, 0x07, 0xee, 0xe5, 0xca, 0x5d,
+  0x82, 0xa7, 0xc4, 0x2a, 0x44, 0x6f, 0x9e, 0x4e, 0x65, 0xdc, 0x98, 0xcd, 0xc3, 0x00, 0x18, 0x13,
+  0x2b, 0x6e, 0x0d, 0x44, 0x4e, 0x6e, 0xde, 0xa0, 0xcc, 0x45, 0x7d, 0xa4, 0xda, 0xe8, 0x32, 0xa0,
+  0xf6, 0x3c, 0x94, 0xc6, 0x13, 0xb9, 0xa0, 0xee, 0xde, 0xbd, 0x9b, 0xab, 0xe7, 0xdb, 0x77, 0xae,
+  0xaf, 0x82, 0xbd, 0xf3, 0xc3, 0xd1, 0xc7, 0x9c, 0x3b, 0xd8, 0x19, 0xac, 0xc7, 0x12, 0x29, 0x77,
+  0x95, 0x29, 0xa3, 0x70, 0xfe, 0xd8, 0xbe, 0x4b, 0x02, 0x0d, 0x19, 0xfb, 0x0e, 0x34, 0x17, 0xda,
+  0x1e, 0xb0, 0x88, 0x4b, 0x0a, 0xe4, 0x94, 0x84, 0x73, 0x3e, 0x14, 0x29, 0x86, 0x44, 0x4a, 0x39,
+  0xb7, 0xd1, 0x1f, 0xac, 0xa9, 0xf8, 0xbd, 0x66, 0x15, 0x9e, 0xa9, 0xcd, 0x81, 0x1f, 0x14, 0x1e,
+  0x54, 0x37, 0x4d, 0xc2, 0x1c, 0x3c, 0x50, 0x8c, 0x00, 0xe6, 0xa1, 0xc7, 0x1d, 0xae, 0xce, 0x0c,
+  0x6e, 0x33, 0x05, 0xbf, 0xd4, 0x8b, 0x0b, 0x34, 0xef, 0x4f, 0xc3, 0x7b, 0x1a, 0x59, 0x44, 0x2f,
+  0x1a, 0x62, 0x3c, 0x9a, 0xc9, 0xa3, 0x9b, 0xbe, 0xd5, 0xd5, 0x03, 0xb5, 0xc2, 0x8e, 0x63, 0xf6,
+  0x1d, 0x2a, 0x8a, 0xeb, 0xa4, 0xaa, 0x11, 0xd8, 0xf7, 0xed, 0x28, 0x5c, 0xae, 0x39, 0x70, 0x94,
+  0x98, 0x9e, 0x4d, 0xdc, 0x56, 0xb0, 0xa7, 0xbe, 0xda, 0xea, 0x68, 0x6a, 0xd2, 0xa3, 0x6c, 0x74,
+  0xd5, 0xc6, 0x82, 0x9e, 0x32, 0x18, 0x70, 0x46, 0x97, 0x0a, 0xcb, 0x6a, 0x9a, 0x47, 0x8d, 0x55,
+  0x1e, 0x43, 0xd2, 0x63, 0x24, 0x32, 0x47, 0x05, 0xa8, 0xe6, 0xc7, 0x12, 0xdd, 0xd3, 0x7d, 0x61,
+  0xd1, 0x7d, 0xdc, 0x85, 0xbe, 0x53, 0xa5, 0x4d, 0xd2, 0xec, 0xa1, 0x87, 0x36, 0xea, 0x37, 0x69,
+  0xf0, 0xa0, 0xe0, 0x21, 0x73, 0x22, 0xe5, 0xf5, 0x63, 0xd2, 0x0a, 0x6e, 0x2e, 0xaa, 0x3b, 0xa2,
+  0x42, 0xf4, 0x6c, 0xc2, 0x30, 0x76, 0xf3, 0x65, 0x28, 0x6b, 0xee, 0x7a, 0xd4, 0xa2, 0x00, 0x94,
+  0x82, 0xfc, 0xbb, 0x10, 0xca, 0xb6, 0x3e, 0x3c, 0x23, 0x53, 0x4d, 0x1c, 0x50, 0xb5, 0x38, 0x1d,
+  0x00, 0x30, 0x42, 0x89, 0xc1, 0x08, 0xee, 0xbc, 0x11, 0x78, 0xe5, 0xbf, 0xc0, 0x79, 0x35, 0xba,
+  0x9d, 0x6d, 0x88, 0x27, 0x31, 0xa4, 0xec, 0xc1, 0x48, 0xd8, 0xcc, 0x75, 0xbb, 0xbf, 0x7f, 0xe7,
+  0x42, 0x43, 0xec, 0x3e, 0x15, 0x51, 0xbd, 0x5e, 0xd2, 0x23, 0xf2, 0xc8, 0x22, 0x8a, 0x39, 0x15,
+  0xdd, 0x54, 0x05, 0xf8, 0xef, 0x61, 0xaa, 0x30, 0x06, 0xe3, 0x6f, 0x0b, 0xae, 0x54, 0x57, 0x92,
+  0x7c, 0xed, 0x77, 0xd3, 0x6a, 0x39, 0x49, 0x28, 0x83, 0x1d, 0x3d, 0x62, 0x24, 0xf0, 0x5b, 0xa3,
+  0x0d, 0x5c, 0x6b, 0x6a, 0x61, 0x21, 0xf8, 0x0a, 0x12, 0xf9, 0x6a, 0x05, 0xb2, 0x3a, 0xbd, 0x32,
+  0x05, 0xaa, 0x8a, 0x0c, 0x34, 0x87, 0x34, 0x2c, 0x73, 0x48, 0xb9, 0xa1, 0x02, 0xe2, 0xb1, 0x98,
+  0x07, 0x3d, 0xd2, 0x0d, 0x60, 0x88, 0x16, 0x97, 0x8d, 0x10, 0x95, 0xe1, 0x4e, 0x9f, 0x47, 0x36,
+  0x72, 0x20, 0x21, 0xdb, 0x25, 0x25, 0x27, 0xdb, 0x2a, 0x58, 0x15, 0x76, 0x84, 0x33, 0x83, 0x5c,
+  0xc0, 0x63, 0x8a, 0x40, 0xfa, 0x5a, 0xf0, 0x6e, 0x8a, 0x10, 0x55, 0x05, 0x26, 0xc0, 0x30, 0xaa,
+  0xe7, 0x86, 0xe2, 0x8e, 0x55, 0xe4, 0xea, 0x00, 0x47, 0xf5, 0xfc, 0x78, 0xa5, 0x82, 0xf1, 0xef,
+  0xfc, 0x7c, 0xa4, 0xb3, 0xb3, 0x62, 0x00, 0x53, 0x9b, 0xc7, 0x8b, 0xbb, 0x7c, 0xf3, 0xa1, 0x61,
+  0x00, 0x4c, 0x95, 0x49, 0x0c, 0x7e, 0xa4, 0xd9, 0x3d, 0x95, 0xa4, 0xc5, 0x1d, 0x52, 0x64, 0xf6,
+  0xcf, 0xa5, 0x3e, 0x4d, 0x91, 0x83, 0x0a, 0x78, 0x50, 0x88, 0xd1, 0x77, 0xd7, 0x24, 0x49, 0x60,
+  0x51, 0xca, 0x14, 0xd1, 0x8b, 0xb0, 0xac, 0xbe, 0x81, 0x00, 0xc7, 0x4e, 0xc8, 0xb4, 0x4d, 0xc4,
+  0xaf, 0x1d, 0xec, 0x48, 0xed, 0x7d, 0x05, 0x56, 0x97, 0x86, 0x36, 0x5e, 0x30, 0x5f, 0x40, 0xa4,
+  0x1d, 0xbb, 0xbe, 0x3b, 0xd2, 0x66, 0x17, 0xf9, 0xb9, 0x83, 0x16, 0x05, 0xf7, 0xd6, 0x8d, 0x82,
+  0xad, 0x6c, 0x74, 0x5d, 0x4e, 0x3d, 0xb4, 0xd8, 0x35, 0x14, 0xb2, 0xc0, 0x75, 0xc1, 0x0d, 0x1e,
+  0xc3, 0x68, 0x18, 0x66, 0xd0, 0x7a, 0xea, 0x98, 0x17, 0x40, 0xfc, 0x66, 0x86, 0xad, 0xe9, 0x31,
+  0xae, 0x2a, 0x14, 0x63, 0x0d, 0xb5, 0x7b, 0x61, 0x8e, 0x8a, 0x93, 0x0e, 0x31, 0x8a, 0x4d, 0x1e,
+  0xf5, 0x70, 0x03, 0x30, 0x6b, 0xcf, 0x23, 0x0f, 0x5a, 0x3e, 0x1a, 0x27, 0x22, 0xf9, 0x48, 0xe3,
+  0x6b, 0x5c, 0xb6, 0x50, 0x1b, 0xc3, 0x1c, 0xda, 0x87, 0x81, 0x3e, 0xd7, 0xf8, 0xb3, 0x82, 0x2f,
+  0xc1, 0x6f, 0xa5, 0x13, 0xbe, 0x6e, 0x62, 0x44, 0x90, 0x17, 0x55, 0x34, 0x4e, 0x03, 0x29, 0x41,
+  0x3f, 0xcd, 0x51, 0x53, 0xad, 0x22, 0xf0, 0xa4, 0xf6, 0x6b, 0xb8, 0xa5, 0xdd, 0x67, 0x28, 0x4f,
+  0x55, 0x24, 0xb9, 0x9b, 0x4e, 0xab, 0x4d, 0x53, 0x2b, 0x4d, 0xe0, 0x01, 0xa8, 0xbe, 0xed, 0x9b,
+  0x35, 0x43, 0x8e, 0xd5, 0x7d, 0x11, 0x95, 0x56, 0x2d, 0xc7, 0x64, 0xf4, 0x66, 0x01, 0xe6, 0x8a,
+  0x85, 0x80, 0x41, 0x81, 0xb9, 0x7a, 0x48, 0x6a, 0x68, 0xd3, 0x6f, 0xaa, 0x66, 0x7b, 0x11, 0x4e,
+  0xd8, 0x2b, 0xcf, 0x07, 0x15, 0x65, 0x37, 0xdc, 0x5a, 0xdb, 0xec, 0xd2, 0x4e, 0x46, 0x53, 0x76,
+  0xb7, 0x80, 0xd1, 0x36, 0x60, 0xb4, 0xd8, 0x27, 0xed, 0xfa, 0x6b, 0x3f, 0x9c, 0x88, 0xda, 0x9f,
+  0x98, 0x58, 0xac, 0x5a, 0x47, 0x30, 0xb2, 0xea, 0xba, 0xf2, 0x11, 0xf5, 0xcb, 0xc5, 0x24, 0x2a,
+  0x18, 0xa4, 0x25, 0x4a, 0x4c, 0x42, 0x53, 0x8b, 0x72, 0xb2, 0xd3, 0x10, 0xd4, 0x24, 0x28, 0x4a,
+  0x34, 0x39, 0xa6, 0xb5, 0x8d, 0xd2, 0x94, 0xc8, 0xe7, 0x3c, 0x80, 0x78, 0x6d, 0xc3, 0x24, 0xdc,
+  0x06, 0x0b, 0x1c, 0xb9, 0xc2, 0xa1, 0xc8, 0x35, 0xbf, 0xa5, 0x7b, 0xf7, 0xd1, 0x83, 0xf1, 0xb9,
+  0xac, 0x7c, 0x16, 0xfe, 0x55, 0x5a, 0x98, 0xc9, 0xa0, 0x0d, 0xee, 0x62, 0x02, 0xa5, 0x8b, 0xc8,
+  0x6f, 0xd4, 0xc0, 0xc1, 0xdb, 0xfb, 0xf4, 0x62, 0x2b, 0xbe, 0x9f, 0xfc, 0xf0, 0x30, 0xf3, 0x5b,
+  0xdf, 0xf6, 0x4f, 0xe0, 0x91, 0xc1, 0x63, 0x10, 0x1f, 0xd6, 0xa7, 0x49, 0x32, 0xdf, 0xdf, 0xda,
+  0x5a, 0x2e, 0x97, 0x9d, 0x65, 0xbf, 0x13, 0x46, 0x93, 0xad, 0x1e, 0xf8, 0x10, 0xac, 0x5c, 0xe7,
+  0x1e, 0xf1, 0xb0, 0x6e, 0xf5, 0xea, 0x82, 0xf8, 0xc3, 0xfa, 0x6e, 0x9d, 0xe1, 0xf2, 0xf2, 0x4f,
+  0xe1, 0xc3, 0x61, 0x1d, 0x97, 0x75, 0xac, 0x1e, 0xdb, 0xad, 0x7f, 0xdb, 0x3f, 0x03, 0xa0, 0x73,
+  0x3b, 0x99, 0xb2, 0xb1, 0xe7, 0xfb, 0x87, 0xf5, 0x6f, 0x7b, 0x7d, 0xbe, 0x1e, 0x5b, 0x67, 0xce,
+  0x61, 0xfd, 0x12, 0x2a, 0xfa, 0x43, 0xb6, 0xcb, 0x86, 0xed, 0xdd, 0xbf, 0xea, 0x5b, 0xbc, 0x36,
+  0xf6, 0x00, 0x4f, 0xb5, 0xa6, 0x81, 0x00, 0x1e, 0xc0, 0x20, 0x7d, 0xe2, 0xd1, 0x50, 0x47, 0x99,
+  0xb6, 0x20, 0x66, 0xe4, 0x50, 0xe5, 0x48, 0xab, 0xab, 0x46, 0x3a, 0xfe, 0x75, 0xa5, 0xdc, 0x9e,
+  0x72, 0x9a, 0x2c, 0x6d, 0xad, 0xd8, 0x4b, 0xb9, 0x0d, 0x59, 0x83, 0x14, 0x73, 0xcd, 0xfa, 0x74,
+  0x35, 0xaa, 0xb4, 0x41, 0x33, 0x2e, 0xe3, 0x70, 0xb4, 0x88, 0x53, 0x5c, 0x84, 0xff, 0xce, 0xc9,
+  0xba, 0x62, 0xce, 0x69, 0x04, 0x0a, 0xce, 0x15, 0x79, 0x65, 0xa0, 0xb0, 0xb0, 0x16, 0x6f, 0x22,
+  0x46, 0xb5, 0x31, 0xd9, 0x81, 0xf4, 0x1e, 0xbf, 0x7a, 0xaf, 0x3c, 0x76, 0xe1, 0xc5, 0xd9, 0x52,
+  0xed, 0xd2, 0x1b, 0x7b, 0x6d, 0x1f, 0xdf, 0x7c, 0x32, 0x0c, 0x79, 0xb8, 0x78, 0x9b, 0xce, 0x5e,
+  0x06, 0xf4, 0x0a, 0x99, 0x3f, 0xf6, 0xc3, 0x65, 0x1b, 0x9c, 0xbf, 0xb6, 0x7c, 0x4b, 0x90, 0xc4,
+  0x72, 0xc7, 0x86, 0x4b, 0x4d, 0x1a, 0xca, 0xf9, 0xd9, 0xc3, 0xea, 0xf5, 0xb5, 0xc2, 0xd8, 0x9d,
+  0xc7, 0x68, 0x5d, 0xf7, 0x2c, 0x56, 0xeb, 0x24, 0xb7, 0xce, 0x83, 0x71, 0xc8, 0xde, 0x86, 0xcb,
+  0x6c, 0x05, 0xc8, 0x83, 0x37, 0x6b, 0xc6, 0x91, 0xeb, 0x2c, 0x52, 0x6b, 0x6b, 0xc2, 0xdd, 0x67,
+  0x50, 0xfe, 0xa4, 0xa0, 0x25, 0x57, 0x90, 0x36, 0x5b, 0x31, 0xda, 0x60, 0xcd, 0x51, 0x5f, 0xaf,
+  0xa3, 0x3e, 0x95, 0x89, 0xc2, 0xea, 0xd8, 0xb3, 0x22, 0x70, 0xcd, 0xaf, 0x77, 0x67, 0x12, 0x00,
+  0x0c, 0xec, 0x11, 0xae, 0x73, 0xd0, 0xae, 0x8e, 0x94, 0xc3, 0xc4, 0x0f, 0xef, 0x5c, 0x6d, 0x61,
+  0x44, 0x8b, 0x07, 0x53, 0xe7, 0xcf, 0x55, 0xb6, 0x18, 0xe8, 0xa4, 0x5b, 0x40, 0x4d, 0x73, 0x14,
+  0x60, 0x5a, 0x66, 0x91, 0x8a, 0xbf, 0xcf, 0xa6, 0x9e, 0xe3, 0xa0, 0x4c, 0x93, 0x70, 0x31, 0x9a,
+  0xb6, 0x11, 0x3d, 0xac, 0xc9, 0xa3, 0x4d, 0xa9, 0x8b, 0x93, 0xc8, 0xbe, 0x4b, 0x79, 0x95, 0x43,
+  0x77, 0x5f, 0x50, 0xf4, 0x49, 0xab, 0x7d, 0x07, 0x4c, 0x96, 0x2d, 0x46, 0x76, 0x70, 0x6f, 0xc7,
+  0x65, 0x64, 0xf1, 0x5f, 0xe6, 0x99, 0x97, 0x5c, 0xa1, 0x98, 0x53, 0x77, 0x51, 0xe8, 0xc7, 0x25,
+  0x73, 0xe6, 0x54, 0xc9, 0x88, 0x45, 0x91, 0xba, 0x81, 0x90, 0x53, 0x6d, 0x9a, 0x09, 0xe9, 0x6b,
+  0x23, 0xf3, 0xb6, 0x16, 0x85, 0xf7, 0xb5, 0x95, 0xa7, 0x7e, 0xd7, 0xb8, 0x25, 0xd2, 0xef, 0xb6,
+  0xf8, 0xff, 0x40, 0xcc, 0xcd, 0x67, 0x07, 0xb2, 0xa6, 0x69, 0xb9, 0x69, 0xb1, 0x28, 0xef, 0x12,
+  0x3e, 0x6b, 0x29, 0xab, 0x72, 0x91, 0x51, 0x70, 0xc3, 0xe8, 0x63, 0xcc, 0x71, 0xff, 0x9d, 0x6f,
+  0xa3, 0xc0, 0x2a, 0x17, 0x23, 0xf3, 0xd2, 0x24, 0x73, 0xc3, 0x1e, 0x80, 0x88, 0x12, 0x89, 0x2a,
+  0x7e, 0x9b, 0x2f, 0xe1, 0x58, 0x66, 0x41, 0xc8, 0xe9, 0xdb, 0x50, 0x0d, 0x9f, 0xb7, 0xab, 0x16,
+  0x62, 0x37, 0x9a, 0xc2, 0x0b, 0x96, 0xb7, 0xdd, 0x7b, 0x5c, 0x3c, 0xd7, 0x67, 0x61, 0x6b, 0x84,
+  0x92, 0x99, 0xf1, 0xdf, 0xb8, 0xb8, 0x77, 0x89, 0x11, 0x6f, 0xe6, 0x80, 0x61, 0x90, 0xd4, 0xcc,
+  0x3e, 0x67, 0xe9, 0xc5, 0xc1, 0xa9, 0x94, 0xfa, 0x7e, 0x99, 0xe9, 0xeb, 0x33, 0xd3, 0x35, 0x7d,
+  0x9b, 0xc9, 0xe9, 0x6e, 0xbc, 0x41, 0xa4, 0x11, 0xb7, 0xbf, 0x2f, 0x23, 0xcc, 0x78, 0x04, 0x66,
+  0xec, 0xdf, 0xd9, 0x8a, 0x9b, 0x53, 0x57, 0x6c, 0x56, 0xb5, 0x42, 0xef, 0x3e, 0xfa, 0x68, 0x1a,
+  0xfc, 0x8a, 0xf3, 0x78, 0xd3, 0x72, 0xd7, 0x1a, 0x1d, 0x4c, 0x17, 0xb3, 0xbb, 0xd5, 0xa3, 0xeb,
+  0x17, 0xe9, 0x66, 0xdd, 0xa1, 0xbc, 0xaf, 0xb3, 0x55, 0x4c, 0xab, 0xb5, 0x65, 0xbe, 0x4d, 0x07,
+  0x5c, 0xc4, 0x9f, 0xbc, 0x10, 0x0d, 0x89, 0x20, 0xe9, 0x79, 0xe4, 0xb6, 0x97, 0x91, 0x3d, 0x87,
+  0xd7, 0xb8, 0x85, 0x83, 0x8f, 0x60, 0xdc, 0x91, 0x6b, 0x7f, 0x6c, 0xe3, 0x0b, 0x0d, 0x81, 0xc4,
+  0x9b, 0xb9, 0xf9, 0xc5, 0x1b, 0xd3, 0xd6, 0x8d, 0xe6, 0x88, 0x95, 0xf6, 0xb3, 0x78, 0x62, 0x6e,
+  0xce, 0x77, 0xe7, 0x73, 0x3c, 0x14, 0x7e, 0xdf, 0xe4, 0xc8, 0xd5, 0xb5, 0x15, 0x7d, 0x0c, 0x90,
+  0x51, 0x53, 0xdc, 0xe6, 0x3b, 0xcd, 0x9b, 0xec, 0x82, 0x0f, 0x8b, 0x6e, 0x22, 0xb7, 0xe1, 0x8e,
+  0x0e, 0xa6, 0xc4, 0x21, 0x19, 0x2c, 0x22, 0xbf, 0x53, 0xdb, 0xd3, 0x11, 0xd4, 0xf6, 0xc0, 0xb5,
+  0x79, 0xfb, 0xee, 0xfa, 0x3b, 0xe0, 0xe9, 0x6a, 0x47, 0x7e, 0xf7, 0x7b, 0x58, 0xd8, 0xfd, 0xd6,
+  0x7a, 0xc6, 0xf4, 0x86, 0x00, 0x66, 0xde, 0xae, 0x79, 0xbb, 0x59, 0xe4, 0xb2, 0x64, 0xae, 0xec,
+  0xff, 0xcc, 0x5c, 0xc7, 0xb3, 0x59, 0x43, 0xc9, 0x84, 0xd8, 0xc5, 0xbd, 0xec, 0x66, 0x1a, 0xe1,
+  0x97, 0x6d, 0xa5, 0x5a, 0x9d, 0xa1, 0xb2, 0xa3, 0x98, 0xdb, 0x4d, 0x2f, 0x59, 0x4f, 0xb6, 0xc6,
+  0x29, 0xbe, 0xf8, 0xdf, 0x97, 0x5b, 0x22, 0xfb, 0xe7, 0xe5, 0x16, 0x4f, 0x4b, 0x7a, 0x89, 0x49,
+  0x24, 0x94, 0x16, 0xe4, 0x78, 0xf7, 0x6c, 0xe4, 0xdb, 0x71, 0x7c, 0x58, 0x4b, 0xed, 0xae, 0xc6,
+  0xd3, 0x84, 0xd4, 0x32, 0x9e, 0x96, 0x21, 0x0a, 0xa0, 0x68, 0xda, 0x33, 0xe7, 0x1b, 0xc1, 0x7b,
+  0x59, 0xc5, 0x66, 0xd3, 0xc8, 0x1d, 0x43, 0x53, 0x98, 0xae, 0xc6, 0x30, 0x5f, 0x9d, 0x78, 0x60,
+  0xbb, 0x77, 0xb8, 0x15, 0xb4, 0x35, 0x9a, 0xde, 0xdf, 0x7f, 0x5c, 0x80, 0xfe, 0x6d, 0x11, 0x90,
+  0xf6, 0xd5, 0xf9, 0xd5, 0x71, 0x1b, 0x20, 0xd5, 0x58, 0x02, 0x3a, 0x89, 0x69, 0x52, 0x7f, 0xc2,
+  0xf0, 0x18, 0x7c, 0xac, 0xf1, 0x85, 0x0c, 0x44, 0xcd, 0x34, 0x3c, 0x92, 0xee, 0x3b, 0xee, 0x28,
+  0x8c, 0x6c, 0x35, 0xfa, 0x32, 0x04, 0x93, 0x45, 0x2f, 0x9c, 0x03, 0x65, 0xd2, 0xd0, 0xa2, 0x97,
+  0xaa, 0x1d, 0xbd, 0xf6, 0x92, 0x9f, 0x17, 0x77, 0x2f, 0xb7, 0x6c, 0xc1, 0xa2, 0x2d, 0xe0, 0xd1,
+  0xd1, 0x8b, 0x02, 0xbb, 0x52, 0x11, 0x65, 0x1c, 0x53, 0x19, 0xad, 0x16, 0x14, 0x8b, 0x78, 0x7a,
+  0x40, 0x4a, 0xbb, 0x34, 0x3f, 0x73, 0xcc, 0x52, 0x31, 0xc3, 0x10, 0xb6, 0xa9, 0xf4, 0x84, 0x69,
+  0x60, 0x73, 0x3b, 0x38, 0xba, 0x16, 0x81, 0x03, 0xe8, 0x05, 0xfe, 0x54, 0xcb, 0x11, 0x17, 0x63,
+  0xc7, 0x68, 0xe1, 0x64, 0x57, 0xab, 0xba, 0xd0, 0x09, 0x52, 0x33, 0x6a, 0x52, 0x92, 0xd4, 0x4d,
+  0xfb, 0x5d, 0xe2, 0xab, 0xd6, 0x3e, 0x85, 0xe1, 0x39, 0x12, 0xc0, 0x69, 0x88, 0xb9, 0x71, 0x1a,
+  0x48, 0x30, 0xc2, 0xda, 0x91, 0x10, 0x40, 0xa1, 0x35, 0xd2, 0x45, 0xcd, 0xc7, 0xde, 0xc3, 0x0d,
+  0xd5, 0xaf, 0x1d, 0x9d, 0xf3, 0xec, 0x39, 0x5a, 0xfb, 0xe9, 0x74, 0x3a, 0x45, 0xe2, 0x53, 0x79,
+  0x96, 0xbe, 0xc8, 0xff, 0xd4, 0xac, 0x47, 0xe6, 0x05, 0xd4, 0x0a, 0x0c, 0xd5, 0xaa, 0x20, 0xe7,
+  0xf2, 0x0c, 0x23, 0x74, 0xb5, 0x5a, 0x34, 0x91, 0xab, 0x1d, 0x5d, 0x1c, 0xdf, 0x9e, 0xdf, 0xbe,
+  0x3b, 0x3d, 0x33, 0x22, 0xab, 0x80, 0xce, 0x7c, 0x07, 0xc6, 0x23, 0x35, 0x22, 0x1d, 0x5c, 0x42,
+  0xed, 0x08, 0x5c, 0x29, 0xff, 0xc7, 0xc0, 0xa9, 0x97, 0x62, 0xb5, 0x30, 0xed, 0x98, 0x6f, 0x94,
+  0xd7, 0x58, 0x18, 0x8c, 0x7c, 0x6f, 0xf4, 0x91, 0xbf, 0x6a, 0xd4, 0x01, 0x10, 0x04, 0x3a, 0xc9,
+  0xd4, 0x8b, 0x9b, 0xb5, 0xa3, 0x93, 0x37, 0xd7, 0xbf, 0xbf, 0xdc, 0xe2, 0x2d, 0x2b, 0x38, 0xf5,
+  0xf9, 0x94, 0xbf, 0xb9, 0x7a, 0xfd, 0x7c, 0xd2, 0xc3, 0xe0, 0x0b, 0x91, 0x1e, 0x06, 0x7f, 0x3f,
+  0xe9, 0xc7, 0x17, 0xcf, 0x17, 0xba, 0xed, 0x73, 0xa1, 0xb3, 0x99, 0x89, 0x6a, 0xd5, 0x30, 0xb3,
+  0x0d, 0xb1, 0xa2, 0xf9, 0x71, 0x37, 0xa1, 0x61, 0xa8, 0x6c, 0x5d, 0xd5, 0x8e, 0x2e, 0xcf, 0xaf,
+  0x04, 0x72, 0xc6, 0x3a, 0x0e, 0x68, 0x9e, 0xc4, 0xe6, 0xd2, 0x03, 0x51, 0xb4, 0xdb, 0xb2, 0xba,
+  0x81, 0xa4, 0x75, 0xfa, 0x3b, 0xfe, 0x6d, 0xed, 0xfe, 0xec, 0x87, 0x15, 0xfd, 0x7d, 0x86, 0x3a,
+  0x00, 0xfc, 0x67, 0xa8, 0x43, 0x89, 0x7f, 0x15, 0x03, 0x0c, 0x9f, 0xb1, 0xad, 0x9a, 0x11, 0xc9,
+  0x95, 0x51, 0x5e, 0x5b, 0xdd, 0x2b, 0xe4, 0xa9, 0x3a, 0x22, 0x6d, 0x6d, 0xb3, 0x05, 0xa9, 0xbc,
+  0xe0, 0x11, 0xbb, 0xa3, 0x2a, 0x93, 0x3c, 0x39, 0xbe, 0x60, 0xb7, 0xe7, 0x97, 0x67, 0x46, 0x61,
+  0x88, 0x4d, 0x63, 0x69, 0x81, 0x23, 0xdb, 0xbf, 0x85, 0x78, 0x17, 0x85, 0xb1, 0x4f, 0xff, 0x4b,
+  0x45, 0x52, 0x74, 0xd9, 0x2a, 0x5b, 0xd4, 0x0d, 0x6f, 0x0a, 0x84, 0x01, 0xcd, 0x72, 0x9c, 0xde,
+  0xdd, 0x9e, 0xac, 0x89, 0x51, 0xb2, 0x16, 0x32, 0x55, 0x0e, 0x5f, 0x1d, 0xed, 0x9f, 0x33, 0xa2,
+  0x1f, 0x5d, 0xd9, 0xf7, 0xde, 0xc4, 0xe6, 0x23, 0x6f, 0xe9, 0x40, 0x22, 0xb2, 0x88, 0x2a, 0x46,
+  0x91, 0x5c, 0x46, 0x50, 0xc5, 0xe8, 0xab, 0xe5, 0xdd, 0xf0, 0xd4, 0x18, 0xc0, 0x62, 0x85, 0x67,
+  0x28, 0x36, 0x02, 0xd4, 0xcf, 0x36, 0x6e, 0x04, 0x23, 0xee, 0xcd, 0xc6, 0x8d, 0x80, 0xec, 0x5f,
+  0x57, 0x34, 0xe2, 0x69, 0x2e, 0x5c, 0xa6, 0x02, 0xc0, 0x15, 0x7f, 0x75, 0xb4, 0xa2, 0xa5, 0x9a,
+  0x44, 0xc2, 0xdb, 0x8b, 0x37, 0xe0, 0x31, 0xbf, 0x73, 0xdc, 0xc9, 0xc1, 0x2a, 0x6d, 0x28, 0x57,
+  0xd4, 0xd5, 0x81, 0x90, 0xa6, 0xb5, 0x37, 0xd7, 0x67, 0x67, 0xa7, 0x2b, 0xb0, 0x4d, 0xbd, 0x3b,
+  0x47, 0x35, 0xc6, 0x54, 0x33, 0x72, 0xed, 0x2b, 0xda, 0x61, 0x0e, 0x65, 0xed, 0x68, 0xb6, 0x15,
+  0xff, 0x4b, 0x07, 0x80, 0x35, 0x1d, 0x32, 0x61, 0xfd, 0x0c, 0x97, 0xbc, 0x7e, 0xdc, 0x95, 0x65,
+  0xdb, 0xe4, 0xc3, 0x4b, 0xee, 0x2a, 0xb9, 0x63, 0xd4, 0x29, 0xcc, 0xb7, 0xc7, 0x1d, 0xc0, 0x82,
+  0x2f, 0x2c, 0xf7, 0x24, 0xd3, 0xe3, 0xd1, 0x08, 0x24, 0x81, 0x43, 0xac, 0x61, 0x34, 0x2b, 0x36,
+  0x24, 0x8e, 0xfd, 0xdc, 0x61, 0xd0, 0xcc, 0xdc, 0x22, 0x8f, 0x0e, 0xb0, 0x11, 0x58, 0x8c, 0xd9,
+  0xf1, 0x59, 0x20, 0x8b, 0x9d, 0xe6, 0xc7, 0xd2, 0xbc, 0x7c, 0x0d, 0x6f, 0x3e, 0x8f, 0xd2, 0xfb,
+  0xe7, 0x50, 0xfa, 0xcb, 0x67, 0x52, 0x7a, 0xff, 0xef, 0xa0, 0x34, 0x49, 0xc6, 0x63, 0xa5, 0xc7,
+  0xb5, 0x08, 0xbd, 0xbd, 0x7d, 0xf5, 0xca, 0x50, 0x7f, 0x9d, 0x21, 0xe4, 0xf9, 0x63, 0xc8, 0x0d,
+  0xf8, 0x1b, 0xdb, 0x67, 0xff, 0xb9, 0x00, 0xcf, 0x93, 0x3c, 0xe6, 0xfa, 0x5a, 0xd7, 0x42, 0xd6,
+  0x4c, 0x43, 0x33, 0xad, 0x10, 0x95, 0x8e, 0x4b, 0x25, 0x4c, 0xaf, 0xe0, 0x79, 0x0c, 0x78, 0xbd,
+  0x8b, 0xd1, 0xab, 0x99, 0xf9, 0x5e, 0xc2, 0x76, 0x6c, 0xc2, 0x6e, 0xa0, 0xed, 0xaa, 0xf8, 0x58,
+  0xd1, 0x30, 0xfb, 0x41, 0xd5, 0x30, 0xec, 0x38, 0xef, 0x94, 0xd6, 0xf2, 0xfc, 0x9f, 0x45, 0xea,
+  0x2f, 0x5e, 0xec, 0xdd, 0xf9, 0xee, 0x86, 0xd4, 0x8a, 0x56, 0x9f, 0x4f, 0xb0, 0x00, 0xf4, 0xf7,
+  0xd2, 0xbd, 0x98, 0xcb, 0xb0, 0x6b, 0x13, 0x01, 0x53, 0x23, 0xc3, 0xe2, 0x84, 0xd1, 0xb0, 0x56,
+  0xe9, 0xfc, 0x97, 0x23, 0x66, 0xee, 0x84, 0xf3, 0x0d, 0x49, 0xb9, 0x3e, 0x7d, 0x73, 0xbd, 0x81,
+  0xd4, 0x74, 0x47, 0x88, 0xfd, 0xad, 0x70, 0x84, 0x5f, 0x58, 0x5c, 0xd3, 0xcd, 0x29, 0xfc, 0xf9,
+  0x73, 0x28, 0x9c, 0xfe, 0xed, 0x14, 0xde, 0x6f, 0x4e, 0xe1, 0x2f, 0x9f, 0x43, 0xe1, 0xfd, 0xc6,
+  0x14, 0x56, 0xba, 0xf4, 0xe7, 0x44, 0x38, 0xea, 0xe8, 0x71, 0x12, 0x06, 0x63, 0x6f, 0xb2, 0x88,
+  0x4c, 0x93, 0x90, 0x92, 0xe5, 0xbf, 0xea, 0xcc, 0x65, 0x18, 0x28, 0xf8, 0x6a, 0x73, 0x96, 0x2a,
+  0x6b, 0x9c, 0x55, 0x16, 0x97, 0xe8, 0x78, 0xaa, 0x82, 0x71, 0x9e, 0x79, 0x76, 0xca, 0x2e, 0xdf,
+  0xe0, 0xfa, 0x07, 0xbd, 0x30, 0x2d, 0xef, 0xf1, 0xac, 0x37, 0x9a, 0x68, 0x42, 0x7c, 0x19, 0x3a,
+  0x2e, 0x4d, 0xd5, 0xa7, 0xb8, 0x98, 0x0f, 0xc2, 0x70, 0x93, 0x0b, 0xd7, 0x69, 0xe0, 0x34, 0xbd,
+  0x43, 0x11, 0x74, 0xd3, 0xb0, 0xc0, 0x08, 0x50, 0x44, 0x8a, 0x0d, 0x55, 0x39, 0xac, 0x75, 0x6b,
+  0x47, 0x6f, 0xc6, 0xe3, 0x97, 0x5b, 0xfc, 0xed, 0x51, 0xbe, 0xd8, 0x82, 0xe2, 0x20, 0x2d, 0x5d,
+  0x0d, 0xae, 0x57, 0x3b, 0xfa, 0xc9, 0xf7, 0x82, 0x8f, 0xac, 0xf1, 0x16, 0x26, 0x19, 0xcd, 0x52,
+  0xb8, 0xfd, 0xb4, 0xde, 0x2b, 0xef, 0xa1, 0xb9, 0x41, 0x07, 0xdb, 0x69, 0xc3, 0xcb, 0xf0, 0xde,
+  0xad, 0x68, 0x09, 0x7a, 0x47, 0xec, 0xca, 0x8b, 0xa5, 0x64, 0x1e, 0xbe, 0x91, 0xa8, 0xde, 0x5d,
+  0x9f, 0x1e, 0xdf, 0x9e, 0xb1, 0xb7, 0xf0, 0x9f, 0xb5, 0xa4, 0x05, 0x8a, 0x97, 0x17, 0xd5, 0x5b,
+  0x78, 0xb5, 0xa9, 0xac, 0xac, 0x6e, 0x17, 0xc4, 0x65, 0xc5, 0xa5, 0x5c, 0x1d, 0x50, 0x85, 0x41,
+  0xbc, 0x01, 0x3f, 0x11, 0x26, 0x02, 0xed, 0x96, 0x43, 0xed, 0xf3, 0x2a, 0xfd, 0x6e, 0xfc, 0x05,
+  0xb8, 0x5d, 0x7c, 0x53, 0x66, 0x89, 0x9a, 0xb5, 0x0f, 0x4c, 0xeb, 0xe5, 0xaa, 0xb9, 0xcb, 0xf4,
+  0x24, 0x33, 0x1f, 0x55, 0x17, 0x97, 0x65, 0x0c, 0x41, 0x58, 0x79, 0x7b, 0x7c, 0x7b, 0xfe, 0xe6,
+  0x8a, 0x9d, 0x5f, 0x97, 0x2c, 0xd1, 0x19, 0x1b, 0x67, 0xf1, 0x4d, 0x72, 0x5e, 0xea, 0x56, 0xcd,
+  0xaa, 0xf6, 0x05, 0x70, 0x3e, 0xbe, 0x7e, 0x2e, 0xba, 0xf6, 0xfc, 0xdf, 0x80, 0x2e, 0xee, 0x72,
+  0xb1, 0xdb, 0x93, 0x6b, 0x76, 0xfd, 0xe6, 0xed, 0xed, 0xb3, 0xd0, 0x4e, 0x46, 0xf3, 0x6b, 0xbc,
+  0x25, 0xe0, 0xef, 0xc6, 0xfc, 0xe4, 0xfa, 0x1d, 0xbb, 0x3d, 0xbb, 0x7c, 0x1e, 0xaf, 0x47, 0xf3,
+  0xc5, 0x2d, 0x0c, 0x1b, 0x9b, 0x20, 0xfd, 0x2f, 0x5d, 0x84, 0xbb, 0xb4, 0xe7, 0x15, 0xcb, 0x09,
+  0xb9, 0x2c, 0x2d, 0x4e, 0xc2, 0xcc, 0x9e, 0x9f, 0x98, 0x57, 0xdb, 0x5e, 0x8a, 0x24, 0x2d, 0x59,
+  0x8b, 0x7e, 0xe1, 0x42, 0x14, 0x7f, 0xff, 0xaf, 0xa2, 0x81, 0x52, 0x38, 0x6f, 0xdc, 0x64, 0x51,
+  0x20, 0x45, 0x5f, 0xc8, 0xc6, 0x04, 0x2d, 0xe5, 0x4c, 0x81, 0xb0, 0x55, 0xc0, 0xed, 0x27, 0x6d,
+  0x71, 0x1b, 0xdf, 0xfc, 0xea, 0x8d, 0xbd, 0x06, 0x38, 0xdf, 0x1b, 0x78, 0x66, 0x57, 0x6e, 0xb2,
+  0x0c, 0xa3, 0x8f, 0x71, 0x71, 0x79, 0x3b, 0xdd, 0x97, 0xc3, 0xbc, 0x4a, 0x4c, 0x22, 0x4d, 0xb7,
+  0xe5, 0xd2, 0x24, 0xd2, 0xc2, 0x3a, 0x5c, 0xa9, 0x2f, 0x2b, 0xc4, 0x2d, 0x2f, 0xe9, 0x0c, 0x0a,
+  0x4b, 0x1e, 0xe7, 0x62, 0x7d, 0x4d, 0x60, 0x1c, 0xe3, 0xdc, 0x15, 0x22, 0x8f, 0x91, 0x3b, 0x0d,
+  0x7d, 0xc7, 0x8d, 0x0e, 0x6b, 0x02, 0x43, 0x76, 0x73, 0x73, 0x7e, 0x5a, 0x0e, 0x02, 0x17, 0x07,
+  0x31, 0x0b, 0x43, 0xc4, 0xef, 0xf0, 0x2b, 0x07, 0xe6, 0x5a, 0x56, 0xd0, 0x40, 0x98, 0x99, 0x48,
+  0x49, 0x1a, 0x72, 0x3a, 0x77, 0xef, 0x12, 0x0b, 0x4d, 0x54, 0xd1, 0xee, 0xb1, 0x9a, 0xb3, 0xa7,
+  0x72, 0x1a, 0x1a, 0x4a, 0x4e, 0x9f, 0xf0, 0x0c, 0x02, 0x3c, 0x46, 0x0a, 0x6f, 0x8d, 0x3b, 0x09,
+  0x2b, 0x11, 0x71, 0xdc, 0x59, 0xf8, 0x2c, 0x44, 0x92, 0x70, 0x32, 0xf1, 0xdd, 0x53, 0x68, 0x8e,
+  0xd1, 0x13, 0xa2, 0x83, 0xcf, 0x0c, 0x7f, 0xa8, 0xe1, 0x2b, 0xc2, 0x97, 0xfb, 0xa7, 0x6f, 0xd2,
+  0xd5, 0x0e, 0x83, 0x5a, 0x7c, 0x51, 0xf5, 0x16, 0xd7, 0x07, 0x80, 0x82, 0x27, 0x5e, 0x30, 0x89,
+  0xd7, 0x59, 0xe4, 0x48, 0x1d, 0x5b, 0x8e, 0x13, 0x7a, 0x76, 0x4b, 0x2e, 0xd5, 0x87, 0xf2, 0x05,
+  0x2a, 0x17, 0x89, 0x54, 0x2f, 0x48, 0x46, 0x77, 0x79, 0x7c, 0xb2, 0x7a, 0x89, 0x48, 0x77, 0x80,
+  0x68, 0x18, 0x97, 0xf6, 0x28, 0xc5, 0x4c, 0xcb, 0x26, 0x2b, 0x4b, 0x1f, 0xdb, 0x23, 0xd3, 0x28,
+  0xba, 0xcc, 0xff, 0x21, 0xbc, 0x38, 0xbb, 0xb9, 0x6e, 0x5f, 0xbd, 0xf9, 0x95, 0x61, 0xd8, 0xf0,
+  0xee, 0x66, 0x53, 0x8e, 0xb8, 0x81, 0xd4, 0xa9, 0x95, 0x04, 0x6e, 0x44, 0x97, 0x29, 0x36, 0x2a,
+  0x25, 0xe1, 0xe2, 0xf8, 0xe6, 0x96, 0x9d, 0xbd, 0x7d, 0xfb, 0xe6, 0xed, 0xe6, 0xe8, 0x9f, 0x45,
+  0x51, 0x18, 0x99, 0xb3, 0x53, 0x64, 0x42, 0xd1, 0xc6, 0xc2, 0x23, 0xc8, 0xf1, 0xfc, 0x2a, 0x5c,
+  0x9e, 0xf8, 0x1e, 0x66, 0x4d, 0xae, 0x20, 0xd3, 0xb8, 0xfc, 0xf1, 0xb9, 0x73, 0x37, 0xb6, 0x16,
+  0x4b, 0x2b, 0xdd, 0x52, 0xb6, 0x65, 0xea, 0xbb, 0x76, 0xf4, 0xd6, 0x9e, 0x91, 0xaf, 0xc3, 0x67,
+  0x98, 0x26, 0x5c, 0xf2, 0x03, 0xb3, 0x26, 0x67, 0xb7, 0x21, 0xe0, 0x9b, 0x24, 0x8c, 0xec, 0x89,
+  0x9b, 0x01, 0x7f, 0x05, 0x8d, 0xa6, 0x4c, 0xbc, 0x5e, 0xe1, 0xa1, 0x8c, 0x63, 0xd2, 0x67, 0xd0,
+  0x2c, 0x00, 0x95, 0xf8, 0x5a, 0xdc, 0x0b, 0xc5, 0xc9, 0x42, 0x87, 0x12, 0xa2, 0xea, 0x5b, 0x8b,
+  0xb9, 0x03, 0x72, 0xa8, 0x83, 0x47, 0xbd, 0x3d, 0x66, 0xaf, 0xbc, 0x68, 0xb6, 0xb4, 0x23, 0x97,
+  0xbd, 0xa3, 0xb7, 0xab, 0x11, 0xdf, 0x14, 0x11, 0xe3, 0xc1, 0x16, 0xab, 0xcf, 0x8f, 0x90, 0xe3,
+  0x29, 0xf2, 0xed, 0x2c, 0x29, 0x39, 0xdd, 0x7c, 0xc6, 0xa6, 0xe2, 0x3f, 0xdd, 0xce, 0x6e, 0x53,
+  0xa5, 0x26, 0x72, 0xef, 0xc2, 0x30, 0x39, 0x8b, 0xe7, 0xc8, 0xfa, 0xb7, 0xf4, 0x43, 0xdc, 0xf7,
+  0x92, 0xc7, 0x7d, 0xc5, 0x38, 0xa0, 0x2d, 0x46, 0x73, 0xa5, 0xa4, 0x0d, 0xea, 0x80, 0xf5, 0x0f,
+  0xd6, 0x4f, 0x8f, 0x32, 0xa5, 0x23, 0x1a, 0x52, 0x9e, 0x94, 0x3c, 0xe2, 0x92, 0xac, 0x27, 0x19,
+  0xc6, 0xc8, 0xcc, 0xc7, 0x8a, 0xbd, 0x3c, 0x9e, 0x02, 0x28, 0xbc, 0x3b, 0xe5, 0x26, 0x19, 0xb7,
+  0x1e, 0xd3, 0x51, 0x74, 0x19, 0x4b, 0x7f, 0x77, 0xea, 0xc5, 0x69, 0xe2, 0xe0, 0xba, 0x0b, 0x9c,
+  0x26, 0x0c, 0xd4, 0x1c, 0xcf, 0x15, 0xb1, 0x4b, 0x4e, 0x35, 0x30, 0x31, 0x00, 0x34, 0xa3, 0x18,
+  0x0b, 0x1c, 0x2f, 0x92, 0xf0, 0x86, 0xf2, 0x6c, 0x1b, 0xcd, 0x5a, 0x19, 0x25, 0x76, 0x5a, 0xe9,
+  0x16, 0xa3, 0xb3, 0x23, 0x6c, 0xd4, 0xe6, 0x2f, 0xf6, 0xd9, 0x9b, 0x2b, 0x13, 0x49, 0xeb, 0x84,
+  0x35, 0xab, 0x71, 0xc4, 0xfc, 0x0b, 0x14, 0x1e, 0x0f, 0x9c, 0xe6, 0x8f, 0x42, 0x92, 0x5f, 0x08,
+  0x38, 0x3a, 0x90, 0x14, 0x3a, 0x79, 0x93, 0x52, 0xf0, 0x62, 0x31, 0x63, 0x25, 0xf8, 0xc2, 0xe9,
+  0x03, 0x99, 0x17, 0x21, 0x0e, 0x78, 0xa9, 0xab, 0x20, 0xf6, 0x7c, 0xee, 0x23, 0x75, 0xbc, 0xa4,
+  0xc8, 0x7e, 0x7d, 0x15, 0xc2, 0xf6, 0x71, 0xbe, 0x3e, 0x0d, 0x97, 0xec, 0xd8, 0xf7, 0xcd, 0x0b,
+  0x11, 0xb9, 0x16, 0x41, 0xd8, 0x9e, 0xcc, 0x41, 0x4f, 0x7e, 0xf6, 0x1c, 0x17, 0x33, 0x36, 0xd7,
+  0x6d, 0x04, 0xc3, 0x51, 0x80, 0x73, 0x45, 0x6a, 0x27, 0x86, 0xfc, 0xb5, 0xda, 0x42, 0x6f, 0xed,
+  0x30, 0xf0, 0x1f, 0x6b, 0x47, 0x98, 0x1f, 0xfa, 0x06, 0x9e, 0xd6, 0x6a, 0xc6, 0xfb, 0x13, 0x2d,
+  0x65, 0x88, 0x51, 0xd6, 0xba, 0xb8, 0xd0, 0xb2, 0x86, 0xbd, 0x28, 0x93, 0x3a, 0x78, 0xa5, 0x4c,
+  0xea, 0x4c, 0x01, 0xac, 0xf6, 0x98, 0x39, 0xb3, 0x97, 0xf1, 0x28, 0xf2, 0xe6, 0xa2, 0x5f, 0xdf,
+  0x4d, 0x18, 0xc9, 0x17, 0x48, 0x38, 0x77, 0xd8, 0x21, 0x0b, 0x16, 0xbe, 0x38, 0x99, 0x8a, 0x45,
+  0x22, 0x83, 0xf8, 0x5c, 0xd4, 0x80, 0xf2, 0x41, 0x7a, 0x4d, 0x1d, 0x35, 0x8d, 0xcf, 0x1c, 0x0f,
+  0x83, 0x5c, 0x28, 0x19, 0xdb, 0x7e, 0xec, 0x66, 0x45, 0xdc, 0x0b, 0xfd, 0x1a, 0xa7, 0x30, 0xf9,
+  0x91, 0x88, 0x2d, 0xf6, 0xca, 0xc6, 0x54, 0xf8, 0xd1, 0x47, 0xcc, 0x43, 0xf7, 0x5d, 0xb6, 0xb5,
+  0x8c, 0xb7, 0x44, 0xae, 0xb6, 0x17, 0x43, 0x18, 0x97, 0xb0, 0xd4, 0xc3, 0x50, 0x8b, 0xf1, 0x22,
+  0xa0, 0xc3, 0x49, 0x8c, 0x0f, 0x3b, 0xa7, 0x76, 0x62, 0x37, 0xb2, 0xac, 0xe3, 0xb1, 0x9b, 0x8c,
+  0xa6, 0x8d, 0xfa, 0x96, 0x3d, 0xf7, 0x04, 0x94, 0x7a, 0xb3, 0x93, 0x4c, 0xdd, 0xa0, 0x11, 0xb1,
+  0xc3, 0x23, 0x16, 0x75, 0xfe, 0x19, 0x87, 0x41, 0xa3, 0x29, 0xdf, 0xb9, 0x01, 0x0c, 0x25, 0xdc,
+  0x99, 0x35, 0x3b, 0x23, 0x3c, 0x72, 0xdc, 0x70, 0xb1, 0x1e, 0x74, 0x19, 0x87, 0xbe, 0x8b, 0xb9,
+  0xe7, 0x0d, 0xb7, 0xd9, 0xd4, 0x8f, 0x1c, 0x6e, 0xb1, 0xdb, 0xa9, 0xcb, 0x62, 0x6a, 0xcb, 0xe6,
+  0x8b, 0x78, 0xea, 0xc6, 0xa0, 0xfc, 0xae, 0xa0, 0x90, 0x8d, 0x23, 0x7b, 0xe6, 0xb2, 0x39, 0x94,
+  0xbd, 0xbe, 0xba, 0xb9, 0x61, 0xee, 0x3c, 0x1c, 0x4d, 0xf1, 0x04, 0x89, 0xef, 0x23, 0x5f, 0x50,
+  0x19, 0x58, 0xb4, 0x08, 0x62, 0x41, 0x6e, 0x32, 0xb5, 0x91, 0x6d, 0xcc, 0x09, 0x97, 0x81, 0x4e,
+  0x1f, 0x07, 0x77, 0x8d, 0xf0, 0x1d, 0x85, 0xc2, 0x08, 0xa6, 0xc9, 0x51, 0x90, 0xb1, 0xf3, 0xbb,
+  0xef, 0xd2, 0xe7, 0x4e, 0xe4, 0xda, 0xce, 0x23, 0x92, 0x03, 0x44, 0x1c, 0x1e, 0xb2, 0x5f, 0xdd,
+  0xbb, 0x9b, 0x70, 0xf4, 0xd1, 0x4d, 0x3a, 0x6f, 0xae, 0xcf, 0xae, 0x34, 0x22, 0xd4, 0x5e, 0xa2,
+  0xe4, 0x9a, 0x23, 0xa7, 0xf4, 0x42, 0x2e, 0x44, 0x8a, 0xb9, 0x91, 0x69, 0x44, 0x7a, 0xe4, 0x54,
+  0x53, 0x92, 0xbc, 0x5a, 0x1c, 0xb1, 0x2e, 0xfb, 0x11, 0x38, 0x94, 0xbe, 0x69, 0x64, 0xc2, 0x6a,
+  0xe5, 0x6b, 0x37, 0xd9, 0xbe, 0xa2, 0x65, 0x79, 0xfc, 0x84, 0xf0, 0xb9, 0x8c, 0x54, 0x04, 0x41,
+  0x42, 0x09, 0x9b, 0x47, 0x61, 0x12, 0xc2, 0x58, 0x0b, 0x38, 0x2c, 0xbd, 0x00, 0x78, 0xd8, 0x49,
+  0x83, 0x93, 0xac, 0x08, 0x38, 0x51, 0xe7, 0x59, 0xdb, 0x75, 0xc0, 0xaa, 0xbe, 0x8c, 0xf1, 0x61,
+  0x1f, 0x1f, 0xf6, 0xeb, 0x92, 0x1c, 0x55, 0x3b, 0xdd, 0x65, 0xc6, 0xb9, 0xc6, 0x87, 0x6f, 0x3e,
+  0x49, 0x48, 0x4f, 0x5b, 0x5b, 0xdf, 0x7c, 0xca, 0x77, 0x33, 0x0d, 0xe3, 0xe4, 0x29, 0xd3, 0xd9,
+  0x0f, 0xcd, 0x3c, 0xc4, 0x0e, 0xcc, 0x88, 0xe6, 0x6e, 0x00, 0x80, 0x01, 0x7b, 0x50, 0xad, 0x4f,
+  0xa9, 0x41, 0xaf, 0xe4, 0x31, 0x2b, 0x33, 0x45, 0x60, 0x93, 0xa1, 0x9b, 0x99, 0x1b, 0xc7, 0x10,
+  0x2b, 0x62, 0x4f, 0x74, 0x4e, 0x29, 0xd7, 0x5d, 0x82, 0x37, 0x38, 0x28, 0x0e, 0x47, 0x55, 0xfe,
+  0xc6, 0x7f, 0xdc, 0xbc, 0xb9, 0xea, 0xcc, 0xf1, 0x52, 0x4f, 0xde, 0xb6, 0x83, 0xc7, 0xb6, 0x9b,
+  0x0a, 0x26, 0x4f, 0x8c, 0xcc, 0x03, 0x40, 0x37, 0x35, 0x28, 0xba, 0xa5, 0x28, 0xf5, 0x2b, 0x10,
+  0x1d, 0xf9, 0x61, 0xec, 0x1a, 0x18, 0x52, 0x70, 0x11, 0x29, 0x1b, 0xc6, 0xac, 0xa1, 0xb2, 0xe2,
+  0x90, 0x57, 0x68, 0xe6, 0xb4, 0x37, 0x6b, 0x00, 0xaa, 0x87, 0xc9, 0x7a, 0xe1, 0x22, 0x69, 0x68,
+  0x0a, 0xd4, 0x22, 0x7f, 0xd5, 0xcc, 0x71, 0x31, 0xaf, 0x73, 0x1a, 0x67, 0x9c, 0xbc, 0xce, 0x79,
+  0x0e, 0x22, 0xf8, 0x07, 0x4f, 0x23, 0xe6, 0x19, 0xb5, 0x3c, 0x91, 0xb2, 0x4e, 0xd9, 0x41, 0xf0,
+  0x17, 0x73, 0x5b, 0xe0, 0xcf, 0x3d, 0xff, 0x83, 0xdb, 0x9e, 0xf8, 0x92, 0xff, 0xb9, 0xe7, 0x7f,
+  0x70, 0x47, 0x98, 0x5a, 0x8b, 0xb4, 0x42, 0x78, 0x4e, 0x53, 0xbb, 0xeb, 0xef, 0x53, 0x23, 0x73,
+  0xe2, 0xce, 0x38, 0x8c, 0xce, 0x6c, 0xf0, 0x4b, 0x9e, 0x93, 0xd3, 0x1e, 0x42, 0xc6, 0x45, 0xd5,
+  0x77, 0xc2, 0xd1, 0x62, 0x86, 0x42, 0x9b, 0xb8, 0xc9, 0x99, 0xef, 0xe2, 0xe3, 0x4f, 0x8f, 0xe7,
+  0x0e, 0x34, 0x51, 0x55, 0x69, 0xdc, 0x70, 0x7d, 0x5d, 0x76, 0xe4, 0x97, 0xb9, 0x1b, 0x77, 0xfe,
+  0xf0, 0x9c, 0xf7, 0x07, 0x6a, 0x19, 0xd4, 0xc7, 0x45, 0xa7, 0x70, 0xcc, 0x6b, 0xa0, 0x11, 0x05,
+  0x8b, 0xd9, 0x9d, 0x1b, 0xd5, 0x73, 0x40, 0x78, 0x5d, 0xcf, 0xe9, 0x78, 0x20, 0xd8, 0x85, 0xe3,
+  0xc6, 0x8d, 0x3a, 0xd2, 0xd8, 0x6c, 0x0a, 0xd0, 0xf0, 0xdf, 0x4e, 0x12, 0xbe, 0xf2, 0x1e, 0xc0,
+  0x8d, 0xf5, 0x9a, 0x07, 0xb9, 0xa6, 0x2e, 0x0c, 0x12, 0x85, 0xf6, 0xc8, 0xda, 0x26, 0xfb, 0xef,
+  0xff, 0x66, 0xfa, 0x5b, 0x60, 0xb5, 0x11, 0xea, 0xce, 0x7a, 0x50, 0x51, 0x1c, 0xc6, 0xf6, 0x56,
+  0x93, 0xfd, 0xc0, 0xea, 0x6c, 0x56, 0x2f, 0x07, 0xc3, 0x19, 0x80, 0x62, 0x36, 0x93, 0x55, 0x05,
+  0x60, 0x25, 0x1b, 0x9e, 0x5e, 0x68, 0x4d, 0x3a, 0xb8, 0x52, 0x78, 0xc2, 0x53, 0x5c, 0x79, 0x43,
+  0x83, 0x59, 0xa5, 0x10, 0xe4, 0x15, 0xb1, 0x5b, 0xec, 0xd2, 0x0b, 0xb6, 0x2e, 0xed, 0x07, 0x31,
+  0x30, 0xc6, 0x2f, 0x52, 0xd9, 0x38, 0x1d, 0x9e, 0xb8, 0xcc, 0x5e, 0xb2, 0x3d, 0xdc, 0xf2, 0x69,
+  0x96, 0x6a, 0x4c, 0x9d, 0x57, 0xc4, 0x31, 0x53, 0xc3, 0x41, 0x42, 0x30, 0x50, 0x90, 0xc2, 0x87,
+  0x9e, 0x8f, 0x58, 0x7b, 0x9d, 0x0e, 0xec, 0x87, 0x92, 0x0e, 0xec, 0x07, 0x43, 0x07, 0xa5, 0xa0,
+  0x64, 0x32, 0x9e, 0x01, 0x98, 0x2c, 0xda, 0x08, 0x1c, 0xcf, 0xa2, 0x31, 0x41, 0xe3, 0x25, 0x6b,
+  0x41, 0xc8, 0xd2, 0x52, 0x4a, 0x00, 0x65, 0x15, 0x72, 0x12, 0x24, 0x46, 0x8a, 0x1c, 0x09, 0x90,
+  0x94, 0x55, 0xc9, 0x46, 0x51, 0xcf, 0xd0, 0x87, 0x28, 0x29, 0x93, 0xd4, 0x74, 0xcd, 0x0e, 0xa6,
+  0xa5, 0x1d, 0x4c, 0xab, 0x3b, 0xb8, 0x5f, 0xb3, 0x83, 0xfb, 0xd2, 0x0e, 0xee, 0x0d, 0x1d, 0x68,
+  0x24, 0xf0, 0x84, 0xba, 0x35, 0xb4, 0x59, 0xd4, 0x34, 0x11, 0xc1, 0x4b, 0xca, 0x5d, 0x00, 0xa7,
+  0x65, 0xed, 0x9e, 0xee, 0x4b, 0x7b, 0xba, 0x2f, 0xef, 0x69, 0x95, 0x3e, 0x61, 0x12, 0x9f, 0x01,
+  0x22, 0xbe, 0x66, 0x47, 0x87, 0x14, 0x63, 0x89, 0x5f, 0x00, 0x31, 0xa6, 0x98, 0xa6, 0xdd, 0xae,
+  0xaf, 0xa5, 0xa6, 0x98, 0x74, 0x56, 0xa2, 0xa0, 0x9b, 0xa8, 0x79, 0xb5, 0x8e, 0xaf, 0x84, 0xc4,
+  0xd3, 0xa9, 0x00, 0x88, 0x07, 0x63, 0x74, 0xf4, 0xf3, 0xed, 0xe5, 0x05, 0x81, 0xe0, 0xaf, 0x57,
+  0xe3, 0x91, 0x9c, 0xcf, 0x4d, 0x08, 0x24, 0x14, 0x99, 0x9d, 0xcf, 0x57, 0x02, 0xc0, 0x6d, 0x53,
+  0x93, 0x27, 0x9a, 0xaf, 0xd1, 0x56, 0xec, 0x5d, 0x9a, 0xc4, 0xc3, 0x4b, 0x34, 0x45, 0x12, 0x9b,
+  0x86, 0xec, 0x2b, 0x18, 0x45, 0x16, 0x10, 0x5c, 0x8c, 0x61, 0x96, 0xe6, 0x54, 0xa8, 0x93, 0xa8,
+  0x5f, 0xe0, 0x8c, 0x78, 0x9f, 0x53, 0x26, 0x4a, 0xf6, 0x3e, 0xa9, 0xe7, 0xfc, 0x49, 0x29, 0x70,
+  0xb9, 0x5c, 0x6d, 0xc0, 0x5d, 0x16, 0x1d, 0xac, 0x86, 0x41, 0x6b, 0xc6, 0x46, 0x10, 0x54, 0x52,
+  0x1c, 0x9e, 0xf8, 0x82, 0x20, 0xee, 0x38, 0x30, 0xdb, 0x71, 0x22, 0x08, 0x56, 0xf5, 0x31, 0x4a,
+  0xec, 0x2b, 0x54, 0x70, 0x45, 0xd4, 0x30, 0x74, 0x2a, 0x4a, 0x4a, 0x3b, 0x95, 0x93, 0xef, 0x11,
+  0x2d, 0x45, 0xb3, 0x99, 0x9b, 0x44, 0xde, 0x48, 0xf6, 0xce, 0xc7, 0xcb, 0x33, 0x75, 0xad, 0xba,
+  0x81, 0x74, 0x88, 0x67, 0x8c, 0x43, 0xfe, 0x78, 0xdf, 0x5c, 0x6d, 0xae, 0x22, 0xfb, 0x3e, 0x27,
+  0xb4, 0x4b, 0x3b, 0x99, 0x76, 0xe8, 0x30, 0x2d, 0xba, 0x2e, 0x5e, 0x25, 0x93, 0xda, 0x6a, 0x6b,
+  0xd5, 0xce, 0x04, 0x00, 0x6c, 0x5a, 0x97, 0xe9, 0x64, 0x17, 0x6a, 0x1e, 0xb2, 0x0f, 0x30, 0x3f,
+  0xc1, 0xa4, 0x93, 0x6f, 0x3e, 0xa5, 0x1d, 0x3c, 0x01, 0xec, 0xe6, 0x87, 0x1c, 0x3b, 0x78, 0xc4,
+  0x88, 0xc7, 0x8c, 0x0f, 0xab, 0x8c, 0x4a, 0x9c, 0x4f, 0xac, 0xeb, 0x6e, 0x3d, 0x8d, 0x4e, 0xb3,
+  0x80, 0xaa, 0xd6, 0x3f, 0xad, 0x51, 0x94, 0x66, 0x2e, 0xed, 0x41, 0xa9, 0x1e, 0x2a, 0xe2, 0x39,
+  0x63, 0x8e, 0x7e, 0x76, 0xc2, 0x18, 0x70, 0xa9, 0xe9, 0x67, 0x8c, 0x6b, 0x07, 0xe6, 0x26, 0xe1,
+  0xc3, 0x0d, 0x9d, 0x67, 0xc6, 0x16, 0x74, 0xf1, 0x13, 0xde, 0xb7, 0x54, 0xd2, 0xf4, 0x29, 0x0d,
+  0xdd, 0x9c, 0xec, 0x64, 0xf3, 0x26, 0xc8, 0x88, 0x2b, 0xfa, 0x9f, 0x83, 0x4c, 0xa1, 0xa9, 0x40,
+  0x66, 0xfd, 0xce, 0xc5, 0x9e, 0x4b, 0x06, 0xe0, 0x45, 0x41, 0xa1, 0x71, 0x23, 0x93, 0xcd, 0x42,
+  0x87, 0xaf, 0x3a, 0xb8, 0x6c, 0x1c, 0x85, 0x33, 0x3a, 0xb7, 0x0d, 0x53, 0x17, 0x55, 0x6c, 0x8e,
+  0xd8, 0x11, 0xd5, 0x3d, 0x0f, 0x2e, 0x1a, 0xe4, 0xca, 0xe4, 0x8f, 0x63, 0xba, 0xc6, 0x25, 0xc7,
+  0x2a, 0xad, 0x8c, 0x0c, 0x4e, 0xbe, 0x52, 0xd9, 0x23, 0xe6, 0xf8, 0xa2, 0xe4, 0xdd, 0x79, 0x36,
+  0x21, 0x7b, 0x52, 0xc6, 0xef, 0xaf, 0xd2, 0x35, 0x22, 0xbd, 0x13, 0x44, 0x57, 0x2a, 0x25, 0xbf,
+  0x4b, 0x46, 0xe8, 0x25, 0x47, 0xaf, 0x4c, 0x5f, 0x45, 0xbe, 0x1c, 0x06, 0xf6, 0x7a, 0xec, 0xbd,
+  0xba, 0x05, 0x4f, 0xd0, 0x22, 0x72, 0xc4, 0xbb, 0x03, 0xf3, 0x29, 0x37, 0x6e, 0x38, 0x98, 0xeb,
+  0x75, 0x56, 0x35, 0xdd, 0xaa, 0x63, 0x8d, 0xba, 0x16, 0xda, 0x57, 0x13, 0x25, 0x20, 0x92, 0x30,
+  0xf0, 0xb9, 0x30, 0xb1, 0xe2, 0x15, 0x14, 0x3c, 0xf1, 0x45, 0x6e, 0x8e, 0x41, 0x62, 0xc6, 0xf7,
+  0x00, 0xb2, 0xb8, 0xb4, 0xf2, 0xa9, 0x98, 0xdc, 0x52, 0x5c, 0xc3, 0x33, 0xc2, 0x95, 0xe2, 0xd2,
+  0x97, 0xa1, 0xca, 0xa7, 0xdc, 0x85, 0x99, 0x4c, 0x3a, 0x55, 0xc9, 0x64, 0x2f, 0x16, 0x4f, 0xb8,
+  0xa2, 0x5c, 0xda, 0x30, 0x4e, 0xc6, 0x4d, 0x66, 0x78, 0x09, 0x14, 0xc1, 0x14, 0xb0, 0x85, 0x82,
+  0x09, 0x83, 0x66, 0xc9, 0xc2, 0x15, 0xcf, 0x8a, 0xbc, 0x6f, 0xe2, 0xf5, 0x02, 0xea, 0xaa, 0x9f,
+  0x9b, 0xfc, 0x09, 0xe2, 0xfc, 0x11, 0x8d, 0xe3, 0xb0, 0xfe, 0xc3, 0x7d, 0x7a, 0x91, 0x84, 0xda,
+  0x92, 0x92, 0xf4, 0xa8, 0x69, 0x8a, 0x70, 0x1e, 0x86, 0x5c, 0x6f, 0xf8, 0x51, 0x3e, 0x70, 0x60,
+  0x2f, 0xca, 0xd9, 0x48, 0xcb, 0x27, 0xf0, 0xbb, 0x71, 0xaf, 0x4f, 0xbb, 0xd7, 0x62, 0xa1, 0x72,
+  0x37, 0x8e, 0xb2, 0xf6, 0x35, 0x7f, 0x84, 0xb9, 0x67, 0x0b, 0x77, 0xc4, 0x9a, 0x85, 0xa9, 0xbf,
+  0x90, 0x5d, 0xf9, 0xdc, 0x5f, 0x1d, 0x25, 0xf5, 0xb5, 0x94, 0x80, 0x1f, 0xdc, 0x0b, 0xa3, 0x0e,
+  0x0c, 0x88, 0x73, 0x7e, 0xf9, 0x02, 0x68, 0xa1, 0xe1, 0x75, 0x67, 0x19, 0x79, 0x89, 0x8b, 0x9b,
+  0x23, 0x79, 0x5d, 0xaa, 0xac, 0xdc, 0x40, 0xe5, 0xe3, 0x6b, 0xac, 0x7c, 0x91, 0x27, 0x9e, 0xc2,
+  0xd8, 0x0a, 0xe4, 0xbc, 0x82, 0x61, 0x0c, 0xdd, 0x54, 0x03, 0x49, 0x6a, 0x6a, 0x00, 0xe5, 0xfa,
+  0x6b, 0x14, 0xf1, 0x15, 0x58, 0xa8, 0x2c, 0x56, 0x86, 0x11, 0x1a, 0x67, 0x82, 0xb6, 0x20, 0x55,
+  0xf0, 0xaa, 0xac, 0xa4, 0x55, 0x7e, 0xfa, 0x5c, 0x5c, 0x63, 0x54, 0x5a, 0x21, 0xd3, 0x4a, 0x38,
+  0x8e, 0x45, 0xc7, 0x91, 0x6b, 0xab, 0x6c, 0x1f, 0xc1, 0xef, 0x44, 0x5a, 0x75, 0x83, 0x92, 0x7c,
+  0x6c, 0x78, 0x55, 0x53, 0x3a, 0x95, 0xcd, 0x52, 0x3b, 0xc6, 0x17, 0x86, 0x62, 0x3e, 0x20, 0xc8,
+  0x5b, 0x90, 0x70, 0x38, 0x18, 0x63, 0x90, 0x57, 0x3b, 0x60, 0x65, 0x75, 0xe5, 0x8d, 0xad, 0x38,
+  0x08, 0x29, 0x23, 0x55, 0x8a, 0x1c, 0x5e, 0x8b, 0xd1, 0xc1, 0xfb, 0x1a, 0x03, 0xe7, 0x64, 0xea,
+  0xf9, 0x4e, 0x43, 0xb6, 0x37, 0x61, 0x47, 0xd7, 0xfe, 0x35, 0x4c, 0x25, 0x7c, 0x63, 0x42, 0x2b,
+  0xca, 0xad, 0x25, 0x4a, 0x0e, 0x89, 0x81, 0x78, 0xbc, 0xd0, 0x54, 0xd3, 0x7d, 0x70, 0x47, 0x27,
+  0xe1, 0x6c, 0x66, 0x07, 0x14, 0xcf, 0xcc, 0x1f, 0xeb, 0x39, 0xbf, 0x01, 0x46, 0x92, 0xb5, 0x6c,
+  0x9a, 0x95, 0xc5, 0xb4, 0x14, 0x19, 0x45, 0x4d, 0x7e, 0x2f, 0x38, 0x2d, 0x41, 0xba, 0x18, 0x77,
+  0x36, 0xea, 0xb4, 0x9d, 0x36, 0xb6, 0x3d, 0x1f, 0x67, 0x38, 0x07, 0x8a, 0x4b, 0xd2, 0xd9, 0x12,
+  0xc1, 0x38, 0x75, 0xef, 0x1a, 0xd9, 0x52, 0x70, 0x35, 0x26, 0x7c, 0x0a, 0xda, 0x11, 0x46, 0x1e,
+  0x6e, 0x7b, 0x40, 0x99, 0xd9, 0xf0, 0x72, 0x05, 0x28, 0xb4, 0x93, 0x37, 0xd7, 0xe7, 0x67, 0xa7,
+  0x35, 0xbd, 0x8e, 0x8c, 0x30, 0x70, 0x97, 0x9b, 0xae, 0x6a, 0xa9, 0x0c, 0x91, 0xb2, 0x16, 0xa3,
+  0x95, 0x75, 0x95, 0x55, 0xd1, 0xfc, 0xd2, 0xab, 0x19, 0x41, 0x24, 0xe9, 0xa0, 0x50, 0xc7, 0x88,
+  0x60, 0xad, 0xac, 0xde, 0xc8, 0x50, 0xe3, 0xa9, 0x85, 0x37, 0x2f, 0x76, 0xcb, 0xd8, 0x9d, 0xa6,
+  0xef, 0x15, 0x78, 0x4c, 0x97, 0x3a, 0x1e, 0x56, 0xcf, 0x10, 0x30, 0x8b, 0x4f, 0x55, 0x30, 0xde,
+  0x12, 0x13, 0x0b, 0xaa, 0xc2, 0x5e, 0x9e, 0x44, 0xa8, 0xb6, 0x33, 0xc8, 0x0b, 0x93, 0x09, 0x03,
+  0x7e, 0xdd, 0x06, 0x58, 0x25, 0x56, 0x70, 0xbc, 0xd8, 0x86, 0x99, 0x2e, 0x06, 0x6f, 0x49, 0xb4,
+  0x50, 0xc6, 0x50, 0xc4, 0x54, 0x9b, 0x07, 0xd4, 0x95, 0xc5, 0x41, 0x6d, 0xac, 0x01, 0x98, 0x55,
+  0x7b, 0x54, 0x81, 0x0b, 0x53, 0x90, 0x35, 0x64, 0x55, 0xd3, 0x32, 0x1d, 0x8b, 0xe8, 0x29, 0xdb,
+  0x71, 0xa9, 0x0b, 0x07, 0xd0, 0xe9, 0xfa, 0x72, 0x50, 0xec, 0x44, 0x99, 0x34, 0x78, 0xf7, 0xe5,
+  0x4e, 0xaf, 0x0e, 0xa5, 0xf5, 0x66, 0x31, 0x7c, 0x80, 0xd7, 0x1d, 0xda, 0xaf, 0xbc, 0xc2, 0x0d,
+  0x31, 0xe0, 0x40, 0x7a, 0x77, 0x65, 0xdd, 0x5c, 0x59, 0x65, 0xd7, 0x07, 0x9e, 0xe7, 0xf0, 0xcd,
+  0x27, 0xd0, 0xa3, 0xd8, 0x73, 0x9e, 0xb4, 0xe3, 0xb9, 0x5a, 0xa2, 0x52, 0xe1, 0xde, 0xa9, 0x1a,
+  0xb5, 0x8a, 0xa0, 0xd9, 0x93, 0xf3, 0x93, 0x68, 0xf7, 0xc1, 0xdc, 0xa3, 0xd8, 0x32, 0x37, 0xec,
+  0x45, 0xac, 0x15, 0x4a, 0x22, 0x66, 0x4a, 0x1c, 0xc9, 0x51, 0x3d, 0xd8, 0x0c, 0x06, 0x4e, 0xee,
+  0x00, 0x46, 0xc1, 0xfb, 0xa6, 0xb6, 0x52, 0x7c, 0x45, 0xba, 0xa5, 0xba, 0x75, 0x20, 0x25, 0xd7,
+  0xf2, 0x49, 0xf5, 0x97, 0x65, 0x76, 0x96, 0x26, 0x6f, 0x16, 0xec, 0x2c, 0xae, 0xb4, 0x15, 0x85,
+  0xea, 0xbc, 0x99, 0xcd, 0xab, 0x1a, 0x0a, 0x52, 0x73, 0x0d, 0x29, 0x42, 0x6a, 0xca, 0x7d, 0x4d,
+  0xdb, 0x77, 0x23, 0x18, 0x47, 0x31, 0x0f, 0x16, 0x5e, 0xfd, 0xd7, 0xc2, 0x8b, 0x60, 0x04, 0xdc,
+  0xd8, 0x9a, 0x79, 0x3e, 0xeb, 0x2a, 0x6b, 0x86, 0x08, 0x46, 0xd8, 0x72, 0xce, 0x32, 0x3f, 0x70,
+  0xcb, 0x04, 0x28, 0x7f, 0xa2, 0xce, 0xfe, 0x88, 0x14, 0x1f, 0x7e, 0xf3, 0xc9, 0x0d, 0x46, 0x38,
+  0xb1, 0x79, 0x7b, 0x9e, 0x7e, 0x47, 0xa7, 0x11, 0x37, 0x9f, 0xbe, 0x43, 0xb2, 0xcc, 0xa5, 0xf3,
+  0xe6, 0xd3, 0x87, 0x2c, 0xc8, 0x51, 0x6c, 0xfc, 0x53, 0x4a, 0x27, 0xf4, 0xe1, 0x74, 0x18, 0xcf,
+  0x3b, 0x12, 0xd8, 0xc0, 0xa0, 0x95, 0x6e, 0x2f, 0x46, 0xae, 0x1f, 0xda, 0x10, 0x34, 0x1e, 0xe4,
+  0xa5, 0x88, 0x5b, 0x37, 0x85, 0x79, 0x99, 0x62, 0xe3, 0xa9, 0x94, 0xf3, 0x99, 0xb1, 0x05, 0x59,
+  0x07, 0xee, 0x52, 0x6c, 0x19, 0xb3, 0xaf, 0x74, 0x88, 0x3a, 0xd7, 0xe5, 0x2e, 0xdf, 0x07, 0x25,
+  0xb3, 0x16, 0x0c, 0x4d, 0xb6, 0xfe, 0x91, 0xd5, 0xcf, 0xae, 0x8e, 0x7f, 0xba, 0x38, 0xbf, 0x7a,
+  0x4d, 0x2b, 0x91, 0xa7, 0xe7, 0x37, 0xe2, 0xd7, 0x13, 0x10, 0xf5, 0xa1, 0x59, 0xc2, 0x63, 0x88,
+  0xb4, 0xb1, 0xd3, 0x3f, 0x31, 0x5c, 0xff, 0xd1, 0x0d, 0xc8, 0x5b, 0x1d, 0x6a, 0x60, 0x2d, 0x80,
+  0xd6, 0x2d, 0xe1, 0x63, 0x44, 0x32, 0x6d, 0x34, 0xf3, 0x85, 0x26, 0x6b, 0x2e, 0x70, 0x4b, 0xf6,
+  0xa1, 0x5b, 0x4e, 0xf9, 0x2c, 0x76, 0x63, 0x56, 0x9c, 0x9d, 0x2a, 0x9c, 0x80, 0x1f, 0x4f, 0x1f,
+  0x34, 0xab, 0x7c, 0x61, 0x8e, 0x7c, 0x3f, 0x19, 0xbb, 0x13, 0xc1, 0xcd, 0x2b, 0x8a, 0x6b, 0x40,
+  0xa8, 0x42, 0xae, 0xd9, 0x42, 0xc0, 0x7e, 0xbd, 0xc5, 0x30, 0x20, 0x5a, 0x6d, 0xf7, 0x45, 0x0a,
+  0x8b, 0xf6, 0x4f, 0x33, 0x96, 0x1b, 0xf4, 0xb5, 0x15, 0x66, 0x96, 0x65, 0x53, 0x6f, 0x3c, 0xde,
+  0x8a, 0x44, 0x6f, 0xb5, 0x9d, 0xea, 0x10, 0xaa, 0x56, 0x23, 0x98, 0x82, 0x5d, 0xce, 0xa4, 0xeb,
+  0x6f, 0xae, 0x72, 0x43, 0x8b, 0x52, 0x55, 0x0f, 0x47, 0xea, 0x7a, 0x94, 0x54, 0x5f, 0x2f, 0xcc,
+  0x59, 0xbb, 0x95, 0xba, 0xaa, 0x53, 0x4f, 0x3f, 0x9f, 0x88, 0xf9, 0x87, 0xbb, 0x98, 0xaa, 0xd8,
+  0xb1, 0xd4, 0xb6, 0xc6, 0xa9, 0x4c, 0x05, 0x91, 0xaf, 0x5e, 0x6d, 0x48, 0xa5, 0x32, 0x38, 0xae,
+  0x4b, 0xe8, 0x9a, 0xa4, 0xd5, 0x57, 0xce, 0xad, 0xd2, 0xac, 0x59, 0x85, 0x3e, 0x90, 0xf0, 0x08,
+  0x4f, 0x6e, 0x46, 0xb3, 0x46, 0xed, 0xad, 0x1b, 0x67, 0x89, 0x45, 0x10, 0xa2, 0x82, 0xaf, 0x15,
+  0xc9, 0x2f, 0x30, 0xca, 0x79, 0xa3, 0x98, 0x35, 0xde, 0x1e, 0x5f, 0x36, 0x7f, 0x64, 0xb7, 0x53,
+  0x2f, 0x66, 0x4b, 0xcf, 0xf7, 0x61, 0x58, 0xa0, 0x09, 0x34, 0xa3, 0x3b, 0x40, 0x31, 0xa7, 0x86,
+  0x16, 0xbf, 0x82, 0x70, 0xd9, 0xc9, 0x2f, 0x38, 0xea, 0x91, 0x16, 0xa1, 0xf2, 0x67, 0x64, 0xcf,
+  0xb4, 0x70, 0xcb, 0x30, 0xe4, 0x47, 0x88, 0xd2, 0x29, 0xcf, 0x39, 0x6e, 0x54, 0x0d, 0xac, 0xe5,
+  0x33, 0x77, 0x2d, 0xa5, 0xb7, 0x84, 0xf2, 0xb3, 0xc8, 0x06, 0xa9, 0xe3, 0xdd, 0xbb, 0x38, 0xd2,
+  0x38, 0x2a, 0xcd, 0x44, 0x11, 0xcf, 0x00, 0x9e, 0x81, 0x29, 0x44, 0x8f, 0x3f, 0xae, 0x43, 0x5a,
+  0xcc, 0x3b, 0x5c, 0x45, 0x9e, 0x1c, 0x7a, 0x78, 0x6d, 0x8e, 0x6b, 0x36, 0x08, 0xa1, 0x6f, 0x89,
+  0x5d, 0x97, 0xb9, 0xe3, 0x31, 0x26, 0x06, 0x82, 0x36, 0x64, 0xc9, 0xce, 0x50, 0x44, 0xbc, 0x91,
+  0xf7, 0x32, 0x75, 0x6a, 0xcf, 0xe2, 0x8e, 0xce, 0x5f, 0x15, 0xc5, 0x3f, 0xe4, 0x06, 0x74, 0x4b,
+  0x6e, 0x14, 0xb7, 0xb2, 0x6d, 0xde, 0x56, 0xba, 0x45, 0xdb, 0xca, 0x6f, 0xb5, 0xb6, 0xd2, 0x0d,
+  0xd1, 0x56, 0xba, 0x73, 0xd9, 0x4a, 0xb7, 0x18, 0x5b, 0xe9, 0x46, 0x60, 0x2b, 0xdd, 0xa8, 0x7b,
+  0x9f, 0x75, 0x5a, 0x9a, 0x62, 0xf1, 0xac, 0x3c, 0x0b, 0x35, 0xd9, 0xa2, 0xb0, 0x97, 0x5f, 0x6b,
+  0xb7, 0xd5, 0x89, 0x52, 0xb5, 0x87, 0xd6, 0x77, 0x24, 0xf8, 0xd6, 0x45, 0x5c, 0xf4, 0xd5, 0xd9,
+  0xd5, 0xc1, 0x15, 0xfe, 0x56, 0xcb, 0xc4, 0xaf, 0x37, 0xf5, 0xe5, 0xa0, 0xaf, 0x46, 0xd9, 0x4e,
+  0x87, 0x78, 0xec, 0xf8, 0x6e, 0x30, 0x49, 0xa6, 0x94, 0xf6, 0xd0, 0x6d, 0x16, 0xc7, 0x24, 0xde,
+  0x63, 0xe9, 0x04, 0x27, 0x4b, 0x54, 0x2b, 0xa6, 0x2e, 0x28, 0x9e, 0x1e, 0x83, 0x18, 0xfa, 0xd2,
+  0x30, 0xb4, 0xfe, 0x42, 0x57, 0x89, 0x15, 0x3e, 0x6e, 0x24, 0xce, 0x70, 0x2b, 0xc8, 0x51, 0x8f,
+  0x3f, 0xc8, 0x2e, 0x0d, 0xc7, 0x80, 0xab, 0xce, 0x99, 0x64, 0x89, 0x9c, 0x27, 0x17, 0xe7, 0x67,
+  0x57, 0xb7, 0xe2, 0x4e, 0xa8, 0xba, 0x61, 0x1c, 0x93, 0xac, 0x94, 0xea, 0x25, 0x44, 0xd8, 0x62,
+  0x9e, 0xf3, 0x60, 0x88, 0x4f, 0xb6, 0xb6, 0xd8, 0x89, 0xdc, 0xaa, 0xc0, 0xbb, 0x4b, 0x30, 0xf9,
+  0x9b, 0x41, 0x20, 0x39, 0x61, 0x76, 0xe0, 0xb4, 0x18, 0x40, 0x61, 0x8b, 0xc0, 0x1b, 0xd9, 0x31,
+  0x40, 0xa0, 0x1c, 0xc3, 0x18, 0xf0, 0x44, 0x7f, 0x78, 0xe7, 0xa2, 0x13, 0x3c, 0x3e, 0xf9, 0x87,
+  0xeb, 0x18, 0x96, 0x64, 0x10, 0xc2, 0x8d, 0x0b, 0xcf, 0x94, 0xb6, 0xc4, 0x51, 0xe8, 0xc4, 0xfc,
+  0xc5, 0x8d, 0x17, 0x8c, 0xdc, 0x0b, 0x80, 0x78, 0x0d, 0x95, 0x0e, 0x0c, 0x8d, 0xbd, 0x38, 0x45,
+  0x29, 0x6b, 0x6c, 0xe7, 0x82, 0xc3, 0xfc, 0x59, 0x5f, 0x4a, 0xea, 0xc4, 0x4f, 0x9a, 0x24, 0xfc,
+  0x92, 0xf1, 0x99, 0xc7, 0x7d, 0x3a, 0x6e, 0xea, 0x1a, 0xfa, 0x48, 0x1e, 0x56, 0xa2, 0x77, 0xfb,
+  0xa0, 0xf7, 0x86, 0x7a, 0x93, 0x3c, 0x08, 0x0f, 0xd2, 0x82, 0x47, 0x7e, 0xa5, 0x6d, 0x39, 0x46,
+  0xa8, 0xe5, 0x59, 0x3f, 0x47, 0x87, 0x6c, 0x0f, 0xfe, 0x31, 0xad, 0x8e, 0xa7, 0x50, 0x51, 0x25,
+  0xaf, 0xdc, 0x7b, 0x37, 0x32, 0xcc, 0x55, 0x45, 0x7f, 0xeb, 0x8c, 0xaf, 0xe9, 0x46, 0x94, 0xda,
+  0xff, 0x4b, 0x36, 0xec, 0xae, 0xea, 0x3c, 0xab, 0x4d, 0x7b, 0xfb, 0x55, 0x48, 0xa8, 0x80, 0x2d,
+  0x4c, 0x0a, 0xc8, 0x47, 0x29, 0x10, 0x84, 0x6a, 0xbd, 0xf7, 0x95, 0x4a, 0x72, 0xb7, 0x8a, 0x22,
+  0x55, 0x6d, 0xfb, 0x29, 0x3f, 0xa5, 0x2f, 0x21, 0xa5, 0x3f, 0xec, 0x1a, 0x89, 0xe1, 0xc2, 0x9d,
+  0x79, 0x41, 0x2c, 0x37, 0x41, 0xc7, 0x3e, 0xd8, 0x98, 0xd2, 0x76, 0x0b, 0xd9, 0x70, 0x50, 0xd2,
+  0x10, 0x54, 0x20, 0xd6, 0x68, 0xfb, 0x16, 0x6a, 0x1f, 0x54, 0xb2, 0x8c, 0xfa, 0x02, 0x6e, 0xcd,
+  0x58, 0x1d, 0xfe, 0x10, 0x80, 0x95, 0xbc, 0xcb, 0x91, 0x6c, 0xa4, 0xb8, 0x8c, 0xb6, 0x69, 0xb8,
+  0x88, 0x2a, 0x88, 0x23, 0xc6, 0x1c, 0xac, 0xcd, 0x97, 0x86, 0x4a, 0x2a, 0x67, 0x6a, 0x09, 0x83,
+  0x54, 0x9a, 0x39, 0x0e, 0x40, 0xe6, 0x94, 0x88, 0x4e, 0x59, 0xf0, 0x19, 0x44, 0xaf, 0x63, 0xd7,
+  0xe4, 0x96, 0x60, 0x18, 0x87, 0xbf, 0xc0, 0xa0, 0x82, 0x61, 0xa3, 0x7d, 0x62, 0x95, 0xd4, 0x42,
+  0xf1, 0xc7, 0x3a, 0x36, 0xaa, 0x3a, 0xab, 0x0a, 0x2b, 0x55, 0x60, 0x57, 0xd9, 0x69, 0xda, 0xeb,
+  0x86, 0x96, 0xaa, 0x62, 0x51, 0x66, 0xab, 0x3a, 0x0a, 0x6a, 0x8b, 0x12, 0x9d, 0x53, 0x91, 0xd1,
+  0x3b, 0x28, 0xb5, 0x59, 0xbd, 0xda, 0x67, 0x5b, 0x6d, 0x0e, 0xdc, 0x86, 0x76, 0xab, 0xb6, 0x5e,
+  0xc7, 0x72, 0xd5, 0xfa, 0x66, 0xdb, 0xd5, 0x59, 0xb8, 0xbe, 0xf5, 0x1a, 0xc4, 0xfa, 0xa5, 0xec,
+  0x57, 0x27, 0x72, 0x53, 0x0b, 0xd6, 0x49, 0xae, 0xb4, 0x61, 0x9d, 0xf6, 0x0d, 0xac, 0x78, 0x7d,
+  0xe2, 0x2b, 0xed, 0xf8, 0xd4, 0xf5, 0x61, 0x0c, 0x8f, 0x1e, 0x19, 0x5d, 0x9d, 0xc3, 0xe7, 0x1b,
+  0x89, 0x38, 0xd5, 0xc0, 0x46, 0x62, 0x2f, 0xac, 0x60, 0xd3, 0x8e, 0x68, 0xa5, 0xd8, 0x5e, 0xbb,
+  0x5d, 0x6f, 0xa5, 0xef, 0xd7, 0x36, 0x36, 0x54, 0x47, 0x31, 0xd6, 0x27, 0x0f, 0xc7, 0x09, 0x9e,
+  0xe5, 0xc4, 0x10, 0xe3, 0x88, 0x55, 0xa8, 0xe4, 0x7c, 0x94, 0xe8, 0xe9, 0x34, 0x56, 0xb7, 0xcb,
+  0xbe, 0x67, 0x29, 0x18, 0x41, 0x12, 0x80, 0xd9, 0x62, 0x45, 0xd8, 0xa6, 0xf5, 0xe9, 0x02, 0x35,
+  0xd8, 0x05, 0xf0, 0xfd, 0x5b, 0x80, 0x80, 0x72, 0xc8, 0x50, 0xbc, 0x80, 0x70, 0x3c, 0x18, 0x3d,
+  0xbe, 0x43, 0xad, 0xc0, 0x8b, 0x55, 0x9a, 0xb9, 0x0c, 0xac, 0x99, 0x49, 0x4f, 0xf3, 0x5c, 0x41,
+  0xe8, 0xe8, 0xd4, 0x06, 0x65, 0xe6, 0xce, 0xcb, 0x77, 0x9e, 0x67, 0xe7, 0x2f, 0xf2, 0x22, 0x7e,
+  0x4b, 0x73, 0xf4, 0x24, 0xf2, 0xe6, 0x2d, 0x21, 0x5f, 0x70, 0xd3, 0x30, 0xc7, 0x9c, 0xcd, 0x81,
+  0x45, 0x73, 0x3c, 0x88, 0xce, 0x1a, 0xf7, 0x3d, 0x0a, 0x34, 0x11, 0xcd, 0xb8, 0x59, 0x10, 0x77,
+  0x94, 0x24, 0x79, 0x49, 0xc3, 0xab, 0xe7, 0x08, 0x19, 0x9a, 0xe1, 0x06, 0x73, 0xf6, 0xab, 0x13,
+  0x03, 0x1e, 0x3e, 0x84, 0xb0, 0xd5, 0x22, 0x07, 0x5e, 0x1d, 0xaa, 0xad, 0xe0, 0x45, 0x2a, 0x83,
+  0x22, 0xc3, 0x35, 0x7c, 0x95, 0xae, 0x3b, 0x33, 0xd7, 0x0e, 0x4a, 0x65, 0x27, 0x84, 0x0d, 0xa0,
+  0xd3, 0x82, 0x6e, 0xb9, 0x50, 0x15, 0x06, 0x20, 0x76, 0x2f, 0x0f, 0x59, 0xaf, 0xd4, 0x7d, 0xf3,
+  0x72, 0x54, 0xd3, 0x2f, 0x22, 0x50, 0x11, 0x8a, 0x67, 0x67, 0x83, 0x98, 0x17, 0x38, 0x30, 0x21,
+  0x80, 0x79, 0xbc, 0x69, 0x2b, 0x96, 0xaa, 0x48, 0x5c, 0xd5, 0x40, 0xde, 0x88, 0x6d, 0xa5, 0x2f,
+  0x51, 0x21, 0xe2, 0xf6, 0x7e, 0x11, 0xe0, 0xc9, 0x9b, 0xab, 0xab, 0xb3, 0x93, 0xdb, 0x6c, 0xc5,
+  0x33, 0x7b, 0x51, 0x31, 0xe4, 0xeb, 0x33, 0x31, 0x39, 0xf9, 0xfb, 0x32, 0xdf, 0xfe, 0xcd, 0x4d,
+  0xde, 0x76, 0xf3, 0xb3, 0x40, 0xb5, 0xff, 0x0f, 0xc6, 0xc3, 0xe6, 0x9f, 0xf1, 0x11, 0xb4, 0x5c,
+  0xe7, 0xfc, 0x04, 0xf6, 0x87, 0xb2, 0xce, 0xd5, 0x3d, 0xad, 0xe7, 0x7c, 0x9b, 0x67, 0xb7, 0xfc,
+  0x03, 0xc2, 0xb8, 0x17, 0x26, 0x0c, 0x61, 0x66, 0x8f, 0x9e, 0xcc, 0xbb, 0x61, 0x15, 0x98, 0xe4,
+  0x3e, 0x52, 0x6c, 0xf8, 0xa4, 0xb4, 0x22, 0xad, 0x6f, 0x3e, 0x29, 0x4a, 0xf7, 0xd4, 0xeb, 0xa6,
+  0x38, 0xe9, 0x05, 0x05, 0x79, 0xf5, 0xcd, 0x1f, 0xbc, 0x42, 0xdc, 0x33, 0x9d, 0x5b, 0x81, 0x7b,
+  0xbd, 0x30, 0x0f, 0x5f, 0x57, 0xc0, 0xd9, 0x17, 0x64, 0x8a, 0x9f, 0x84, 0x5a, 0x57, 0x68, 0xf2,
+  0x90, 0x6c, 0xca, 0x9f, 0x7e, 0xfa, 0xe9, 0xa9, 0x35, 0x3e, 0x0c, 0x93, 0x72, 0x49, 0x84, 0xe8,
+  0x25, 0x1c, 0x32, 0x5e, 0xd0, 0x8c, 0xd3, 0x63, 0x76, 0xfb, 0x1b, 0x6f, 0x2d, 0xbc, 0xdf, 0x66,
+  0x62, 0xfe, 0x42, 0xb8, 0xa7, 0x81, 0xc9, 0xc6, 0xd8, 0xbf, 0xfd, 0x4d, 0xb6, 0xff, 0x77, 0xe2,
+  0xaf, 0x8d, 0xd6, 0x9b, 0xd0, 0x70, 0x7c, 0xf2, 0x0f, 0xb5, 0xfd, 0xbf, 0x93, 0x06, 0x39, 0x38,
+  0x6d, 0x80, 0x3e, 0xa3, 0xeb, 0x07, 0x0e, 0x6b, 0x38, 0x44, 0xc2, 0x48, 0x08, 0x63, 0x56, 0x8b,
+  0xfd, 0xd3, 0xc3, 0x8f, 0x24, 0xb2, 0xd4, 0x73, 0xe0, 0xe8, 0xfd, 0xa3, 0x36, 0xa0, 0xf2, 0x1a,
+  0xe6, 0x21, 0x95, 0x9f, 0x42, 0x78, 0x9a, 0xc5, 0xb5, 0xa3, 0xb7, 0xb7, 0xb7, 0x02, 0xad, 0xf5,
+  0xb8, 0x52, 0x6d, 0xc4, 0xc5, 0xd2, 0x27, 0xd3, 0xf6, 0x51, 0x79, 0x75, 0xf3, 0xba, 0x25, 0xd6,
+  0x2f, 0x3b, 0x07, 0x98, 0x5e, 0x0d, 0x51, 0xb2, 0x84, 0x7f, 0x1c, 0xb9, 0xec, 0x31, 0x5c, 0xb0,
+  0x78, 0x21, 0x1e, 0x96, 0x76, 0x90, 0xf0, 0x65, 0x72, 0xbe, 0x96, 0x8e, 0x21, 0x35, 0x5d, 0x26,
+  0xb1, 0x62, 0x01, 0x9f, 0xd7, 0x5f, 0xb1, 0x72, 0x2f, 0x17, 0xee, 0xf9, 0x75, 0x42, 0x5e, 0x2c,
+  0x7a, 0xe1, 0xdb, 0xc6, 0xec, 0x1a, 0x17, 0xf3, 0xc5, 0x06, 0x09, 0x6e, 0x1a, 0x43, 0x74, 0x80,
+  0x53, 0x4b, 0xb1, 0x96, 0x56, 0x58, 0xaa, 0x37, 0x26, 0x04, 0x15, 0xf6, 0x9d, 0xe9, 0xd2, 0x8c,
+  0xc2, 0x2c, 0xe8, 0xa9, 0x2c, 0xa5, 0x6e, 0x8d, 0xa4, 0x5b, 0xd0, 0xf0, 0x33, 0x3c, 0x61, 0x8a,
+  0x69, 0x3a, 0x2e, 0x48, 0xa1, 0x51, 0xa7, 0xd4, 0x07, 0x18, 0xde, 0x38, 0x0a, 0xea, 0x11, 0x72,
+  0x4c, 0xa9, 0x11, 0x5d, 0x3d, 0x0b, 0xf2, 0x9d, 0xbf, 0x88, 0x8c, 0x80, 0x69, 0xa3, 0x5c, 0x40,
+  0xd6, 0xce, 0xd8, 0x96, 0x9d, 0x59, 0x56, 0x8e, 0x8d, 0xaa, 0xe7, 0xce, 0xf9, 0x9b, 0xdc, 0x19,
+  0xe5, 0xec, 0x68, 0xfb, 0xe1, 0xda, 0xff, 0xc8, 0x16, 0x3f, 0x9f, 0xbf, 0xfe, 0x99, 0xbd, 0x3a,
+  0x3f, 0x3d, 0xbb, 0x38, 0xbf, 0xfd, 0x9d, 0xfd, 0x02, 0x11, 0xd4, 0x9b, 0xb7, 0xec, 0xf2, 0xf8,
+  0x9a, 0x9d, 0x5d, 0xbd, 0x3e, 0xbf, 0x3a, 0x7b, 0x26, 0x60, 0xb1, 0x51, 0xc0, 0xef, 0x76, 0xab,
+  0xd8, 0x25, 0x48, 0xaf, 0x7c, 0xab, 0x67, 0x94, 0x61, 0xc3, 0xe4, 0x01, 0xc3, 0x70, 0x2a, 0xc1,
+  0x36, 0xb4, 0x9f, 0xf1, 0x90, 0x34, 0xea, 0x3d, 0x47, 0x56, 0xc4, 0xe9, 0x02, 0xb4, 0xfe, 0x15,
+  0x2f, 0x6a, 0x69, 0xe1, 0xd3, 0xcf, 0x34, 0x92, 0x1f, 0x64, 0xbb, 0x3f, 0x80, 0xf5, 0x2f, 0x9e,
+  0xbb, 0x9c, 0x87, 0x51, 0x42, 0x97, 0xe6, 0xb8, 0xd9, 0xa5, 0x02, 0xf6, 0xec, 0x37, 0x80, 0xdf,
+  0x6d, 0xe1, 0xd3, 0xef, 0xf8, 0x94, 0xc1, 0xfc, 0x2b, 0x0c, 0xf1, 0x88, 0x83, 0xd5, 0xe9, 0x16,
+  0x2e, 0x21, 0x80, 0x39, 0x99, 0x68, 0x25, 0x7e, 0x53, 0xce, 0x64, 0x37, 0xe3, 0xfe, 0xa9, 0x9b,
+  0xf0, 0xdd, 0xf2, 0x13, 0x5c, 0xdb, 0xf7, 0x02, 0x3c, 0x14, 0xc9, 0x1a, 0x37, 0x1e, 0x4c, 0x3c,
+  0xbc, 0xb1, 0x07, 0xef, 0x7f, 0x0d, 0x23, 0xdf, 0x61, 0xd6, 0xbe, 0x65, 0x75, 0x67, 0x4d, 0x85,
+  0xde, 0x25, 0xbe, 0x7f, 0xed, 0x86, 0x78, 0xcc, 0xf7, 0x45, 0x16, 0x7f, 0x5f, 0x01, 0xea, 0x53,
+  0x76, 0x3c, 0x73, 0x23, 0x08, 0xba, 0xe5, 0xfb, 0x3f, 0xfe, 0x68, 0x5b, 0xc3, 0xbd, 0xd6, 0x70,
+  0xf0, 0xbe, 0x85, 0x4f, 0x83, 0xd6, 0x70, 0x8f, 0x9e, 0x06, 0xc3, 0xd6, 0x8e, 0x45, 0x4f, 0xdb,
+  0xdd, 0xd6, 0x4e, 0x97, 0x9e, 0x7a, 0xc3, 0xf4, 0x69, 0xbb, 0xb5, 0xd3, 0xa7, 0x27, 0x6b, 0xb7,
+  0xb5, 0x33, 0xa4, 0xa7, 0xee, 0x8e, 0x78, 0x02, 0x17, 0xbc, 0x43, 0xe0, 0x76, 0x7b, 0xad, 0x9d,
+  0x6d, 0x7a, 0xd8, 0x6e, 0x0d, 0x77, 0xf1, 0x61, 0x67, 0xb7, 0x35, 0xa4, 0x76, 0xd8, 0x11, 0x81,
+  0x1a, 0xf6, 0x5a, 0x03, 0xaa, 0x03, 0xc3, 0xc1, 0xa0, 0x47, 0x0f, 0x7b, 0xad, 0x6d, 0xaa, 0x3c,
+  0x1c, 0xb6, 0xb6, 0x09, 0xce, 0x70, 0xbb, 0xb5, 0x4d, 0x75, 0x76, 0xba, 0xad, 0x6d, 0xaa, 0xb3,
+  0x33, 0x6c, 0xf5, 0x79, 0x17, 0x16, 0x0c, 0x24, 0xa2, 0x2f, 0xde, 0xc3, 0x5e, 0x8b, 0x08, 0xd8,
+  0xd9, 0x49, 0x7f, 0xef, 0xa8, 0xe5, 0xbb, 0x83, 0x96, 0x45, 0x18, 0xec, 0xee, 0xb6, 0x2c, 0x8e,
+  0xee, 0x76, 0xcb, 0xa2, 0xa2, 0xbd, 0x9d, 0x56, 0xaf, 0x27, 0x1f, 0x04, 0x4d, 0x03, 0xf1, 0xca,
+  0xea, 0xee, 0xb5, 0x7a, 0xdb, 0x9c, 0xe2, 0x41, 0xab, 0xcf, 0x39, 0xd3, 0xeb, 0xb5, 0xfa, 0xfc,
+  0x5d, 0xaf, 0xdf, 0xea, 0xef, 0x4a, 0x1e, 0x6d, 0xf7, 0x25, 0x8f, 0xb6, 0xc5, 0xbb, 0xdd, 0xd6,
+  0x36, 0xe7, 0x6a, 0xbf, 0xdb, 0x1a, 0x70, 0x4e, 0xf7, 0x87, 0xad, 0xc1, 0x0e, 0xe7, 0x6f, 0x4f,
+  0xb0, 0xc2, 0x1a, 0x00, 0x2f, 0x78, 0xbd, 0xa1, 0xd5, 0x1a, 0xf0, 0xb6, 0xc0, 0x04, 0x51, 0x3a,
+  0xdc, 0x45, 0x29, 0xbd, 0x6f, 0x29, 0x12, 0xbd, 0x01, 0xcf, 0x67, 0x92, 0x68, 0x4a, 0x3c, 0x10,
+  0x4b, 0xa8, 0xee, 0xf4, 0x5a, 0x16, 0xd1, 0x01, 0x80, 0x2d, 0x02, 0x37, 0xd8, 0x69, 0x11, 0x89,
+  0xd8, 0x27, 0xfd, 0xed, 0xb6, 0xa8, 0x26, 0x48, 0xbb, 0x4d, 0xf8, 0xf7, 0x77, 0x5a, 0x6d, 0xaa,
+  0xd1, 0x1f, 0xb4, 0xda, 0x84, 0x55, 0x7f, 0xaf, 0xd5, 0xe6, 0xbc, 0xa3, 0x27, 0xea, 0x61, 0xdb,
+  0x6a, 0xb5, 0x7b, 0xbc, 0xe1, 0x2e, 0x3c, 0x0d, 0x04, 0xc8, 0x76, 0xbf, 0x9b, 0x3e, 0x6d, 0x8b,
+  0xee, 0x00, 0xa2, 0x10, 0x38, 0xb4, 0x97, 0x4f, 0xdb, 0x96, 0x90, 0x74, 0x9b, 0x4b, 0x98, 0x9e,
+  0xb8, 0xf4, 0xa1, 0x0f, 0xae, 0x10, 0x43, 0x68, 0xcb, 0xb9, 0xb6, 0xb3, 0x0d, 0x4f, 0x7d, 0x41,
+  0x99, 0xa8, 0xb7, 0xd3, 0x87, 0xa7, 0xbe, 0x2c, 0xe5, 0x7d, 0xec, 0xa4, 0x18, 0x80, 0xc6, 0xb4,
+  0xb9, 0x04, 0xf1, 0x9d, 0xb5, 0x23, 0x54, 0x43, 0xd0, 0x01, 0xda, 0xd3, 0xe6, 0xda, 0x23, 0xa8,
+  0x27, 0xc6, 0x69, 0x2c, 0x3e, 0x5b, 0x44, 0xe1, 0xdc, 0x85, 0x38, 0xe1, 0x38, 0xf6, 0x54, 0x16,
+  0xef, 0xb5, 0x38, 0x11, 0x7b, 0x42, 0xdc, 0x03, 0x21, 0xec, 0x1e, 0x17, 0x35, 0xc8, 0x0f, 0xfb,
+  0xdf, 0xe6, 0x3a, 0xbd, 0xcb, 0xa5, 0xbe, 0xcb, 0x85, 0x6a, 0x59, 0x5c, 0xf4, 0x56, 0x9f, 0xbf,
+  0x06, 0x85, 0x1a, 0x20, 0xa7, 0x7b, 0x42, 0x39, 0x40, 0xad, 0xa8, 0x1e, 0x28, 0xd5, 0x90, 0xde,
+  0x5b, 0xdc, 0x28, 0x7b, 0x7b, 0xdc, 0x24, 0x41, 0x44, 0x64, 0x4d, 0xdb, 0xc2, 0xaa, 0x80, 0xf3,
+  0x54, 0x3e, 0x10, 0x7f, 0x87, 0x5d, 0x6e, 0x88, 0xc0, 0xb7, 0x1d, 0xec, 0x07, 0x14, 0x87, 0x8c,
+  0x15, 0x38, 0xc5, 0xff, 0xf6, 0xb8, 0x19, 0x03, 0xd1, 0x3b, 0x84, 0xdd, 0x90, 0x9b, 0xe9, 0xde,
+  0x90, 0xb7, 0xb3, 0xba, 0x43, 0xde, 0xd0, 0xb2, 0x44, 0x0b, 0x0b, 0x50, 0x10, 0x0f, 0x43, 0xde,
+  0xc6, 0x02, 0xad, 0x20, 0x64, 0x2c, 0xe8, 0x9d, 0xa0, 0xa1, 0xce, 0x52, 0xf7, 0x16, 0xf0, 0x5c,
+  0x3c, 0xec, 0x71, 0x02, 0xac, 0x1d, 0x8b, 0x2b, 0x31, 0xe9, 0x35, 0x15, 0x81, 0x7b, 0xe1, 0xbc,
+  0x00, 0xbd, 0xe3, 0x6f, 0x40, 0x93, 0xc8, 0x11, 0xa0, 0xbf, 0x19, 0x10, 0xe4, 0xbe, 0xb0, 0x7f,
+  0xab, 0x6f, 0x71, 0xb3, 0xb7, 0x80, 0x03, 0xa4, 0x30, 0xf8, 0x40, 0xf6, 0x6f, 0xf5, 0xc0, 0x18,
+  0x39, 0x62, 0x60, 0x8b, 0x5d, 0xf1, 0x40, 0xc6, 0x6b, 0x59, 0x7b, 0xdc, 0x35, 0x58, 0x16, 0x98,
+  0x73, 0x5f, 0x90, 0x43, 0xba, 0x40, 0xc6, 0x4c, 0x95, 0xc1, 0xbe, 0x2d, 0xfe, 0x00, 0x06, 0x8c,
+  0x2c, 0xd8, 0x25, 0xc3, 0x01, 0x07, 0x40, 0xbe, 0x61, 0xcf, 0xe2, 0x0d, 0xc0, 0x57, 0xd0, 0x5f,
+  0xe1, 0x5c, 0x84, 0x79, 0x01, 0x1f, 0x09, 0x0a, 0xf0, 0x97, 0xe0, 0x83, 0x9b, 0xa2, 0x0e, 0x87,
+  0xc2, 0x27, 0x01, 0x8d, 0x84, 0xc9, 0xa0, 0xcf, 0x5d, 0xc7, 0xa0, 0xcb, 0x51, 0x04, 0x8e, 0xd1,
+  0x5f, 0xa0, 0xaf, 0x8f, 0xe5, 0x7d, 0x41, 0x43, 0x5f, 0x38, 0x96, 0x9e, 0x70, 0x6e, 0xe8, 0x36,
+  0x2c, 0xae, 0x07, 0xdb, 0x5d, 0xae, 0x1f, 0x9c, 0x0d, 0x03, 0xfe, 0x1b, 0x5c, 0x6f, 0xfa, 0x9b,
+  0x08, 0xed, 0x72, 0x37, 0x39, 0x10, 0x2a, 0x09, 0x1c, 0xe1, 0x16, 0xc7, 0xbb, 0xe1, 0x2a, 0xab,
+  0x29, 0xf7, 0xf1, 0x38, 0x3f, 0x14, 0x00, 0xe1, 0xdc, 0x3f, 0x01, 0xcf, 0xb8, 0x93, 0x03, 0xe4,
+  0xb9, 0x9f, 0x12, 0xd8, 0x4b, 0x70, 0x5d, 0xfe, 0x67, 0xc0, 0x3b, 0xc1, 0xd2, 0x6d, 0xae, 0xdb,
+  0xf4, 0x1b, 0x1d, 0x22, 0xe2, 0x86, 0x5f, 0x97, 0x46, 0x38, 0x7d, 0xe0, 0x0d, 0xf2, 0xac, 0x2f,
+  0xc4, 0x84, 0xbf, 0x89, 0x76, 0x21, 0x1b, 0x90, 0x3e, 0x71, 0x7c, 0xbb, 0xcf, 0x1d, 0xd5, 0xc0,
+  0xe2, 0x7f, 0xb7, 0xf7, 0xb8, 0x80, 0xa0, 0x5c, 0xfc, 0x69, 0xf3, 0xdf, 0x60, 0xd7, 0x84, 0x29,
+  0x7a, 0x27, 0xe2, 0x6e, 0x1f, 0xfc, 0x00, 0x81, 0x04, 0xdd, 0x68, 0x53, 0xdf, 0xd6, 0x9e, 0xf0,
+  0x3e, 0x16, 0xba, 0x26, 0xae, 0x76, 0xf0, 0xc0, 0xd5, 0x05, 0x9a, 0x0f, 0xc5, 0x03, 0x49, 0x1c,
+  0x0a, 0xe8, 0x0f, 0xf7, 0x56, 0xdc, 0x27, 0x02, 0x31, 0x7c, 0x18, 0xd8, 0x6e, 0x09, 0xb7, 0x2c,
+  0xc6, 0x0e, 0xce, 0x26, 0x9d, 0x95, 0x8b, 0x38, 0x89, 0x60, 0x6e, 0xa2, 0x70, 0xd3, 0x82, 0x76,
+  0xdc, 0xf9, 0xa0, 0xe6, 0xb5, 0x85, 0x32, 0x0e, 0x84, 0x6b, 0xe2, 0x4f, 0x9c, 0x67, 0x80, 0x9f,
+  0x50, 0x67, 0x4b, 0xbe, 0xeb, 0xa1, 0x33, 0xe3, 0xa8, 0xee, 0x4a, 0x7a, 0xfa, 0x58, 0x2a, 0x4d,
+  0x43, 0xd4, 0xeb, 0xa7, 0x6d, 0xb7, 0xb1, 0x05, 0xd9, 0xd4, 0xf6, 0x8e, 0x70, 0xb1, 0x68, 0x5d,
+  0xdc, 0x25, 0xf2, 0x27, 0xee, 0x6d, 0xfa, 0x12, 0x1e, 0x3e, 0xf5, 0x76, 0xd3, 0xa7, 0x81, 0xac,
+  0xc7, 0x59, 0xb4, 0x0d, 0x7d, 0x58, 0x7b, 0x12, 0xb2, 0xc5, 0x6d, 0x13, 0xf9, 0x96, 0x62, 0x60,
+  0x71, 0xac, 0xfa, 0xb2, 0xb4, 0xdf, 0x15, 0x8e, 0x15, 0xed, 0x93, 0x8b, 0x87, 0xe8, 0x20, 0xb7,
+  0x8b, 0x86, 0xc9, 0x07, 0x0d, 0xc9, 0x17, 0x9d, 0x7f, 0x30, 0xb5, 0x89, 0x60, 0xda, 0xa2, 0xa9,
+  0x23, 0x78, 0xb2, 0x36, 0x8f, 0x17, 0x70, 0xfc, 0xe0, 0x11, 0x07, 0x68, 0x16, 0x7f, 0x82, 0x32,
+  0x72, 0x3c, 0x88, 0xf1, 0x70, 0x87, 0xdb, 0x63, 0x9b, 0x1c, 0xe2, 0x1e, 0x3e, 0x0c, 0x24, 0x77,
+  0xf8, 0x13, 0x0e, 0x36, 0xdc, 0x4f, 0x81, 0x33, 0x6a, 0x73, 0x1f, 0xb6, 0x8b, 0x20, 0xb8, 0x84,
+  0x71, 0x9c, 0xd8, 0xd9, 0x91, 0xf1, 0x4e, 0x9b, 0x87, 0x2d, 0x78, 0xdf, 0x1e, 0xaf, 0x4a, 0xe3,
+  0x08, 0x7f, 0x12, 0x38, 0xf1, 0xfc, 0x9b, 0xf7, 0x7a, 0x80, 0x78, 0x1e, 0xfb, 0x36, 0x6e, 0x9e,
+  0x7c, 0x27, 0x62, 0xb7, 0xf8, 0x85, 0x9a, 0x8a, 0x80, 0x65, 0xc5, 0xa8, 0xec, 0x75, 0xe4, 0xba,
+  0x01, 0x16, 0x29, 0x74, 0x03, 0x49, 0x7c, 0xd0, 0xdf, 0x96, 0x0f, 0xc0, 0x5a, 0x1e, 0xa2, 0xf5,
+  0x64, 0x34, 0x06, 0x0f, 0xbb, 0x5d, 0x31, 0x72, 0xef, 0x4a, 0x1c, 0x77, 0x76, 0x05, 0x8a, 0x3b,
+  0xb2, 0x08, 0x9a, 0x6b, 0x7c, 0xbe, 0xb4, 0x1d, 0x7b, 0x62, 0xc7, 0x23, 0x3b, 0xca, 0xfa, 0x23,
+  0xf9, 0xf6, 0x04, 0x2b, 0xd3, 0x07, 0xd2, 0x87, 0x6d, 0xa9, 0x18, 0xa2, 0x8e, 0x06, 0xeb, 0xdd,
+  0x3f, 0x54, 0x9c, 0xf9, 0x88, 0xd7, 0xe3, 0xce, 0xbb, 0x2b, 0xe2, 0x17, 0xe1, 0xe6, 0xdb, 0x62,
+  0x04, 0xe4, 0xb5, 0x34, 0x20, 0xff, 0x61, 0xc3, 0x84, 0x5a, 0x31, 0x1a, 0xf4, 0x18, 0x7d, 0x31,
+  0xc2, 0xf0, 0x07, 0x60, 0x82, 0xd0, 0xf0, 0x9e, 0x70, 0x7c, 0xf0, 0x66, 0x5b, 0xca, 0x97, 0xbf,
+  0xe1, 0xad, 0x34, 0xc0, 0xe7, 0x81, 0x13, 0x06, 0x2e, 0x8c, 0xda, 0x30, 0x78, 0xdf, 0x9c, 0xd1,
+  0xf8, 0x9d, 0x0a, 0x48, 0x8d, 0xa2, 0x7f, 0xf2, 0xc3, 0xbb, 0x66, 0x86, 0xc0, 0x1e, 0x37, 0x7e,
+  0x1c, 0x1a, 0xb8, 0x02, 0x77, 0x79, 0x8c, 0x00, 0x41, 0x36, 0x77, 0x15, 0xa4, 0x15, 0xf8, 0x86,
+  0x6a, 0x66, 0x5d, 0xfe, 0x41, 0x6d, 0xda, 0x43, 0x69, 0xdb, 0xe9, 0xc3, 0xae, 0x00, 0x97, 0x3d,
+  0x0c, 0x75, 0x4c, 0xaf, 0xdc, 0x25, 0xfb, 0xbf, 0xae, 0xad, 0x2b, 0x81, 0x45, 0xa1, 0xd0, 0x50,
+  0x0c, 0xa8, 0xf2, 0x09, 0xa4, 0xc0, 0x09, 0xde, 0x49, 0xed, 0x9e, 0x82, 0x1d, 0xae, 0xe3, 0xbc,
+  0x85, 0xce, 0x85, 0x91, 0x9b, 0x53, 0x2e, 0xb0, 0x48, 0x6e, 0x53, 0xe0, 0x94, 0xb2, 0x07, 0x32,
+  0x03, 0x2c, 0x4a, 0x1f, 0x14, 0x1d, 0x2f, 0xa4, 0xbf, 0x79, 0x7f, 0xe1, 0x49, 0x47, 0x43, 0xe2,
+  0xed, 0x3c, 0x9b, 0x68, 0xcd, 0x6d, 0x9c, 0xd5, 0x88, 0xf9, 0x59, 0x36, 0xdf, 0x96, 0xb3, 0x2c,
+  0xdc, 0x80, 0xe8, 0xf0, 0x25, 0x19, 0xfa, 0xad, 0xd5, 0xe0, 0xb3, 0x2f, 0xa5, 0x8a, 0x3a, 0x1d,
+  0xa3, 0xde, 0x78, 0x1f, 0x4b, 0x01, 0x49, 0x02, 0x2d, 0x54, 0x98, 0x4a, 0x40, 0xb9, 0x29, 0x1d,
+  0x4d, 0xc9, 0x23, 0x7b, 0x49, 0x54, 0xa8, 0x27, 0x18, 0xc5, 0x69, 0xce, 0xe2, 0x5c, 0x9c, 0x53,
+  0x8d, 0x5b, 0x48, 0x92, 0xfc, 0xe6, 0x81, 0x21, 0x37, 0xd0, 0x0f, 0x83, 0xdb, 0xf0, 0xb7, 0x06,
+  0x9e, 0xfb, 0x64, 0x9f, 0xe4, 0xa1, 0x00, 0xfc, 0xc9, 0x7e, 0x60, 0xe0, 0x70, 0x9a, 0xec, 0x7b,
+  0xfc, 0xe8, 0xb4, 0x60, 0x01, 0x6d, 0xd1, 0x16, 0x0f, 0x78, 0xfa, 0x76, 0x72, 0x1b, 0xfe, 0xde,
+  0x80, 0x3f, 0x2a, 0x8c, 0xbd, 0x2e, 0x6b, 0x33, 0x7a, 0xc7, 0x41, 0x08, 0x1e, 0x6d, 0x11, 0xd8,
+  0x83, 0xc2, 0xe2, 0x4f, 0x4a, 0x9d, 0xbe, 0xf4, 0xf3, 0x95, 0xec, 0xbc, 0x59, 0x48, 0x70, 0xcb,
+  0x78, 0x97, 0x3c, 0x74, 0xc6, 0x9e, 0xef, 0xdf, 0xe0, 0xea, 0x1e, 0xf0, 0x8e, 0xa6, 0xcc, 0xb3,
+  0x39, 0xee, 0x91, 0xd1, 0xab, 0x86, 0x76, 0x12, 0xad, 0x89, 0x53, 0xea, 0x6b, 0x8c, 0x92, 0xa3,
+  0xe4, 0xf1, 0x17, 0x3c, 0x1b, 0xd1, 0xa8, 0xb7, 0xdb, 0xd0, 0x4d, 0x7b, 0x09, 0x33, 0xd6, 0x88,
+  0x5f, 0x84, 0x54, 0xff, 0x1a, 0x62, 0x3f, 0xf8, 0x57, 0x5d, 0xcd, 0x12, 0xbd, 0xbc, 0xc5, 0xb3,
+  0x79, 0xfc, 0xf2, 0x53, 0xc3, 0x0c, 0xbc, 0x59, 0x82, 0x1f, 0xa6, 0x9c, 0xaa, 0xb9, 0xad, 0xf8,
+  0x8e, 0xb2, 0xb5, 0xf0, 0x4e, 0xdd, 0x94, 0xc3, 0x5b, 0x3d, 0x05, 0xd4, 0x16, 0x7e, 0x2c, 0x5e,
+  0x07, 0x32, 0xb2, 0x81, 0x1a, 0x9c, 0xa3, 0xb7, 0x68, 0xa6, 0x5e, 0x0a, 0xaf, 0x9d, 0x01, 0x04,
+  0x39, 0xe2, 0x84, 0xbf, 0xc5, 0xda, 0x0a, 0x60, 0xfe, 0xf2, 0xf7, 0xec, 0x92, 0x05, 0xe1, 0xda,
+  0x3d, 0x87, 0x5d, 0x78, 0x41, 0x7a, 0x4f, 0x84, 0xe8, 0x35, 0x89, 0xc2, 0x8f, 0xae, 0x64, 0x6e,
+  0x96, 0x5d, 0x0d, 0x83, 0x26, 0xa3, 0xcb, 0x5e, 0x69, 0x59, 0x34, 0xc7, 0x29, 0xbc, 0x2f, 0x5e,
+  0xda, 0x8d, 0x05, 0x42, 0x47, 0x74, 0x73, 0xd4, 0xdc, 0xb9, 0x13, 0x2f, 0xb8, 0xb6, 0x93, 0xa9,
+  0xca, 0x97, 0x71, 0x18, 0x35, 0x70, 0xd1, 0xe1, 0xe1, 0xb0, 0x7b, 0xc0, 0x1e, 0x5e, 0x1e, 0xa6,
+  0x96, 0xc2, 0x1e, 0x7e, 0x48, 0x7f, 0x6c, 0x59, 0xbb, 0x74, 0x10, 0x11, 0x80, 0xe0, 0xa1, 0xc2,
+  0xdb, 0xb0, 0xf1, 0xd0, 0x42, 0x9d, 0x92, 0x1d, 0xd3, 0x0b, 0x45, 0x24, 0xca, 0xe6, 0xbc, 0x84,
+  0xff, 0x88, 0xf0, 0x1f, 0x09, 0xbe, 0xb0, 0x33, 0xf6, 0xf8, 0x43, 0xf6, 0x6b, 0x6b, 0x2f, 0xd7,
+  0x41, 0xb7, 0xf5, 0xa8, 0x77, 0x90, 0xca, 0xfe, 0x51, 0x83, 0x9f, 0x31, 0xac, 0x91, 0xe3, 0x2e,
+  0x31, 0x30, 0xa6, 0xbc, 0xc2, 0x0b, 0xc5, 0xc3, 0x15, 0xb4, 0xb7, 0xfe, 0x75, 0x6f, 0x8c, 0xff,
+  0xd6, 0xf3, 0xc2, 0xd7, 0xc5, 0xf0, 0x75, 0xdf, 0xc1, 0x7f, 0xab, 0xd8, 0xde, 0x19, 0x48, 0xc6,
+  0x6b, 0x88, 0x9c, 0x82, 0xa5, 0xe1, 0xe6, 0x66, 0xe2, 0xe1, 0xa1, 0x99, 0x4c, 0xd6, 0x72, 0x19,
+  0x26, 0x4d, 0xa0, 0x9c, 0x87, 0xfe, 0xa3, 0xe1, 0x84, 0x44, 0x99, 0xe8, 0x84, 0xc5, 0x62, 0x2b,
+  0x99, 0xce, 0x5a, 0xb6, 0xdb, 0x9c, 0xf1, 0x55, 0xf8, 0x1f, 0x6c, 0xf4, 0x47, 0xf7, 0x3d, 0xfc,
+  0xaf, 0xd9, 0x92, 0xfe, 0x44, 0xbe, 0xb3, 0xde, 0x37, 0x0d, 0x6b, 0xa9, 0x52, 0x90, 0xde, 0xa1,
+  0x75, 0xc0, 0xbc, 0x97, 0x4a, 0xaf, 0xf0, 0xf3, 0x87, 0x1f, 0x9a, 0x25, 0x67, 0xcb, 0x14, 0x09,
+  0xaa, 0x5d, 0x7b, 0x86, 0xae, 0xbd, 0xb2, 0xae, 0x9f, 0x2a, 0x12, 0x3f, 0x10, 0x3e, 0xdd, 0xb7,
+  0x67, 0xe2, 0x8e, 0x14, 0xb5, 0xe9, 0x7d, 0xa6, 0x34, 0x95, 0xab, 0xed, 0x52, 0x7e, 0x22, 0x32,
+  0xc8, 0x5c, 0xa5, 0x0c, 0xd7, 0xfe, 0x57, 0x7a, 0xff, 0x73, 0xa4, 0xa7, 0x39, 0xd7, 0xeb, 0x1b,
+  0x76, 0x2d, 0xce, 0x9a, 0xe7, 0x83, 0x10, 0x5c, 0xee, 0x15, 0xf4, 0x64, 0x8b, 0xab, 0x85, 0x23,
+  0x3e, 0x73, 0x4c, 0xb3, 0x10, 0x24, 0x66, 0x6b, 0xb2, 0xc6, 0x01, 0x87, 0x27, 0xfa, 0x7a, 0x74,
+  0x0c, 0xf4, 0x14, 0x06, 0x84, 0x4e, 0x10, 0x2e, 0x1b, 0xcd, 0x42, 0x22, 0x87, 0xbc, 0x68, 0x03,
+  0xf7, 0xac, 0xf0, 0x6e, 0x59, 0x18, 0x16, 0x28, 0xdf, 0x27, 0xf6, 0x82, 0x06, 0xb5, 0xfe, 0x9e,
+  0xf5, 0x71, 0xf8, 0xee, 0x81, 0x2b, 0xd2, 0x34, 0x30, 0x4c, 0x2a, 0xdc, 0xd7, 0x78, 0x8c, 0x5b,
+  0x18, 0x39, 0xc7, 0x14, 0xd3, 0xf5, 0x2d, 0x69, 0x2e, 0xcb, 0xd7, 0xce, 0xa0, 0xb4, 0xd2, 0x4f,
+  0xfe, 0x02, 0xeb, 0x58, 0xdd, 0x83, 0xd5, 0xc3, 0x05, 0x16, 0xc0, 0x3c, 0xac, 0x31, 0x7f, 0x68,
+  0x01, 0x7f, 0x5a, 0x6c, 0x5b, 0x78, 0x3c, 0x1a, 0x9e, 0x89, 0x96, 0xeb, 0x73, 0x24, 0xa0, 0x59,
+  0x1c, 0xc7, 0xf3, 0x60, 0xb4, 0xce, 0xbb, 0xba, 0xf0, 0xae, 0x17, 0x98, 0xd8, 0xf6, 0xd6, 0x0b,
+  0x26, 0x95, 0x2e, 0xd9, 0x48, 0xb9, 0xea, 0x92, 0x7b, 0xa9, 0x43, 0xde, 0x98, 0xb2, 0x06, 0x17,
+  0xd3, 0xf7, 0xbd, 0xe6, 0x7a, 0x24, 0x1a, 0x06, 0x21, 0x7c, 0x8d, 0x87, 0x79, 0xc2, 0x48, 0xd3,
+  0xd4, 0x17, 0xd9, 0x09, 0x82, 0xff, 0x5a, 0x40, 0xf1, 0x71, 0xe0, 0xcd, 0x68, 0x57, 0xea, 0x15,
+  0x66, 0xbd, 0x37, 0x44, 0x60, 0xa6, 0x1f, 0x9d, 0xd8, 0xe0, 0x28, 0x84, 0xfa, 0xf5, 0x9b, 0xba,
+  0x1a, 0x83, 0x1a, 0x2e, 0x22, 0xc1, 0xad, 0x22, 0x11, 0x10, 0x36, 0xe8, 0x46, 0x12, 0x1e, 0x97,
+  0xe6, 0x2f, 0x01, 0xe1, 0x5b, 0x11, 0x50, 0x41, 0x1d, 0x22, 0xd5, 0x5d, 0x09, 0x68, 0x76, 0xa0,
+  0xca, 0x0f, 0xa0, 0xe3, 0xfe, 0x1d, 0x9d, 0xf8, 0x19, 0xb5, 0xe8, 0x4e, 0x26, 0xf4, 0x60, 0xdc,
+  0x7d, 0x3e, 0x09, 0x16, 0x55, 0x1c, 0xd7, 0x57, 0xa6, 0x10, 0x82, 0x0d, 0x74, 0xba, 0xec, 0xb3,
+  0xb6, 0x9e, 0x7e, 0x3d, 0xfb, 0x09, 0xe6, 0x79, 0x6f, 0xcf, 0x8f, 0x2f, 0xd8, 0xc5, 0x9b, 0xd7,
+  0xaf, 0xcf, 0xaf, 0x5e, 0x3f, 0x13, 0x16, 0xfa, 0xd1, 0x65, 0x5c, 0xb8, 0x3b, 0x3a, 0xbb, 0x6b,
+  0x5d, 0x3b, 0x2c, 0x2f, 0x0e, 0xf6, 0x2b, 0xb7, 0x57, 0x57, 0x09, 0x4f, 0xad, 0xa7, 0x6f, 0x52,
+  0xd1, 0xc5, 0xf5, 0x95, 0x77, 0x03, 0xa8, 0xb7, 0x5a, 0xc9, 0x36, 0x7c, 0xcf, 0xae, 0xba, 0x99,
+  0x7e, 0xc4, 0xd1, 0x78, 0x3d, 0x71, 0x76, 0x5f, 0xf0, 0xbf, 0xec, 0x86, 0x62, 0x89, 0xf1, 0xbb,
+  0x08, 0x61, 0xad, 0x7f, 0x2d, 0x31, 0x7d, 0x28, 0x20, 0x7f, 0x15, 0xd8, 0xb2, 0x78, 0xd1, 0x31,
+  0x41, 0x6e, 0x16, 0xea, 0x55, 0x5c, 0x5f, 0xac, 0x1c, 0x84, 0xad, 0xa7, 0x70, 0xb2, 0xdb, 0xba,
+  0xd5, 0x84, 0x36, 0xe2, 0x3d, 0xbf, 0x0c, 0xe0, 0x82, 0x0e, 0xaf, 0x3b, 0x74, 0x13, 0x88, 0xb1,
+  0xa6, 0xb8, 0x48, 0x2c, 0x77, 0xe8, 0x31, 0xcd, 0x36, 0xab, 0x17, 0xae, 0x40, 0x56, 0x71, 0xdd,
+  0xf0, 0x0e, 0x64, 0x71, 0xbb, 0x81, 0x9d, 0xe0, 0x9d, 0x2e, 0xe6, 0x3b, 0x90, 0xd5, 0xb1, 0x15,
+  0xd0, 0xbe, 0x08, 0x27, 0x38, 0x23, 0x69, 0x60, 0x59, 0x67, 0x16, 0x4f, 0x5a, 0xd4, 0xba, 0x93,
+  0xc4, 0x1b, 0xdc, 0x95, 0x5c, 0x38, 0xcb, 0x4b, 0x9d, 0xa2, 0x0d, 0x30, 0x81, 0x3f, 0x1d, 0xe6,
+  0xad, 0xba, 0x4d, 0x59, 0xa5, 0x99, 0xc0, 0x11, 0xc5, 0xf8, 0x50, 0x22, 0x25, 0xd1, 0x67, 0x26,
+  0x27, 0x7a, 0x21, 0x0e, 0x0d, 0x87, 0x51, 0xb3, 0x92, 0xab, 0x65, 0x17, 0x36, 0x97, 0xa8, 0x80,
+  0xa3, 0x7c, 0x15, 0xa2, 0x4a, 0x0b, 0xf8, 0x15, 0x2c, 0x1b, 0x2a, 0x82, 0xfa, 0xc9, 0x89, 0xba,
+  0x39, 0x20, 0x15, 0x49, 0xbf, 0x98, 0xda, 0x2a, 0xbe, 0x49, 0x65, 0x8f, 0x31, 0xa1, 0x65, 0x20,
+  0x93, 0x21, 0x2a, 0xee, 0x89, 0x4e, 0xa9, 0x28, 0xbb, 0x2a, 0xba, 0xe8, 0x03, 0x14, 0xad, 0x10,
+  0xe2, 0x6b, 0x65, 0xb9, 0xb6, 0x79, 0x7f, 0x80, 0xa3, 0xef, 0xba, 0x57, 0x69, 0x60, 0x5d, 0xfd,
+  0x06, 0x0d, 0xbc, 0xf7, 0x1f, 0xdf, 0xd6, 0x8d, 0x57, 0xfb, 0x89, 0x00, 0x0b, 0xed, 0xfa, 0x94,
+  0xbe, 0x42, 0x99, 0x22, 0x71, 0x50, 0xa8, 0x77, 0x93, 0xd0, 0xd1, 0x21, 0x78, 0xea, 0x24, 0xe1,
+  0x05, 0x5e, 0x43, 0xed, 0xde, 0xf2, 0xd7, 0x78, 0x29, 0x55, 0xdd, 0x0d, 0xda, 0xef, 0x6e, 0x40,
+  0x39, 0x3e, 0x51, 0x6e, 0xba, 0xd5, 0xdb, 0xe7, 0x29, 0x13, 0x2d, 0xfa, 0x09, 0x9e, 0xa9, 0xd7,
+  0x76, 0xbc, 0x89, 0x97, 0x60, 0x52, 0xa2, 0x17, 0x2c, 0x12, 0x57, 0x7b, 0xc5, 0xb9, 0xac, 0xbc,
+  0x52, 0xa6, 0x0e, 0x22, 0x79, 0x3e, 0xe6, 0xfd, 0x8b, 0xee, 0x08, 0x0d, 0x70, 0xbc, 0x97, 0x10,
+  0x06, 0x79, 0x42, 0x46, 0x78, 0x01, 0xca, 0xdc, 0x76, 0x6e, 0xf0, 0xa8, 0x2f, 0x7e, 0xc2, 0xbb,
+  0xde, 0xad, 0x1b, 0xee, 0x3c, 0x3e, 0x01, 0x3a, 0x27, 0x61, 0x04, 0x83, 0xa1, 0x6a, 0x3e, 0x7c,
+  0x56, 0x3b, 0xa6, 0xcf, 0x4f, 0x64, 0x31, 0x92, 0xec, 0x7a, 0x72, 0x11, 0x2e, 0x69, 0x94, 0x11,
+  0xb5, 0x89, 0x01, 0xf0, 0xe6, 0xc4, 0x8e, 0x95, 0x38, 0x04, 0xb3, 0x97, 0x65, 0x5d, 0xe5, 0x12,
+  0xe9, 0xc9, 0x3c, 0xe6, 0x2b, 0x32, 0x86, 0xb2, 0x18, 0x90, 0x01, 0x02, 0x12, 0xb7, 0xbc, 0x0a,
+  0xbf, 0xd2, 0xb5, 0xa4, 0x70, 0xec, 0x3d, 0x30, 0x7b, 0xc4, 0xef, 0xbc, 0xa8, 0x6b, 0xe9, 0x42,
+  0xa4, 0x09, 0xa0, 0xac, 0xa0, 0xd9, 0x91, 0x77, 0x07, 0xfc, 0x06, 0x4d, 0x01, 0xb7, 0xd3, 0x1e,
+  0x71, 0xf2, 0x1f, 0x81, 0xe9, 0x1c, 0xb3, 0xc2, 0x05, 0x88, 0x46, 0x22, 0xdc, 0x78, 0xde, 0x86,
+  0x08, 0xbc, 0x14, 0x11, 0xcc, 0xc5, 0x2b, 0x2d, 0xe4, 0x0b, 0x8a, 0x9b, 0xe3, 0xc7, 0xbf, 0x86,
+  0x51, 0x40, 0x71, 0x33, 0x20, 0x61, 0x32, 0xcd, 0x06, 0xfe, 0xcc, 0x2f, 0xaa, 0x06, 0x53, 0xbc,
+  0x45, 0x46, 0xfd, 0x6a, 0x06, 0xff, 0x7e, 0xf7, 0x1f, 0xdf, 0x7c, 0x12, 0x46, 0xf0, 0xd4, 0xf9,
+  0xe6, 0x13, 0x69, 0xe3, 0xd3, 0x7b, 0xed, 0x8a, 0x19, 0xa5, 0x09, 0xf0, 0x00, 0x53, 0x51, 0xdd,
+  0x78, 0x64, 0xcf, 0xdd, 0x9f, 0x93, 0x99, 0x2f, 0xcd, 0xbc, 0x59, 0x48, 0x67, 0x93, 0x78, 0x28,
+  0x51, 0x8a, 0x76, 0x51, 0x0b, 0x22, 0x98, 0x22, 0x9f, 0xff, 0x4c, 0x4a, 0x51, 0xbb, 0x2f, 0xbc,
+  0x99, 0x47, 0xe9, 0x64, 0xe0, 0x8a, 0x88, 0x38, 0xe9, 0xb9, 0xf8, 0xb7, 0x23, 0x1a, 0x5a, 0x3f,
+  0x23, 0xec, 0x01, 0x42, 0xce, 0x6c, 0xb6, 0x3c, 0xd0, 0x4f, 0xf8, 0x68, 0xb5, 0xd5, 0xeb, 0xaf,
+  0xb4, 0x82, 0xb1, 0x17, 0xc5, 0x09, 0xbd, 0x2f, 0xe3, 0x32, 0x2a, 0x55, 0x16, 0xcc, 0x95, 0xf6,
+  0x10, 0xf3, 0xef, 0xea, 0x84, 0x73, 0x8a, 0x7f, 0x0b, 0x05, 0xfa, 0x6a, 0x72, 0xf9, 0x61, 0x71,
+  0x85, 0xed, 0x89, 0x76, 0x0d, 0xdd, 0xc6, 0x37, 0x13, 0xe1, 0x85, 0x3f, 0xfa, 0x60, 0xa2, 0x5e,
+  0xc4, 0x26, 0x96, 0x89, 0xb5, 0x7b, 0x88, 0xca, 0x7d, 0x7e, 0xf1, 0x1b, 0x43, 0x29, 0x5e, 0x5a,
+  0x9c, 0xfb, 0x55, 0xf6, 0x6b, 0xf5, 0x75, 0xc4, 0xda, 0xc7, 0x88, 0x0a, 0xb7, 0xdc, 0x7e, 0xd0,
+  0x3e, 0x4e, 0xf4, 0xcd, 0x27, 0xa5, 0x9f, 0x1f, 0xe9, 0xe6, 0x0b, 0x8c, 0x18, 0xf1, 0x6e, 0x88,
+  0xa7, 0x0f, 0x07, 0xff, 0x16, 0x49, 0x29, 0x9f, 0x1d, 0x4a, 0x7b, 0xd2, 0xc0, 0x99, 0x4e, 0x8b,
+  0x97, 0xdd, 0x7b, 0x98, 0x83, 0x93, 0x0d, 0x9e, 0x18, 0xb9, 0x1e, 0x47, 0x91, 0xfd, 0xd8, 0xc1,
+  0x43, 0x2d, 0xba, 0xee, 0xc2, 0x74, 0x31, 0x7a, 0xbc, 0xa1, 0xdb, 0xea, 0xc2, 0xe8, 0x18, 0xa4,
+  0x52, 0xef, 0xc8, 0x11, 0x73, 0x3f, 0x08, 0x93, 0xc6, 0x1f, 0x94, 0x6f, 0xfb, 0xbd, 0x92, 0x02,
+  0x8e, 0x9f, 0x09, 0xac, 0xbd, 0x6f, 0xd6, 0xd5, 0x1b, 0x64, 0x60, 0x82, 0xd8, 0xe0, 0xc3, 0xf4,
+  0x91, 0x21, 0x58, 0x14, 0x83, 0x2c, 0xb9, 0x1a, 0xad, 0x3f, 0xd1, 0x99, 0xb8, 0xd1, 0xda, 0x78,
+  0x05, 0x9c, 0x32, 0x06, 0x55, 0x81, 0x80, 0xe2, 0x72, 0x08, 0x42, 0x4f, 0x3f, 0x70, 0x0f, 0xf6,
+  0xc4, 0xd0, 0x7d, 0x4d, 0x9e, 0x3e, 0x98, 0x2f, 0x96, 0xf9, 0x67, 0xe8, 0x05, 0x8d, 0xfa, 0xff,
+  0x0b, 0x0a, 0x43, 0x27, 0x6a, 0x06, 0x71, 0xb3, 0xf4, 0xa0, 0x3f, 0x4f, 0x36, 0xad, 0x5f, 0x85,
+  0x28, 0xc3, 0x18, 0x9d, 0x50, 0xfe, 0xe6, 0x3e, 0x7d, 0xff, 0x23, 0xe7, 0x24, 0xaa, 0xaf, 0x87,
+  0xa4, 0xae, 0x9b, 0xe6, 0xbb, 0x7a, 0xd4, 0xfb, 0x63, 0x78, 0x1c, 0x0e, 0x21, 0x00, 0xd8, 0xca,
+  0x81, 0xe1, 0xbe, 0x3d, 0x2f, 0xb0, 0x7d, 0x71, 0x20, 0x65, 0x83, 0x7b, 0xf7, 0xf0, 0x8a, 0x40,
+  0xcf, 0x75, 0xbe, 0xaa, 0x57, 0x5d, 0xa3, 0x57, 0x7e, 0xd5, 0x4b, 0xe5, 0x35, 0x7a, 0xe6, 0x4b,
+  0xf4, 0x24, 0x9e, 0x07, 0x2f, 0xaa, 0xae, 0xc8, 0xd3, 0x6e, 0x53, 0xd1, 0xae, 0xc8, 0x43, 0xa9,
+  0x96, 0xdd, 0x12, 0x24, 0x04, 0x95, 0xcd, 0x26, 0x50, 0x4e, 0x24, 0xb4, 0x7d, 0x3a, 0xd8, 0xa4,
+  0x5e, 0x0a, 0xf4, 0x54, 0x71, 0xdb, 0x68, 0x7e, 0x38, 0xca, 0xd9, 0x1e, 0x8f, 0xa6, 0x56, 0xcc,
+  0xcd, 0x79, 0xdb, 0xfc, 0x1d, 0x5f, 0xba, 0xf1, 0xae, 0x6b, 0xb1, 0x05, 0x9d, 0xe5, 0xfa, 0x2a,
+  0x97, 0x93, 0x8b, 0x16, 0x2a, 0xb3, 0x5c, 0x79, 0xb4, 0x20, 0x0d, 0x6c, 0x52, 0x11, 0x50, 0x28,
+  0xca, 0x4c, 0x9f, 0xa8, 0x9a, 0xd2, 0x85, 0xce, 0xfa, 0x45, 0x7e, 0x99, 0xd8, 0x97, 0x1e, 0xf2,
+  0x9f, 0xf3, 0x21, 0x37, 0xb1, 0xc3, 0x8b, 0x5c, 0xea, 0xb6, 0xef, 0xd7, 0xf7, 0xf5, 0x7b, 0x79,
+  0x4c, 0x00, 0x49, 0xf6, 0x30, 0x4c, 0x7d, 0x3c, 0x28, 0x40, 0xe0, 0x1f, 0x36, 0x33, 0x03, 0x49,
+  0xe9, 0xc2, 0x9b, 0x83, 0x29, 0xd8, 0x5b, 0x17, 0xa4, 0x08, 0xbc, 0xd6, 0x80, 0x2a, 0x6a, 0xae,
+  0x05, 0x58, 0x7e, 0x13, 0x6d, 0x05, 0xdc, 0xc3, 0x8d, 0xb0, 0x55, 0xbe, 0x98, 0xb6, 0x0e, 0xdc,
+  0x75, 0xf0, 0x35, 0x5d, 0x3b, 0x42, 0x81, 0x26, 0x99, 0x9e, 0x93, 0x9e, 0x17, 0xa4, 0x0e, 0x60,
+  0x20, 0xa5, 0x61, 0x14, 0x87, 0x85, 0xfa, 0x41, 0xd9, 0xb7, 0x56, 0xfe, 0x96, 0x61, 0x35, 0x3b,
+  0xf0, 0xc7, 0xc0, 0x38, 0xe7, 0xb8, 0xa8, 0x81, 0x29, 0xf9, 0x6a, 0xc2, 0xb9, 0xb2, 0xea, 0x44,
+  0x0b, 0x7f, 0x10, 0x8d, 0x8a, 0x4f, 0xb9, 0xbd, 0xdc, 0xc2, 0x9d, 0x65, 0xfc, 0x8b, 0xa7, 0x1b,
+  0x8e, 0x5e, 0xfc, 0x7f, 0x50, 0x12, 0x27, 0x66, 0xe0, 0xbd, 0x00, 0x00,
+};
+
+#endif
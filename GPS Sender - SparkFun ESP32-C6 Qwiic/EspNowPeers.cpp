@@ -0,0 +1,305 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "EspNowPeers.h"
+#include "Config.h"
+#include "Context.h"
+#include "WebServer.h"
+#include "EspNowSender.h"
+#include "EspNowTransport.h"
+
+// The MAC of slot i is gpsData.espNowClients[i].macAddr
+struct PeerEntry {
+  bool used;
+  bool pinned;
+  unsigned long addedAt;  // millis(); eviction clock for a peer that never answered
+};
+static PeerEntry entries[ESPNOW_MAX_CLIENTS];
+
+// Open-addressed MAC -> slot index, linear probing, rebuilt on removal
+#define PEER_INDEX_SIZE (ESPNOW_MAX_CLIENTS * 2 + 1)
+static int8_t peerIndex[PEER_INDEX_SIZE];
+
+// Guards entries/peerIndex/MACs against the Wi-Fi task's lookups
+static portMUX_TYPE peerMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define PEER_OP_ADD 0
+#define PEER_OP_REMOVE 1
+struct PeerRequest {
+  uint8_t op;
+  uint8_t mac[6];
+  bool pinned;
+  bool announced;   // Came from a pairing announce: answer with a pair ack
+};
+static QueueHandle_t requestQueue = NULL;
+static const uint8_t broadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static volatile bool pairingEnabled = ESPNOW_PAIRING_ENABLED;
+
+// NVS record per peer: MAC + pinned flag
+#define PEER_RECORD_SIZE 7
+
+static uint32_t macHash(const uint8_t* mac) {
+  uint32_t h = 2166136261u; // FNV-1a
+  for (int i = 0; i < 6; i++) {
+    h ^= mac[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Caller holds peerMux
+static void indexInsert(int slot) {
+  uint32_t pos = macHash(gpsData.espNowClients[slot].macAddr) % PEER_INDEX_SIZE;
+  while (peerIndex[pos] >= 0) pos = (pos + 1) % PEER_INDEX_SIZE;
+  peerIndex[pos] = slot;
+}
+
+// Caller holds peerMux
+static void rebuildIndex() {
+  memset(peerIndex, -1, sizeof(peerIndex));
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (entries[i].used) indexInsert(i);
+  }
+}
+
+int findEspNowPeer(const uint8_t* mac) {
+  int slot = -1;
+  portENTER_CRITICAL(&peerMux);
+  uint32_t pos = macHash(mac) % PEER_INDEX_SIZE;
+  for (int probes = 0; probes < PEER_INDEX_SIZE && peerIndex[pos] >= 0; probes++) {
+    if (memcmp(gpsData.espNowClients[peerIndex[pos]].macAddr, mac, 6) == 0) {
+      slot = peerIndex[pos];
+      break;
+    }
+    pos = (pos + 1) % PEER_INDEX_SIZE;
+  }
+  portEXIT_CRITICAL(&peerMux);
+  return slot;
+}
+
+bool espNowPeerUsed(int slot) {
+  return slot >= 0 && slot < ESPNOW_MAX_CLIENTS && entries[slot].used;
+}
+
+bool readEspNowPeer(int slot, uint8_t* mac, bool* active) {
+  if (slot < 0 || slot >= ESPNOW_MAX_CLIENTS) return false;
+  portENTER_CRITICAL(&peerMux);
+  bool used = entries[slot].used;
+  if (used) {
+    memcpy(mac, gpsData.espNowClients[slot].macAddr, 6);
+    if (active) *active = gpsData.espNowClients[slot].isActive;
+  }
+  portEXIT_CRITICAL(&peerMux);
+  return used;
+}
+
+bool espNowPeerPinned(int slot) {
+  return espNowPeerUsed(slot) && entries[slot].pinned;
+}
+
+int countEspNowPeers() {
+  int n = 0;
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (entries[i].used) n++;
+  }
+  return n;
+}
+
+static String macToString(const uint8_t* mac) {
+  char buf[18];
+  snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  return String(buf);
+}
+
+bool parseMacAddress(const String& text, uint8_t* mac) {
+  unsigned int b[6];
+  if (sscanf(text.c_str(), "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) return false;
+  for (int i = 0; i < 6; i++) {
+    if (b[i] > 0xFF) return false;
+    mac[i] = b[i];
+  }
+  return true;
+}
+
+static void savePeers() {
+  uint8_t records[ESPNOW_MAX_CLIENTS * PEER_RECORD_SIZE];
+  size_t len = 0;
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (!entries[i].used) continue;
+    memcpy(records + len, gpsData.espNowClients[i].macAddr, 6);
+    records[len + 6] = entries[i].pinned ? 1 : 0;
+    len += PEER_RECORD_SIZE;
+  }
+  Preferences prefs;
+  prefs.begin("espnow_peers", false);
+  prefs.putBytes("peers", records, len);
+  prefs.end();
+}
+
+// Loop task only. Returns the slot, or -1 when the table is full or ESP-NOW refused the peer.
+static int addPeer(const uint8_t* mac, bool pinned, bool& changed) {
+  int slot = findEspNowPeer(mac);
+  if (slot >= 0) {
+    if (pinned && !entries[slot].pinned) {
+      entries[slot].pinned = true;
+      changed = true;
+    }
+    return slot;
+  }
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS && slot < 0; i++) {
+    if (!entries[i].used) slot = i;
+  }
+  if (slot < 0) return -1;
+
+  // Unicast mode sends to each peer; broadcast mode never addresses one
+  if (!ESPNOW_BROADCAST_MODE && !espNowTransportAddPeer(mac)) return -1;
+
+  portENTER_CRITICAL(&peerMux);
+  GPSData::EspNowClientMetrics& client = gpsData.espNowClients[slot];
+  memcpy(client.macAddr, mac, 6);
+  client.isActive = false;
+  client.lastResponseTime = 0;
+  client.lastPingReceived = 0;
+  entries[slot].used = true;
+  entries[slot].pinned = pinned;
+  entries[slot].addedAt = millis();
+  indexInsert(slot);
+  portEXIT_CRITICAL(&peerMux);
+  resetEspNowPeerStats(slot);
+  changed = true;
+  return slot;
+}
+
+// Loop task only
+static bool removePeer(const uint8_t* mac) {
+  int slot = findEspNowPeer(mac);
+  if (slot < 0) return false;
+  if (!ESPNOW_BROADCAST_MODE) espNowTransportRemovePeer(mac);
+  portENTER_CRITICAL(&peerMux);
+  entries[slot].used = false;
+  memset(&gpsData.espNowClients[slot], 0, sizeof(gpsData.espNowClients[slot]));
+  rebuildIndex();
+  portEXIT_CRITICAL(&peerMux);
+  return true;
+}
+
+void beginEspNowPeers(const uint8_t (*defaults)[6], int count) {
+  if (requestQueue == NULL) requestQueue = xQueueCreate(8, sizeof(PeerRequest));
+  memset(peerIndex, -1, sizeof(peerIndex));
+
+  Preferences prefs;
+  prefs.begin("espnow_peers", true);
+  bool stored = prefs.isKey("peers");
+  uint8_t records[ESPNOW_MAX_CLIENTS * PEER_RECORD_SIZE];
+  size_t len = stored ? prefs.getBytes("peers", records, sizeof(records)) : 0;
+  pairingEnabled = prefs.getBool("pairing", ESPNOW_PAIRING_ENABLED);
+  prefs.end();
+
+  bool changed = false;
+  if (stored) {
+    for (size_t off = 0; off + PEER_RECORD_SIZE <= len; off += PEER_RECORD_SIZE) {
+      addPeer(records + off, records[off + 6] != 0, changed);
+    }
+    webSerialLog("ESP-NOW: Loaded " + String(countEspNowPeers()) + " peer(s) from flash");
+  } else {
+    // First boot: start from the compiled-in receivers
+    for (int i = 0; i < count; i++) addPeer(defaults[i], true, changed);
+    savePeers();
+    webSerialLog("ESP-NOW: Peer table seeded with " + String(countEspNowPeers()) + " configured receiver(s)");
+  }
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (entries[i].used) {
+      Serial.printf("  Peer %d: %s%s\n", i + 1, macToString(gpsData.espNowClients[i].macAddr).c_str(),
+                    entries[i].pinned ? " (pinned)" : "");
+    }
+  }
+}
+
+bool requestEspNowPeerAdd(const uint8_t* mac, bool pinned, bool announced) {
+  if (requestQueue == NULL) return false;
+  PeerRequest req;
+  req.op = PEER_OP_ADD;
+  memcpy(req.mac, mac, 6);
+  req.pinned = pinned;
+  req.announced = announced;
+  return xQueueSend(requestQueue, &req, 0) == pdTRUE;
+}
+
+bool requestEspNowPeerRemove(const uint8_t* mac) {
+  if (requestQueue == NULL) return false;
+  PeerRequest req;
+  req.op = PEER_OP_REMOVE;
+  memcpy(req.mac, mac, 6);
+  req.pinned = false;
+  req.announced = false;
+  return xQueueSend(requestQueue, &req, 0) == pdTRUE;
+}
+
+void serviceEspNowPeers() {
+  if (requestQueue == NULL) return;
+  bool changed = false;
+
+  PeerRequest req;
+  while (xQueueReceive(requestQueue, &req, 0) == pdTRUE) {
+    String mac = macToString(req.mac);
+    if (req.op == PEER_OP_REMOVE) {
+      if (removePeer(req.mac)) {
+        changed = true;
+        webSerialLog("ESP-NOW: Peer " + mac + " removed");
+      }
+      continue;
+    }
+
+    bool known = findEspNowPeer(req.mac) >= 0;
+    int slot = addPeer(req.mac, req.pinned, changed);
+    if (slot < 0) {
+      webSerialLog("ESP-NOW: Peer table full (" + String(ESPNOW_MAX_CLIENTS) + "), " + mac + " not added");
+      continue;
+    }
+    if (!known) webSerialLog("ESP-NOW: Peer " + mac + " registered as client " + String(slot + 1));
+    if (req.announced && ESPNOW_BROADCAST_MODE) {
+      EspNowGroupPairAckPacket ack;
+      ack.magic = ESPNOW_PAIR_ACK_MAGIC;
+      ack.groupId = ESPNOW_GROUP_ID;
+      memcpy(ack.mac, req.mac, 6);
+      queueEspNowControlFrame(broadcastMac, (const uint8_t *) &ack, sizeof(ack));
+    } else if (req.announced) {
+      EspNowPairAckPacket ack;
+      ack.magic = ESPNOW_PAIR_ACK_MAGIC;
+      ack.groupId = ESPNOW_GROUP_ID;
+      queueEspNowControlFrame(req.mac, (const uint8_t *) &ack, sizeof(ack));
+    }
+  }
+
+  // Evict learned peers that have stopped answering; pinned ones stay
+  static unsigned long lastEvictionCheck = 0;
+  unsigned long now = millis();
+  if (now - lastEvictionCheck >= 1000) {
+    lastEvictionCheck = now;
+    for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+      if (!entries[i].used || entries[i].pinned) continue;
+      unsigned long lastHeard = gpsData.espNowClients[i].lastResponseTime;
+      if (lastHeard == 0) lastHeard = entries[i].addedAt;
+      if (now - lastHeard > ESPNOW_PEER_EVICT_MS) {
+        uint8_t mac[6];
+        memcpy(mac, gpsData.espNowClients[i].macAddr, 6);
+        removePeer(mac);
+        changed = true;
+        webSerialLog("ESP-NOW: Peer " + macToString(mac) + " evicted (no pong for " + String(ESPNOW_PEER_EVICT_MS / 1000) + "s)");
+      }
+    }
+  }
+
+  if (changed) savePeers();
+}
+
+bool espNowPairingEnabled() {
+  return pairingEnabled;
+}
+
+void setEspNowPairingEnabled(bool enabled) {
+  pairingEnabled = enabled;
+  Preferences prefs;
+  prefs.begin("espnow_peers", false);
+  prefs.putBool("pairing", enabled);
+  prefs.end();
+}
@@ -0,0 +1,57 @@
+#ifndef ESP_NOW_PEERS_H
+#define ESP_NOW_PEERS_H
+
+#include <Arduino.h>
+
+// ESP-NOW receiver table, kept in NVS so receivers survive a reboot.
+// Receivers join by broadcasting an announce frame, or are added through the web
+// API. Slot i's liveness metrics are gpsData.espNowClients[i]; a free slot has an
+// all-zero MAC. Lookups hash the MAC, so a pong is matched in O(1).
+// In unicast mode every entry is also an ESP-NOW driver peer. In broadcast mode only
+// the table knows them, so ESPNOW_MAX_CLIENTS is not capped by the driver's peer slots.
+//
+// The table is only changed on the loop task. The receive path and the web server
+// post add/remove requests that serviceEspNowPeers() applies on its next pass.
+
+// Pairing handshake (receiver -> sender, broadcast). The peer is the frame's source
+// address; mac is informational and not trusted.
+#define ESPNOW_ANNOUNCE_MAGIC 0x52494150 // "PAIR"
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t groupId;     // ESPNOW_GROUP_ID of the sender the receiver wants
+  uint8_t mac[6];       // Receiver's MAC
+  uint8_t reserved;
+} EspNowAnnouncePacket;
+
+// Sender -> receiver: registered, stop announcing
+#define ESPNOW_PAIR_ACK_MAGIC 0x4B434150 // "PACK"
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t groupId;
+} EspNowPairAckPacket;
+
+// Broadcast mode: the same ack sent to everyone, for the receiver named in mac.
+// Receivers are not driver peers in that mode, so there is nobody to unicast to.
+typedef struct __attribute__((packed)) {
+  uint32_t magic;       // ESPNOW_PAIR_ACK_MAGIC
+  uint16_t groupId;
+  uint8_t mac[6];       // Receiver being acknowledged
+} EspNowGroupPairAckPacket;
+
+void beginEspNowPeers(const uint8_t (*defaults)[6], int count); // Load from NVS (or seed) and register with ESP-NOW
+int findEspNowPeer(const uint8_t* mac);       // Slot, or -1. Any task.
+bool espNowPeerUsed(int slot);
+bool readEspNowPeer(int slot, uint8_t* mac, bool* active = NULL); // Consistent copy, false if free. Any task.
+bool espNowPeerPinned(int slot);              // Configured or added by hand: never evicted
+int countEspNowPeers();
+
+bool requestEspNowPeerAdd(const uint8_t* mac, bool pinned, bool announced = false);
+bool requestEspNowPeerRemove(const uint8_t* mac);
+void serviceEspNowPeers();                    // Loop task: apply requests, evict silent peers, persist
+
+bool espNowPairingEnabled();
+void setEspNowPairingEnabled(bool enabled);
+
+bool parseMacAddress(const String& text, uint8_t* mac); // "AA:BB:CC:DD:EE:FF"
+
+#endif
@@ -0,0 +1,274 @@
+#ifndef ESP_NOW_PROTOCOL_H
+#define ESP_NOW_PROTOCOL_H
+
+// ESP-NOW wire format shared by the sender and the ESPHome receivers, which pull this
+// file in through `esphome: includes:`. Plain C library only. Every struct is packed and
+// little-endian, as both ends are ESP32s.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/time.h>
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over v2 and v3 frames
+static inline uint16_t espNowCrc16(const uint8_t* data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// ================= POSITION (v2 and v3) =================
+// Fixed-point fields straight from the UBX integers
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint32_t txMicros;        // Sender esp_timer at send (low 32 bits, never 0); echoed in timed pongs
+  uint32_t utcEpoch;        // Unix seconds, 0 = no valid time
+  int32_t lat;              // deg * 1e7
+  int32_t lon;
+  int32_t altMm;            // Above ellipsoid
+  uint16_t speedCmS;
+  uint16_t headingE2;       // deg * 100
+  uint16_t pdop;            // DOP * 100
+  uint16_t hdop;
+  uint16_t vdop;
+  uint16_t hAccCm;          // Saturates at 655.35 m
+  uint16_t vAccCm;
+  int16_t tzOffsetMinutes;  // Receivers derive local time from utcEpoch
+  uint8_t sats;
+  uint8_t satsVisible;
+  uint8_t fixType;
+  uint32_t stationIp;
+} EspNowPvt;
+
+// v2: one position frame per epoch, 53 bytes
+#define ESPNOW_PACKET_V2 2
+#define ESPNOW_V2_FLAG_GROUP 0x01  // Broadcast frame: receivers must match groupId
+
+typedef struct __attribute__((packed)) {
+  uint8_t version;          // ESPNOW_PACKET_V2
+  uint8_t flags;
+  uint16_t groupId;
+  EspNowPvt pvt;
+  uint16_t crc;             // Over all preceding bytes
+} GpsEspNowPacketV2;
+
+// ================= TYPED MESSAGES (v3) =================
+// Each frame is an envelope, a chunk of one message, and a CRC over both. A message
+// larger than one frame is cut into up to ESPNOW_MAX_FRAGMENTS chunks sharing type and
+// seq; every chunk but the last is ESPNOW_FRAG_PAYLOAD_MAX bytes.
+#define ESPNOW_PACKET_V3 3
+#define ESPNOW_ENV_FLAG_GROUP 0x01  // Broadcast frame: receivers must match groupId
+#define ESPNOW_FRAME_MAX 250        // ESP-NOW payload limit
+
+typedef struct __attribute__((packed)) {
+  uint8_t version;          // ESPNOW_PACKET_V3
+  uint8_t type;             // ESPNOW_MSG_*
+  uint8_t flags;
+  uint8_t seq;              // Per message type
+  uint8_t fragIndex;
+  uint8_t fragCount;
+  uint16_t groupId;
+} EspNowEnvelope;
+
+#define ESPNOW_FRAG_PAYLOAD_MAX (ESPNOW_FRAME_MAX - sizeof(EspNowEnvelope) - sizeof(uint16_t))
+#define ESPNOW_MAX_FRAGMENTS 3
+#define ESPNOW_MSG_PAYLOAD_MAX (ESPNOW_FRAG_PAYLOAD_MAX * ESPNOW_MAX_FRAGMENTS)
+
+#define ESPNOW_MSG_PVT 1            // EspNowPosition, every epoch; answered with a pong
+#define ESPNOW_MSG_SATS 2           // EspNowSatHeader + numSvs * EspNowSatInfo
+#define ESPNOW_MSG_STATS 3          // EspNowStats
+#define ESPNOW_MSG_HEALTH 4         // EspNowHealth
+
+// Time transfer. The UTC of the solution is utcEpoch + utcMillis; txOffsetUs is how long
+// after that instant the frame left the sender, stamped per send. Their sum is UTC at
+// transmission, which leaves only the air time (~1 ms) unaccounted for.
+typedef struct __attribute__((packed)) {
+  uint16_t utcMillis;       // 0..999
+  uint32_t txOffsetUs;
+} EspNowTimeRef;
+
+typedef struct __attribute__((packed)) {
+  EspNowPvt pvt;
+  EspNowTimeRef time;       // Meaningless when pvt.utcEpoch is 0
+} EspNowPosition;
+
+// Sky view, from UBX-NAV-SAT
+#define ESPNOW_SAT_USED 0x01        // Used in the navigation solution
+#define ESPNOW_SAT_HEALTHY 0x02
+#define ESPNOW_SAT_UNHEALTHY 0x04   // Neither bit: health unknown
+
+typedef struct __attribute__((packed)) {
+  uint8_t numSvs;
+  uint8_t numUsed;
+} EspNowSatHeader;
+
+typedef struct __attribute__((packed)) {
+  uint8_t gnssId;           // UBX numbering: 0 GPS, 2 Galileo, 3 BeiDou, 6 GLONASS...
+  uint8_t svId;
+  uint8_t cno;              // dBHz
+  int8_t elev;              // deg, -90..90
+  int16_t azim;             // deg, 0..360
+  uint8_t quality;          // UBX qualityInd, 0..7
+  uint8_t flags;            // ESPNOW_SAT_*
+} EspNowSatInfo;
+
+// Session records kept by the sender. Records not set yet hold the sender's defaults
+// (altMin 99999 m, altMax -99999 m, DOP 100, accuracy saturated).
+typedef struct __attribute__((packed)) {
+  int32_t altMinCm;
+  int32_t altMaxCm;
+  uint16_t speedMaxCmS;
+  uint8_t satsMax;
+  uint8_t satsVisibleMax;
+  uint16_t pdopMin;         // DOP * 100
+  uint16_t hdopMin;
+  uint16_t vdopMin;
+  uint16_t hAccMinCm;
+  uint16_t vAccMinCm;
+  uint16_t ttffSeconds;
+} EspNowStats;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeS;
+  uint32_t freeHeap;
+  int16_t cpuTempE1;        // degC * 10
+  int8_t rssi;              // Station link, 0 = not connected
+  uint8_t peers;
+  uint8_t gnssConnected;
+  uint8_t demoMode;
+  uint16_t i2cBytesPerEpoch;
+  uint32_t epochsOverwritten;
+  uint32_t txNoMem;
+  uint32_t txTimeouts;
+  uint32_t rxDropped;
+} EspNowHealth;
+
+static inline uint8_t espNowFragmentCount(size_t payloadLen) {
+  return payloadLen == 0 ? 1 : (uint8_t)((payloadLen + ESPNOW_FRAG_PAYLOAD_MAX - 1) / ESPNOW_FRAG_PAYLOAD_MAX);
+}
+
+// Write fragment fragIndex of a message into frame (ESPNOW_FRAME_MAX bytes). Returns the frame length.
+static inline size_t espNowBuildFragment(uint8_t* frame, uint8_t type, uint8_t flags, uint8_t seq, uint16_t groupId,
+                                         const uint8_t* payload, size_t payloadLen, uint8_t fragIndex) {
+  EspNowEnvelope env;
+  env.version = ESPNOW_PACKET_V3;
+  env.type = type;
+  env.flags = flags;
+  env.seq = seq;
+  env.fragIndex = fragIndex;
+  env.fragCount = espNowFragmentCount(payloadLen);
+  env.groupId = groupId;
+
+  size_t offset = (size_t)fragIndex * ESPNOW_FRAG_PAYLOAD_MAX;
+  size_t chunkLen = payloadLen - offset;
+  if (chunkLen > ESPNOW_FRAG_PAYLOAD_MAX) chunkLen = ESPNOW_FRAG_PAYLOAD_MAX;
+
+  memcpy(frame, &env, sizeof(env));
+  memcpy(frame + sizeof(env), payload + offset, chunkLen);
+  size_t len = sizeof(env) + chunkLen;
+  uint16_t crc = espNowCrc16(frame, len);
+  memcpy(frame + len, &crc, sizeof(crc));
+  return len + sizeof(crc);
+}
+
+// Check a v3 frame. On success env is filled in and chunk points at its payload bytes.
+static inline bool espNowParseFrame(const uint8_t* frame, size_t len, EspNowEnvelope& env,
+                                    const uint8_t*& chunk, size_t& chunkLen) {
+  if (len < sizeof(EspNowEnvelope) + sizeof(uint16_t) || frame[0] != ESPNOW_PACKET_V3) return false;
+  uint16_t crc;
+  memcpy(&crc, frame + len - sizeof(crc), sizeof(crc));
+  if (crc != espNowCrc16(frame, len - sizeof(crc))) return false;
+  memcpy(&env, frame, sizeof(env));
+  chunk = frame + sizeof(env);
+  chunkLen = len - sizeof(env) - sizeof(crc);
+  return true;
+}
+
+// Rebuilds one fragmented message at a time; single-frame messages never need it.
+// Fragments may arrive in any order or twice (retries). A fragment of another message
+// starts over, so a message that lost a fragment is dropped once the next one begins.
+struct EspNowReassembler {
+  uint8_t type = 0;
+  uint8_t seq = 0;
+  uint8_t count = 0;
+  uint8_t received = 0;     // Bit per fragIndex
+  bool complete = false;
+  size_t length = 0;
+  uint8_t payload[ESPNOW_MSG_PAYLOAD_MAX];
+
+  // True when this fragment completes the message in payload/length
+  bool add(const EspNowEnvelope& env, const uint8_t* chunk, size_t chunkLen) {
+    if (env.fragCount < 2 || env.fragCount > ESPNOW_MAX_FRAGMENTS || env.fragIndex >= env.fragCount) return false;
+    bool last = env.fragIndex == env.fragCount - 1;
+    if (last ? chunkLen > ESPNOW_FRAG_PAYLOAD_MAX : chunkLen != ESPNOW_FRAG_PAYLOAD_MAX) return false;
+
+    if (env.type != type || env.seq != seq || env.fragCount != count) {
+      type = env.type;
+      seq = env.seq;
+      count = env.fragCount;
+      received = 0;
+      complete = false;
+    }
+    if (complete) return false; // Repeat of a fragment already delivered
+
+    memcpy(payload + (size_t)env.fragIndex * ESPNOW_FRAG_PAYLOAD_MAX, chunk, chunkLen);
+    if (last) length = (size_t)env.fragIndex * ESPNOW_FRAG_PAYLOAD_MAX + chunkLen;
+    received |= 1 << env.fragIndex;
+    complete = received == (1 << count) - 1;
+    return complete;
+  }
+};
+
+// UTC (us since 1970) at the moment the sender transmitted a position message
+static inline int64_t espNowUtcMicros(const EspNowPosition& pos) {
+  return (int64_t)pos.pvt.utcEpoch * 1000000 + (int64_t)pos.time.utcMillis * 1000 + pos.time.txOffsetUs;
+}
+
+// Receiver clock discipline. A frame is handled some time after it arrives, which only
+// ever makes the sender's time look behind the local clock, so the largest offset over
+// ESPNOW_CLOCK_WINDOW frames is the best estimate. That is slewed in with adjtime; the
+// clock is stepped on the first frame and when it is off by more than ESPNOW_CLOCK_STEP_US.
+#define ESPNOW_CLOCK_WINDOW 8
+#define ESPNOW_CLOCK_STEP_US 500000
+
+struct EspNowClock {
+  bool synced = false;
+  int samples = 0;
+  int64_t bestOffsetUs = 0;
+  int64_t lastCorrectionUs = 0;
+
+  // True when this frame corrected the clock (lastCorrectionUs says by how much)
+  bool update(int64_t utcUs) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t offset = utcUs - ((int64_t)now.tv_sec * 1000000 + now.tv_usec);
+    if (!synced || offset > ESPNOW_CLOCK_STEP_US || offset < -ESPNOW_CLOCK_STEP_US) {
+      struct timeval tv;
+      tv.tv_sec = (time_t)(utcUs / 1000000);
+      tv.tv_usec = (suseconds_t)(utcUs % 1000000);
+      settimeofday(&tv, NULL);
+      synced = true;
+      samples = 0;
+      lastCorrectionUs = offset;
+      return true;
+    }
+    if (samples == 0 || offset > bestOffsetUs) bestOffsetUs = offset;
+    if (++samples < ESPNOW_CLOCK_WINDOW) return false;
+
+    // adjtime replaces any slew still in progress, and the older offsets predate this one
+    struct timeval delta;
+    delta.tv_sec = (time_t)(bestOffsetUs / 1000000);
+    delta.tv_usec = (suseconds_t)(bestOffsetUs % 1000000);
+    adjtime(&delta, NULL);
+    samples = 0;
+    lastCorrectionUs = bestOffsetUs;
+    return true;
+  }
+};
+
+#endif
@@ -1,25 +1,29 @@
 #include <Arduino.h>
-#include <esp_now.h>
 #include <WiFi.h>
+#include <atomic>
 #include "EspNowSender.h"
 #include "Context.h" // To access global gpsData
 #include "WebServer.h" // For webSerialLog
+#include "GpsSnapshot.h"
+#include "EspNowPeers.h"
+#include "EspNowProtocol.h"
+#include "EspNowTransport.h"
+#include "GpsLogic.h"
 
 // ESP-NOW Direct Point-to-Point Configuration
 // REPLACE WITH YOUR ESPHOME RECEIVER MAC ADDRESS (get from ESPHome device)
 // Example: {0x34, 0x85, 0x18, 0x7B, 0x56, 0x24}
 // To find MAC: check ESPHome logs or web_server interface
 
-// Multiple receiver MAC addresses
-uint8_t broadcastAddress1[] = {0xCC, 0xBA, 0x97, 0xF3, 0xC7, 0x28};  // Original receiver
-uint8_t broadcastAddress2[] = {0x30, 0xED, 0xA0, 0xAE, 0x0D, 0x60};  // AMOLED display
-uint8_t broadcastAddress3[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};  // Reserved for future
+// Receivers seeded into the peer table on first boot. After that the table lives in
+// NVS: receivers pair themselves, or are added/removed through /api/espnow_peer_*.
+static const uint8_t defaultReceivers[][6] = {
+  {0xCC, 0xBA, 0x97, 0xF3, 0xC7, 0x28},  // Original receiver
+  {0x30, 0xED, 0xA0, 0xAE, 0x0D, 0x60},  // AMOLED display
+};
+static const int numDefaultReceivers = sizeof(defaultReceivers) / sizeof(defaultReceivers[0]);
 
-// Array of all receivers for easy iteration
-uint8_t* receiverMacs[] = {broadcastAddress1, broadcastAddress2, broadcastAddress3};
-const int numReceivers = 2; // Currently using 2 receivers (adjust when adding more) 
-
-// Define the struct matching the receiver
+// v1 packet (ESPNOW_PACKET_VERSION 1): the original layout, kept for receivers not yet updated
 typedef struct __attribute__((packed)) {
   double lat;
   double lon;
@@ -44,67 +48,685 @@ typedef struct __attribute__((packed)) {
   uint32_t pingCounter;  // Echo back the ping counter
 } PongPacket;
 
-// Track which client we're currently sending to
-static int currentSendIndex = -1;
-static unsigned long lastTransmitTimes[3] = {0, 0, 0}; // Track per-client transmission times
+// Broadcast mode: one frame per epoch heard by every receiver, tagged with the group id
+static const uint8_t broadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
-// Callback when data is received (pong response from receivers)
-void OnDataReceived(const esp_now_recv_info_t *recv_info, const uint8_t *data, int size) {
-  if (size != sizeof(PongPacket)) {
-    Serial.printf("Received unexpected packet size: %d\n", size);
-    webSerialLog("ESP-NOW: Received unexpected packet size: " + String(size));
-    return;
+typedef struct __attribute__((packed)) {
+  GpsEspNowPacket packet;
+  uint16_t groupId;
+} GpsEspNowGroupPacket;
+
+// Pong answering a group broadcast: carries the receiver's own MAC
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint16_t groupId;
+  uint8_t mac[6];
+} GroupPongPacket;
+
+// Pongs to a v2 ping echo its txMicros, which gives the round trip without per-ping state
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint32_t txMicros;
+} TimedPongPacket;
+
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint32_t txMicros;
+  uint16_t groupId;
+  uint8_t mac[6];
+} TimedGroupPongPacket;
+
+// ================= ROUND-TRIP TIME =================
+// Per-peer RTT histogram, written only by the loop task (handleRxEvent).
+// Bin i counts samples below rttBinEdgesUs[i]; the last bin is everything above.
+static const uint32_t rttBinEdgesUs[ESPNOW_RTT_BINS - 1] = {
+  1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000
+};
+static EspNowRttStats peerRtt[ESPNOW_MAX_CLIENTS];
+
+static void recordRtt(int slot, uint32_t rttUs) {
+  EspNowRttStats& r = peerRtt[slot];
+  int bin = 0;
+  while (bin < ESPNOW_RTT_BINS - 1 && rttUs >= rttBinEdgesUs[bin]) bin++;
+
+  // Halve the histogram now and then so p95 follows the recent link, not the whole uptime
+  if (r.windowSamples >= 256) {
+    r.windowSamples = 0;
+    for (int i = 0; i < ESPNOW_RTT_BINS; i++) {
+      r.histogram[i] /= 2;
+      r.windowSamples += r.histogram[i];
+    }
+  }
+  r.histogram[bin]++;
+  r.windowSamples++;
+
+  if (r.samples == 0) {
+    r.minUs = rttUs;
+    r.meanUs = rttUs;
+  } else {
+    if (rttUs < r.minUs) r.minUs = rttUs;
+    r.meanUs += ((int32_t)rttUs - (int32_t)r.meanUs) / 8;  // EWMA, 1/8
+    // Interarrival jitter as in RFC 3550: J += (|D| - J) / 16
+    int32_t d = (int32_t)rttUs - (int32_t)r.lastUs;
+    if (d < 0) d = -d;
+    r.jitterUs += (d - (int32_t)r.jitterUs) / 16;
   }
+  r.lastUs = rttUs;
+  r.samples++;
+
+  // p95: upper edge of the bin holding the 95th percentile
+  uint32_t target = (r.windowSamples * 95 + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < ESPNOW_RTT_BINS; i++) {
+    seen += r.histogram[i];
+    if (seen >= target) {
+      r.p95Us = i < ESPNOW_RTT_BINS - 1 ? rttBinEdgesUs[i] : r.lastUs;
+      break;
+    }
+  }
+}
+
+const EspNowRttStats& getEspNowRttStats(int slot) {
+  return peerRtt[slot];
+}
+
+const uint32_t* getEspNowRttBinEdges() {
+  return rttBinEdgesUs;
+}
+
+static uint16_t saturate16(uint32_t value) {
+  return value > 0xFFFF ? 0xFFFF : (uint16_t)value;
+}
+
+static void buildPacketV1(const GpsSnapshot& snap, GpsEspNowPacket& packet) {
+  packet.lat = snap.lat;
+  packet.lon = snap.lon;
+  packet.alt = (float)snap.alt;
+  packet.speed = snap.speed;
+  packet.heading = snap.heading;
+  packet.sats = (uint8_t)snap.satellites;
+  packet.satsVisible = (uint8_t)snap.satellitesVisible;
+  packet.fixType = snap.fixType;
+  strncpy(packet.localTime, snap.localTimeStr, sizeof(packet.localTime));
   
-  PongPacket pong;
-  memcpy(&pong, data, sizeof(PongPacket));
+  packet.pdop = snap.pdop;
+  packet.hdop = snap.hdop;
+  packet.vdop = snap.vdop;
+  packet.hAcc = snap.hAcc;
+  packet.vAcc = snap.vAcc;
   
-  // Debug: Log the MAC that sent this pong
-  char macStr[18];
-  snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-           recv_info->src_addr[0], recv_info->src_addr[1], recv_info->src_addr[2],
-           recv_info->src_addr[3], recv_info->src_addr[4], recv_info->src_addr[5]);
-  Serial.printf("Pong from MAC %02X:%02X:%02X:%02X:%02X:%02X (ping #%u)\n",
-                recv_info->src_addr[0], recv_info->src_addr[1], recv_info->src_addr[2],
-                recv_info->src_addr[3], recv_info->src_addr[4], recv_info->src_addr[5],
-                pong.pingCounter);
+  packet.stationIp = WiFi.localIP();
+  packet.pingCounter = gpsData.espNowPingCounter;
+//  packet.displayPage = gpsData.displayPage; // Use current display page from global state
+}
+
+// Integer-only: the C6 has no FPU
+static void buildPvt(const GpsSnapshot& snap, EspNowPvt& pvt) {
+  pvt.pingCounter = gpsData.espNowPingCounter;
+  pvt.txMicros = 0;  // Set by stampFrame right before each send
+  pvt.utcEpoch = snap.utcEpoch;
+  pvt.lat = snap.latE7;
+  pvt.lon = snap.lonE7;
+  pvt.altMm = snap.heightMm;
+  pvt.speedCmS = saturate16(snap.gSpeedMmS > 0 ? snap.gSpeedMmS / 10 : 0);
+  pvt.headingE2 = (uint16_t)((snap.headMotE5 / 1000) % 36000);
+  pvt.pdop = snap.pdopE2;
+  pvt.hdop = snap.hdopE2;
+  pvt.vdop = snap.vdopE2;
+  pvt.hAccCm = saturate16(snap.hAccMm / 10);
+  pvt.vAccCm = saturate16(snap.vAccMm / 10);
+  pvt.tzOffsetMinutes = (int16_t)snap.timezoneOffsetMinutes;
+  pvt.sats = (uint8_t)snap.satellites;
+  pvt.satsVisible = (uint8_t)snap.satellitesVisible;
+  pvt.fixType = snap.fixType;
+  pvt.stationIp = WiFi.localIP();
+}
+
+static void buildPacketV2(const GpsSnapshot& snap, GpsEspNowPacketV2& packet) {
+  packet.version = ESPNOW_PACKET_V2;
+  packet.flags = ESPNOW_BROADCAST_MODE ? ESPNOW_V2_FLAG_GROUP : 0;
+  packet.groupId = ESPNOW_GROUP_ID;
+  buildPvt(snap, packet.pvt);
+}
+
+static_assert(sizeof(GpsEspNowPacketV2) == 53, "v2 layout changed");
+static_assert(sizeof(EspNowSatHeader) + GPS_SAT_TABLE_MAX * sizeof(EspNowSatInfo) <= ESPNOW_MSG_PAYLOAD_MAX,
+              "GPS_SAT_TABLE_MAX does not fit in one ESP-NOW message");
+
+// v3 bulk payloads, built on the loop task. Each returns the payload length.
+static size_t buildSatTable(uint8_t* payload) {
+  EspNowSatHeader header;
+  header.numSvs = gpsData.satCount;
+  header.numUsed = 0;
+  size_t len = sizeof(header);
+  for (int i = 0; i < gpsData.satCount; i++) {
+    const SatInfo& sat = gpsData.sats[i];
+    EspNowSatInfo info;
+    info.gnssId = sat.gnssId;
+    info.svId = sat.svId;
+    info.cno = sat.cno;
+    info.elev = sat.elev;
+    info.azim = sat.azim;
+    info.quality = sat.quality;
+    info.flags = (sat.used ? ESPNOW_SAT_USED : 0) |
+                 (sat.health == 1 ? ESPNOW_SAT_HEALTHY : 0) | (sat.health == 2 ? ESPNOW_SAT_UNHEALTHY : 0);
+    if (sat.used) header.numUsed++;
+    memcpy(payload + len, &info, sizeof(info));
+    len += sizeof(info);
+  }
+  memcpy(payload, &header, sizeof(header));
+  return len;
+}
+
+static size_t buildStats(const GpsSnapshot& snap, uint8_t* payload) {
+  EspNowStats stats;
+  stats.altMinCm = (int32_t)(snap.altMin * 100);
+  stats.altMaxCm = (int32_t)(snap.altMax * 100);
+  stats.speedMaxCmS = saturate16((uint32_t)(snap.speedMax * 100));
+  stats.satsMax = (uint8_t)snap.satellitesMax;
+  stats.satsVisibleMax = (uint8_t)snap.satellitesVisibleMax;
+  stats.pdopMin = saturate16((uint32_t)(snap.pdopMin * 100));
+  stats.hdopMin = saturate16((uint32_t)(snap.hdopMin * 100));
+  stats.vdopMin = saturate16((uint32_t)(snap.vdopMin * 100));
+  stats.hAccMinCm = saturate16((uint32_t)(snap.hAccMin * 100));
+  stats.vAccMinCm = saturate16((uint32_t)(snap.vAccMin * 100));
+  stats.ttffSeconds = saturate16(snap.ttffSeconds);
+  memcpy(payload, &stats, sizeof(stats));
+  return sizeof(stats);
+}
+
+// Fields rewritten per send, so each receiver's round trip and time transfer start when
+// its own frame goes out. The frame ends in a CRC over everything before it.
+struct TxStamp {
+  uint8_t txMicrosOffset;          // Where txMicros sits
+  uint8_t timeRefOffset;           // Where an EspNowTimeRef sits; 0 = none
+  uint32_t utcRefMicros;           // esp_timer at the solution time (low 32 bits)
+};
+
+static void stampFrame(uint8_t* data, size_t len, const TxStamp& stamp) {
+  uint32_t txMicros = (uint32_t)esp_timer_get_time() | 1;
+  memcpy(data + stamp.txMicrosOffset, &txMicros, sizeof(txMicros));
+  if (stamp.timeRefOffset) {
+    uint32_t txOffsetUs = txMicros - stamp.utcRefMicros;
+    memcpy(data + stamp.timeRefOffset + offsetof(EspNowTimeRef, txOffsetUs), &txOffsetUs, sizeof(txOffsetUs));
+  }
+  uint16_t crc = espNowCrc16(data, len - sizeof(crc));
+  memcpy(data + len - sizeof(crc), &crc, sizeof(crc));
+}
+
+// Bulk message types, in sending order
+#define BULK_SATS 0
+#define BULK_STATS 1
+#define BULK_HEALTH 2
+#define BULK_TYPES 3
+static const uint8_t bulkMsgType[BULK_TYPES] = {ESPNOW_MSG_SATS, ESPNOW_MSG_STATS, ESPNOW_MSG_HEALTH};
+
+// Bit per type: set by handleRxEvent when a receiver (re)connects, so it gets every bulk
+// message at the next epoch instead of waiting for the dividers
+static uint8_t bulkNeeded = 0;
+
+// ================= RECEIVE PATH =================
+// onEspNowFrameReceived runs in the Wi-Fi driver task, so it only copies the frame into a
+// single-producer/single-consumer ring. Parsing, peer lookup, metrics and logging
+// happen in serviceEspNowReceive() on the loop task.
+#define RX_EVENT_MAX_LEN 16  // Largest frame a receiver sends (timed group pong)
+
+struct RxEvent {
+  uint8_t srcMac[6];
+  uint8_t len;                // Bytes copied into data
+  int size;                   // Size as received; larger than len for unexpected frames
+  unsigned long rxMs;         // millis() in the callback, so liveness ignores processing delay
+  uint32_t rxMicros;          // esp_timer in the callback, for round-trip times
+  uint8_t data[RX_EVENT_MAX_LEN];
+};
+
+static RxEvent rxRing[ESPNOW_RX_RING_SIZE];
+static std::atomic<uint32_t> rxHead(0);   // Written by the Wi-Fi task only
+static std::atomic<uint32_t> rxTail(0);   // Written by the loop task only
+static EspNowRxStats rxStats;             // Callback fields written by the Wi-Fi task only
+
+// Callback when data is received (pong response from receivers)
+void onEspNowFrameReceived(const uint8_t* mac, const uint8_t* data, int size) {
+  int64_t start = esp_timer_get_time();
+
+  uint32_t head = rxHead.load(std::memory_order_relaxed);
+  if (head - rxTail.load(std::memory_order_acquire) >= ESPNOW_RX_RING_SIZE) {
+    rxStats.dropped++;
+  } else {
+    RxEvent& ev = rxRing[head & (ESPNOW_RX_RING_SIZE - 1)];
+    memcpy(ev.srcMac, mac, 6);
+    ev.size = size;
+    ev.len = size < RX_EVENT_MAX_LEN ? (size > 0 ? size : 0) : RX_EVENT_MAX_LEN;
+    memcpy(ev.data, data, ev.len);
+    ev.rxMs = millis();
+    ev.rxMicros = (uint32_t)start;
+    rxHead.store(head + 1, std::memory_order_release);
+  }
+
+  uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+  rxStats.callbacks++;
+  rxStats.lastCallbackUs = elapsed;
+  if (elapsed > rxStats.maxCallbackUs) rxStats.maxCallbackUs = elapsed;
+}
+
+// Loop task: whether an unrecognized frame may be logged now. Pongs arrive from every
+// receiver every epoch, so only state changes (checkEspNowClientTimeouts) and a sample
+// of the odd ones go to the log.
+static bool rxWarningDue() {
+  static unsigned long lastWarningMs = 0;
+  if (lastWarningMs != 0 && millis() - lastWarningMs < 10000) return false;
+  lastWarningMs = millis();
+  return true;
+}
+
+// Loop task: everything the callback used to do inline
+static void handleRxEvent(const RxEvent& ev) {
+  PongPacket pong;
+  uint32_t txMicros = 0; // Echoed ping timestamp; 0 = legacy pong without one
+  uint8_t mac[6];
+  memcpy(mac, ev.srcMac, 6);
+  if (ev.size == sizeof(EspNowAnnouncePacket)) {
+    // A receiver asking to join; serviceEspNowPeers registers it and answers with a pair ack
+    EspNowAnnouncePacket announce;
+    memcpy(&announce, ev.data, sizeof(announce));
+    if (announce.magic != ESPNOW_ANNOUNCE_MAGIC || announce.groupId != ESPNOW_GROUP_ID) return;
+    if (!espNowPairingEnabled()) return;
+    requestEspNowPeerAdd(mac, false, true); // The radio's source address, not the claimed one
+    return;
+  }
+  if (ev.size == sizeof(PongPacket)) {
+    memcpy(&pong, ev.data, sizeof(PongPacket));
+  } else if (ev.size == sizeof(GroupPongPacket)) {
+    GroupPongPacket groupPong;
+    memcpy(&groupPong, ev.data, sizeof(GroupPongPacket));
+    if (groupPong.groupId != ESPNOW_GROUP_ID) return; // Answering another sender's group
+    pong.pingCounter = groupPong.pingCounter;
+    memcpy(mac, groupPong.mac, 6);
+  } else if (ev.size == sizeof(TimedPongPacket)) {
+    TimedPongPacket timedPong;
+    memcpy(&timedPong, ev.data, sizeof(TimedPongPacket));
+    pong.pingCounter = timedPong.pingCounter;
+    txMicros = timedPong.txMicros;
+  } else if (ev.size == sizeof(TimedGroupPongPacket)) {
+    TimedGroupPongPacket timedPong;
+    memcpy(&timedPong, ev.data, sizeof(TimedGroupPongPacket));
+    if (timedPong.groupId != ESPNOW_GROUP_ID) return;
+    pong.pingCounter = timedPong.pingCounter;
+    txMicros = timedPong.txMicros;
+    memcpy(mac, timedPong.mac, 6);
+  } else {
+    rxStats.unrecognized++;
+    if (rxWarningDue()) {
+      webSerialLog("ESP-NOW: Received unexpected packet size: " + String(ev.size) +
+                   " (" + String(rxStats.unrecognized) + " unrecognized so far)");
+    }
+    return;
+  }
   
   // Find which client sent this pong by matching MAC address
-  for (int i = 0; i < numReceivers; i++) {
-    if (memcmp(recv_info->src_addr, receiverMacs[i], 6) == 0) {
-      gpsData.espNowClients[i].lastResponseTime = millis();
-      gpsData.espNowClients[i].lastPingReceived = pong.pingCounter;
-      gpsData.espNowClients[i].isActive = true;
-      
-      Serial.printf("ESP-NOW: Pong received from client %d (ping #%u)\n", i + 1, pong.pingCounter);
-      webSerialLog("ESP-NOW: Pong received from client " + String(i + 1) + " (ping #" + String(pong.pingCounter) + ")");
-      return;
-    }
+  int i = findEspNowPeer(mac);
+  if (i < 0 && ESPNOW_BROADCAST_MODE && espNowPairingEnabled()) {
+    // Any display in our group is welcome; it is tracked from the next pong on
+    requestEspNowPeerAdd(mac, false);
+    return;
+  }
+  if (i >= 0) {
+    if (!gpsData.espNowClients[i].isActive) bulkNeeded = (1 << BULK_TYPES) - 1; // Fill its sky view and stats now
+    gpsData.espNowClients[i].lastResponseTime = ev.rxMs;
+    gpsData.espNowClients[i].lastPingReceived = pong.pingCounter;
+    gpsData.espNowClients[i].isActive = true;
+    if (txMicros != 0) recordRtt(i, ev.rxMicros - txMicros);
+    rxStats.pongs++;
+    return;
   }
   
   // If we get here, MAC didn't match any known client
-  char unknownMac[18];
-  snprintf(unknownMac, sizeof(unknownMac), "%02X:%02X:%02X:%02X:%02X:%02X",
-           recv_info->src_addr[0], recv_info->src_addr[1], recv_info->src_addr[2],
-           recv_info->src_addr[3], recv_info->src_addr[4], recv_info->src_addr[5]);
-  Serial.printf("WARNING: Unrecognized pong from %02X:%02X:%02X:%02X:%02X:%02X\n",
-                recv_info->src_addr[0], recv_info->src_addr[1], recv_info->src_addr[2],
-                recv_info->src_addr[3], recv_info->src_addr[4], recv_info->src_addr[5]);
-  webSerialLog("WARNING: Unrecognized pong from " + String(unknownMac));
-}
-
-// Callback when data is sent
-void OnDataSent(const wifi_tx_info_t *info, esp_now_send_status_t status) {
-  // Update global status only
-  if (status == ESP_NOW_SEND_SUCCESS) {
-    gpsData.espNowStatus = "Active (Sent)";
-    gpsData.espNowError = ""; // Clear error
-  } else {
-    gpsData.espNowStatus = "Delivery Failed";
-    gpsData.espNowError = "Packet delivery failed";
+  rxStats.unrecognized++;
+  if (rxWarningDue()) {
+    char macStr[18];
+    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    webSerialLog("WARNING: Unrecognized pong from " + String(macStr) +
+                 " (" + String(rxStats.unrecognized) + " unrecognized so far)");
+  }
+}
+
+void serviceEspNowReceive() {
+  uint32_t tail = rxTail.load(std::memory_order_relaxed);
+  uint32_t head = rxHead.load(std::memory_order_acquire);
+  while (tail != head) {
+    handleRxEvent(rxRing[tail & (ESPNOW_RX_RING_SIZE - 1)]);
+    rxStats.processed++;
+    tail++;
+    rxTail.store(tail, std::memory_order_release); // Slot may be reused from here on
   }
 }
 
+const EspNowRxStats& getEspNowRxStats() {
+  return rxStats;
+}
+
+// ================= TRANSMIT PATH =================
+// All esp_now_send calls happen on one pacing task with a single frame in flight: each
+// send waits for its onEspNowSendComplete (or ESPNOW_TX_TIMEOUT_MS) before the next,
+// so the driver queue never overflows as peers are added. Failed sends are retried with
+// bounded exponential backoff. GPS frames go through a one-slot mailbox so a newer fix
+// replaces a stale one, and a round still in progress is abandoned when one arrives.
+// Pair acks and other control frames go first.
+// v3 bulk messages (sky view, stats, health) fill the gaps between epochs. Each type has
+// its own one-slot mailbox, and a message interrupted by a GPS frame resumes at the
+// fragment and peer where it stopped.
+#define TX_FRAME_MAX_LEN 80        // Largest GPS frame (v1 group packet: 77 bytes)
+#define TX_NOTIFY_WORK 0x01        // Something was queued
+#define TX_NOTIFY_SENT 0x04        // Send callback: the in-flight frame completed (see inFlightDoneSeq)
+
+#define TX_DELIVERED 0
+#define TX_FAILED 1
+#define TX_STALE 2                 // Given up because a newer GPS frame is waiting
+
+struct TxFrame {
+  uint8_t data[TX_FRAME_MAX_LEN];
+  uint8_t len;
+  bool stamped;                    // v2/v3 position: apply stamp (and the CRC) per send
+  TxStamp stamp;
+};
+
+struct TxMessage {
+  uint8_t type;
+  uint8_t seq;
+  uint16_t len;
+  uint8_t payload[ESPNOW_MSG_PAYLOAD_MAX];
+};
+
+// TX task only: the bulk message being sent and how far it got
+struct BulkProgress {
+  TxMessage msg;
+  bool active;
+  int nextPeer;                    // Peer slot (0 in broadcast mode)
+  uint8_t nextFrag;
+};
+
+struct ControlFrame {
+  uint8_t mac[6];
+  uint8_t len;
+  uint8_t data[16];
+};
+
+// Delivery counters: written by the TX task, read from the loop and web server
+struct TxCounters {
+  std::atomic<uint32_t> attempted{0};
+  std::atomic<uint32_t> delivered{0};
+  std::atomic<uint32_t> failed{0};
+  std::atomic<uint32_t> consecutiveFailures{0};
+  std::atomic<uint32_t> retries{0};
+  std::atomic<uint32_t> lastLatencyUs{0};
+  std::atomic<uint32_t> maxLatencyUs{0};
+  std::atomic<uint32_t> lastDeliveredMs{0};
+};
+static TxCounters peerTx[ESPNOW_MAX_CLIENTS];
+static TxCounters broadcastTx;
+
+static TaskHandle_t txTaskHandle = NULL;
+static QueueHandle_t frameMailbox = NULL;   // Depth 1, overwritten by each new fix
+static QueueHandle_t controlQueue = NULL;
+static QueueHandle_t bulkMailbox[BULK_TYPES];  // Depth 1 each, overwritten by a newer message
+static BulkProgress bulkProgress[BULK_TYPES];
+static EspNowTxQueueStats txQueueStats;
+
+// The frame in flight; the send callback only reports on this one. The driver reports
+// every send it accepted exactly once and in order, so completions are numbered as they
+// come in: a late one for a send that timed out carries an older number than inFlightSeq,
+// even when it is for the same MAC (a retry, or any broadcast).
+static uint8_t inFlightMac[6];
+static std::atomic<uint32_t> inFlightSeq(0);     // Number of the send in flight; 0 = none
+static std::atomic<uint32_t> inFlightSentUs(0);  // esp_timer at send
+static std::atomic<uint32_t> inFlightLatencyUs(0);
+static std::atomic<bool> inFlightDelivered(false);
+static std::atomic<uint32_t> inFlightDoneSeq(0);   // Last send the callback reported on
+static uint32_t sendSeq = 0;                     // TX task: sends the driver accepted
+static uint32_t completeSeq = 0;                 // Wi-Fi task: completions reported
+
+static uint32_t nextSendSeq(uint32_t seq) {
+  return seq + 1 != 0 ? seq + 1 : 1; // 0 stays "none" across the wrap
+}
+
+static TxCounters& txCounters(int slot) {
+  return slot < 0 ? broadcastTx : peerTx[slot];
+}
+
+void getEspNowTxStats(int slot, EspNowTxStats &out) {
+  TxCounters& c = txCounters(slot);
+  out.attempted = c.attempted.load();
+  out.delivered = c.delivered.load();
+  out.failed = c.failed.load();
+  out.consecutiveFailures = c.consecutiveFailures.load();
+  out.retries = c.retries.load();
+  out.lastLatencyUs = c.lastLatencyUs.load();
+  out.maxLatencyUs = c.maxLatencyUs.load();
+  out.lastDeliveredMs = c.lastDeliveredMs.load();
+}
+
+void resetEspNowPeerStats(int slot) {
+  if (slot >= 0) peerRtt[slot] = EspNowRttStats();
+  TxCounters& c = txCounters(slot);
+  c.attempted.store(0);
+  c.delivered.store(0);
+  c.failed.store(0);
+  c.consecutiveFailures.store(0);
+  c.retries.store(0);
+  c.lastLatencyUs.store(0);
+  c.maxLatencyUs.store(0);
+  c.lastDeliveredMs.store(0);
+}
+
+const EspNowTxQueueStats& getEspNowTxQueueStats() {
+  return txQueueStats;
+}
+
+// Callback when data is sent (Wi-Fi task): hand the outcome to the TX task
+void onEspNowSendComplete(const uint8_t* mac, bool delivered) {
+  completeSeq = nextSendSeq(completeSeq);
+  if (completeSeq != inFlightSeq.load() || memcmp(mac, inFlightMac, 6) != 0) return;
+  inFlightLatencyUs.store((uint32_t)esp_timer_get_time() - inFlightSentUs.load());
+  inFlightDelivered.store(delivered);
+  inFlightDoneSeq.store(completeSeq);
+  xTaskNotify(txTaskHandle, TX_NOTIFY_SENT, eSetBits);
+}
+
+// Wait for send number seq to complete. False on timeout. A notification left over from
+// an older send only wakes the loop: the outcome is taken from inFlightDoneSeq.
+static bool waitSendComplete(uint32_t seq, bool& delivered) {
+  TickType_t start = xTaskGetTickCount();
+  TickType_t timeout = pdMS_TO_TICKS(ESPNOW_TX_TIMEOUT_MS);
+  while (inFlightDoneSeq.load() != seq) {
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= timeout) {
+      inFlightSeq.store(0); // A late callback is ignored
+      return false;
+    }
+    xTaskNotifyWait(0, 0xFFFFFFFF, NULL, timeout - elapsed);
+  }
+  delivered = inFlightDelivered.load();
+  return true;
+}
+
+// One frame to one destination: paced, retried. counters is NULL for control frames;
+// GPS and bulk frames give up as soon as a newer GPS frame is waiting.
+static int transmitFrame(const uint8_t* mac, uint8_t* data, size_t len, const TxStamp* stamp, TxCounters* counters) {
+  uint32_t backoffMs = ESPNOW_TX_BACKOFF_MS;
+  for (int attempt = 0; attempt <= ESPNOW_TX_MAX_RETRIES; attempt++) {
+    if (attempt > 0) {
+      if (counters && uxQueueMessagesWaiting(frameMailbox) > 0) {
+        txQueueStats.abandoned++; // Stale now: neither delivered nor failed
+        return TX_STALE;
+      }
+      if (counters) counters->retries++;
+      vTaskDelay(pdMS_TO_TICKS(backoffMs));
+      backoffMs = backoffMs * 2 > ESPNOW_TX_BACKOFF_MAX_MS ? ESPNOW_TX_BACKOFF_MAX_MS : backoffMs * 2;
+    }
+    if (stamp) stampFrame(data, len, *stamp);
+
+    memcpy(inFlightMac, mac, 6);
+    uint32_t seq = nextSendSeq(sendSeq);
+    inFlightSentUs.store((uint32_t)esp_timer_get_time());
+    inFlightSeq.store(seq); // Before the send: the callback may beat it back
+    esp_err_t err = espNowTransportSend(mac, data, len);
+    if (err == ESP_OK) sendSeq = seq;
+    if (err != ESP_OK) {
+      inFlightSeq.store(0);
+      if (err == ESP_ERR_ESPNOW_NO_MEM) txQueueStats.noMem++;
+      else txQueueStats.sendErrors++;
+      continue;
+    }
+
+    bool delivered = false;
+    if (!waitSendComplete(seq, delivered)) {
+      txQueueStats.timeouts++;
+      continue;
+    }
+    if (!delivered) continue;
+
+    if (counters) {
+      uint32_t latency = inFlightLatencyUs.load();
+      counters->lastLatencyUs.store(latency);
+      if (latency > counters->maxLatencyUs.load()) counters->maxLatencyUs.store(latency);
+      counters->attempted++;
+      counters->delivered++;
+      counters->consecutiveFailures.store(0);
+      counters->lastDeliveredMs.store(millis());
+    }
+    return TX_DELIVERED;
+  }
+  if (counters) {
+    counters->attempted++;
+    counters->failed++;
+    counters->consecutiveFailures++;
+  }
+  return TX_FAILED;
+}
+
+static void sendControlFrames() {
+  ControlFrame ctrl;
+  while (xQueueReceive(controlQueue, &ctrl, 0) == pdTRUE) {
+    transmitFrame(ctrl.mac, ctrl.data, ctrl.len, NULL, NULL);
+    txQueueStats.controlSent++;
+  }
+}
+
+// One GPS frame to every receiver (or one broadcast)
+static void sendFrameRound(TxFrame& frame) {
+  if (ESPNOW_BROADCAST_MODE) {
+    // Delivery is recorded in broadcastTx; gpsData belongs to the loop task
+    transmitFrame(broadcastMac, frame.data, frame.len, frame.stamped ? &frame.stamp : NULL, &broadcastTx);
+    return;
+  }
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (uxQueueMessagesWaiting(controlQueue) > 0) sendControlFrames();
+    if (uxQueueMessagesWaiting(frameMailbox) > 0) {
+      txQueueStats.abandoned++; // A newer fix is waiting; the rest of this round is stale
+      return;
+    }
+    // The loop task may be adding or removing this peer: take a consistent copy
+    uint8_t mac[6];
+    if (!readEspNowPeer(i, mac)) continue;
+    // Always send to allow auto-reconnection, regardless of current status; delivery lands in peerTx[i]
+    transmitFrame(mac, frame.data, frame.len, frame.stamped ? &frame.stamp : NULL, &peerTx[i]);
+  }
+}
+
+// Send the rest of one bulk message. False if a GPS or control frame came first; the
+// message then picks up from the same fragment on the next call.
+static bool continueBulk(BulkProgress& bulk) {
+  uint8_t frame[ESPNOW_FRAME_MAX];
+  uint8_t flags = ESPNOW_BROADCAST_MODE ? ESPNOW_ENV_FLAG_GROUP : 0;
+  uint8_t fragCount = espNowFragmentCount(bulk.msg.len);
+  int destinations = ESPNOW_BROADCAST_MODE ? 1 : ESPNOW_MAX_CLIENTS;
+
+  for (; bulk.nextPeer < destinations; bulk.nextPeer++, bulk.nextFrag = 0) {
+    const uint8_t* mac = broadcastMac;
+    TxCounters* counters = &broadcastTx;
+    uint8_t peerMac[6];
+    if (!ESPNOW_BROADCAST_MODE) {
+      // Only receivers that answer pongs: the rest would not use it
+      bool active = false;
+      if (!readEspNowPeer(bulk.nextPeer, peerMac, &active) || !active) continue;
+      mac = peerMac;
+      counters = &peerTx[bulk.nextPeer];
+    }
+    for (; bulk.nextFrag < fragCount; bulk.nextFrag++) {
+      if (uxQueueMessagesWaiting(frameMailbox) > 0 || uxQueueMessagesWaiting(controlQueue) > 0) return false;
+      size_t len = espNowBuildFragment(frame, bulk.msg.type, flags, bulk.msg.seq, ESPNOW_GROUP_ID,
+                                       bulk.msg.payload, bulk.msg.len, bulk.nextFrag);
+      int result = transmitFrame(mac, frame, len, NULL, counters);
+      if (result == TX_STALE) return false;
+      if (result == TX_FAILED) break; // The receiver cannot complete this message any more
+    }
+  }
+  bulk.active = false;
+  txQueueStats.bulkSent++;
+  return true;
+}
+
+// Bulk messages in type order, each picked up from its mailbox when the previous is done
+static void sendBulk() {
+  if (ESPNOW_PACKET_VERSION < ESPNOW_PACKET_V3) return;
+  for (int t = 0; t < BULK_TYPES; t++) {
+    BulkProgress& bulk = bulkProgress[t];
+    if (xQueueReceive(bulkMailbox[t], &bulk.msg, 0) == pdTRUE) {
+      if (bulk.active) txQueueStats.bulkSuperseded++; // Receivers drop the partial message
+      bulk.active = true;
+      bulk.nextPeer = 0;
+      bulk.nextFrag = 0;
+    }
+    if (bulk.active && !continueBulk(bulk)) return;
+  }
+}
+
+static bool txWorkWaiting() {
+  if (uxQueueMessagesWaiting(frameMailbox) > 0 || uxQueueMessagesWaiting(controlQueue) > 0) return true;
+  if (ESPNOW_PACKET_VERSION < ESPNOW_PACKET_V3) return false;
+  for (int t = 0; t < BULK_TYPES; t++) {
+    if (bulkProgress[t].active || uxQueueMessagesWaiting(bulkMailbox[t]) > 0) return true;
+  }
+  return false;
+}
+
+static void espNowTxTask(void *param) {
+  (void)param;
+  TxFrame frame;
+  for (;;) {
+    // A post between the check and the wait leaves the notification set, so none is missed
+    if (!txWorkWaiting()) xTaskNotifyWait(0, 0xFFFFFFFF, NULL, portMAX_DELAY);
+
+    sendControlFrames();
+    if (xQueueReceive(frameMailbox, &frame, 0) == pdTRUE) {
+      sendFrameRound(frame);
+    } else {
+      sendBulk(); // Only when no GPS frame is waiting
+    }
+  }
+}
+
+static void startEspNowTxTask() {
+  frameMailbox = xQueueCreate(1, sizeof(TxFrame));
+  controlQueue = xQueueCreate(ESPNOW_TX_CONTROL_DEPTH, sizeof(ControlFrame));
+  if (ESPNOW_PACKET_VERSION >= ESPNOW_PACKET_V3) {
+    for (int t = 0; t < BULK_TYPES; t++) bulkMailbox[t] = xQueueCreate(1, sizeof(TxMessage));
+  }
+  xTaskCreate(espNowTxTask, "espnow_tx", ESPNOW_TX_TASK_STACK_SIZE, NULL, ESPNOW_TX_TASK_PRIORITY, &txTaskHandle);
+}
+
+bool queueEspNowControlFrame(const uint8_t* mac, const uint8_t* data, size_t len) {
+  if (txTaskHandle == NULL || len > sizeof(ControlFrame::data)) return false;
+  ControlFrame ctrl;
+  memcpy(ctrl.mac, mac, 6);
+  ctrl.len = len;
+  memcpy(ctrl.data, data, len);
+  if (xQueueSend(controlQueue, &ctrl, 0) != pdTRUE) return false;
+  xTaskNotify(txTaskHandle, TX_NOTIFY_WORK, eSetBits);
+  return true;
+}
+
 void setupEspNow() {
   // ESP-NOW works independently of WiFi connection
   // It can operate even when WiFi is connected to a router (WIFI_AP_STA mode)
@@ -115,18 +737,7 @@ void setupEspNow() {
   Serial.println(WiFi.macAddress());
   webSerialLog("ESP-NOW Sender MAC: " + WiFi.macAddress());
   
-  Serial.printf("Configured %d receiver(s):\n", numReceivers);
-  webSerialLog("ESP-NOW: Configuring " + String(numReceivers) + " receiver(s)");
-  for (int i = 0; i < numReceivers; i++) {
-    Serial.printf("  Receiver %d: ", i + 1);
-    for (int j = 0; j < 6; j++) {
-      Serial.printf("%02X", receiverMacs[i][j]);
-      if (j < 5) Serial.print(":");
-    }
-    Serial.println();
-  }
-
-  if (esp_now_init() != ESP_OK) {
+  if (!espNowTransportBegin()) {
     Serial.println("Error initializing ESP-NOW");
     webSerialLog("ERROR: ESP-NOW initialization failed");
     gpsData.espNowStatus = "Init Failed";
@@ -134,151 +745,169 @@ void setupEspNow() {
     return;
   }
   webSerialLog("ESP-NOW initialized successfully");
+  startEspNowTxTask();
 
-  // Register Send and Receive Callbacks
-  esp_now_register_send_cb(OnDataSent);
-  esp_now_register_recv_cb(OnDataReceived);
-
-  // Register all receivers as peers and initialize metrics
-  int peersAdded = 0;
-  for (int i = 0; i < numReceivers; i++) {
-    // Initialize client metrics
-    memcpy(gpsData.espNowClients[i].macAddr, receiverMacs[i], 6);
-    gpsData.espNowClients[i].isActive = false;
-    gpsData.espNowClients[i].lastResponseTime = 0;
-    gpsData.espNowClients[i].lastPingReceived = 0;
-    
-    esp_now_peer_info_t peerInfo;
-    memset(&peerInfo, 0, sizeof(peerInfo));
-    memcpy(peerInfo.peer_addr, receiverMacs[i], 6);
-    peerInfo.channel = 0;  // 0 = use current WiFi channel (works with AP_STA mode)
-    peerInfo.encrypt = false; // No encryption (can be enabled with a shared key)
-
-    if (esp_now_add_peer(&peerInfo) != ESP_OK) {
-      Serial.printf("Failed to add peer %d\n", i + 1);
-      gpsData.espNowClients[i].isActive = false;
-    } else {
-      Serial.printf("Peer %d registered successfully\n", i + 1);
-      gpsData.espNowClients[i].isActive = true;
-      peersAdded++;
+  // Known receivers are registered as driver peers in unicast mode only
+  beginEspNowPeers(defaultReceivers, numDefaultReceivers);
+
+  if (ESPNOW_BROADCAST_MODE) {
+    // A single broadcast peer serves every receiver in the group
+    if (!espNowTransportAddPeer(broadcastMac)) {
+      gpsData.espNowStatus = "Peer Error";
+      gpsData.espNowError = "Broadcast peer not added";
+      webSerialLog("ERROR: ESP-NOW - Broadcast peer could not be added");
+      return;
     }
-  }
-  
-  if (peersAdded > 0) {
     gpsData.espNowStatus = "Ready";
-    Serial.printf("ESP-NOW ready with %d peer(s)\n", peersAdded);
-    webSerialLog("ESP-NOW ready with " + String(peersAdded) + " peer(s)");
-  } else {
-    gpsData.espNowStatus = "Peer Error";
-    gpsData.espNowError = "No peers added";
-    webSerialLog("ERROR: ESP-NOW - No peers could be added");
+    webSerialLog("ESP-NOW ready in broadcast mode (group 0x" + String(ESPNOW_GROUP_ID, HEX) + ")");
+    return;
   }
+
+  int peers = countEspNowPeers();
+  gpsData.espNowStatus = "Ready";
+  Serial.printf("ESP-NOW ready with %d peer(s)\n", peers);
+  webSerialLog("ESP-NOW ready with " + String(peers) + " peer(s)" + (espNowPairingEnabled() ? ", pairing open" : ""));
+}
+
+static size_t buildHealth(const GpsSnapshot& snap, uint8_t* payload) {
+  EspNowHealth health;
+  health.uptimeS = millis() / 1000;
+  health.freeHeap = ESP.getFreeHeap();
+  health.cpuTempE1 = (int16_t)(snap.cpuTemp * 10);
+  health.rssi = WiFi.status() == WL_CONNECTED ? (int8_t)WiFi.RSSI() : 0;
+  health.peers = (uint8_t)countEspNowPeers();
+  health.gnssConnected = snap.isConnected ? 1 : 0;
+  health.demoMode = snap.demoMode ? 1 : 0;
+  health.i2cBytesPerEpoch = saturate16(snap.i2cBytesPerEpoch);
+  health.epochsOverwritten = getGpsTaskStats().epochsOverwritten;
+  health.txNoMem = txQueueStats.noMem;
+  health.txTimeouts = txQueueStats.timeouts;
+  health.rxDropped = rxStats.dropped;
+  memcpy(payload, &health, sizeof(health));
+  return sizeof(health);
+}
+
+// v3: the sky view, session records and sender health only go out every Nth epoch
+// (ESPNOW_*_DIVIDER), or right away for a receiver that just connected
+static void queueBulkMessages(const GpsSnapshot& snap) {
+  static const uint32_t dividers[BULK_TYPES] = {ESPNOW_SATS_DIVIDER, ESPNOW_STATS_DIVIDER, ESPNOW_HEALTH_DIVIDER};
+  static uint32_t epochCount = 0;
+  static uint8_t seq[BULK_TYPES] = {0};
+  static TxMessage msg; // Loop task only; too large for its stack
+
+  epochCount++;
+  for (int t = 0; t < BULK_TYPES; t++) {
+    bool due = (bulkNeeded & (1 << t)) || (dividers[t] > 0 && epochCount % dividers[t] == 0);
+    if (!due) continue;
+    msg.type = bulkMsgType[t];
+    msg.seq = seq[t]++;
+    if (t == BULK_SATS) msg.len = buildSatTable(msg.payload);
+    else if (t == BULK_STATS) msg.len = buildStats(snap, msg.payload);
+    else msg.len = buildHealth(snap, msg.payload);
+    xQueueOverwrite(bulkMailbox[t], &msg);
+    txQueueStats.bulkQueued++;
+  }
+  bulkNeeded = 0;
+  xTaskNotify(txTaskHandle, TX_NOTIFY_WORK, eSetBits);
 }
 
 void sendGpsDataViaEspNow() {
-  if (!gpsData.hasFix) return; // Optional: Only send if we have a fix
+  if (txTaskHandle == NULL) return; // ESP-NOW did not start
+  GpsSnapshot snap;
+  readGpsSnapshot(snap);
+  if (!snap.hasFix) return; // Optional: Only send if we have a fix
 
   // Increment ping counter for this transmission
   gpsData.espNowPingCounter++;
 
-  // webSerialLog("ESP-NOW: Sending ping #" + String(gpsData.espNowPingCounter) + " to " + String(numReceivers) + " receiver(s)");
-
-  GpsEspNowPacket packet;
-  packet.lat = gpsData.lat;
-  packet.lon = gpsData.lon;
-  packet.alt = (float)gpsData.alt;
-  packet.speed = gpsData.speed;
-  packet.heading = gpsData.heading;
-  packet.sats = (uint8_t)gpsData.satellites;
-  packet.satsVisible = (uint8_t)gpsData.satellitesVisible;
-  packet.fixType = gpsData.fixType;
-  strncpy(packet.localTime, gpsData.localTimeStr.c_str(), sizeof(packet.localTime));
-  
-  packet.pdop = gpsData.pdop;
-  packet.hdop = gpsData.hdop;
-  packet.vdop = gpsData.vdop;
-  packet.hAcc = gpsData.hAcc;
-  packet.vAcc = gpsData.vAcc;
-  
-  packet.stationIp = WiFi.localIP();
-  packet.pingCounter = gpsData.espNowPingCounter;
-//  packet.displayPage = gpsData.displayPage; // Use current display page from global state
-
-  // Send to all registered receivers
-  bool anySuccess = false;
-  unsigned long currentTime = millis();
-  
-  for (int i = 0; i < numReceivers; i++) {
-    // Always send to allow auto-reconnection, regardless of current status
-    esp_err_t result = esp_now_send(receiverMacs[i], (uint8_t *) &packet, sizeof(packet));
-    
-    if (result == ESP_OK) {
-      anySuccess = true;
-      // Track successful transmission time for this specific client
-      gpsData.espNowClients[i].lastTransmitTime = currentTime;
-      lastTransmitTimes[i] = currentTime;
-      // webSerialLog("ESP-NOW: Ping sent successfully to client " + String(i + 1));
-    } else {
-      webSerialLog("ESP-NOW: Failed to send ping to client " + String(i + 1));
-    }
-  }
-  
-  if (anySuccess) {
-    gpsData.espNowLastTxTime = currentTime;
+  // The frame every receiver gets: a v3 position message, v2, or v1 (with the group id
+  // appended in broadcast mode)
+  TxFrame frame;
+  if (ESPNOW_PACKET_VERSION >= ESPNOW_PACKET_V3) {
+    static uint8_t pvtSeq = 0;
+    EspNowPosition pos;
+    buildPvt(snap, pos.pvt);
+    pos.time.utcMillis = snap.utcMillis;
+    pos.time.txOffsetUs = 0; // Set by stampFrame
+    frame.len = espNowBuildFragment(frame.data, ESPNOW_MSG_PVT, ESPNOW_BROADCAST_MODE ? ESPNOW_ENV_FLAG_GROUP : 0,
+                                    pvtSeq++, ESPNOW_GROUP_ID, (const uint8_t*)&pos, sizeof(pos), 0);
+    frame.stamped = true;
+    frame.stamp.txMicrosOffset = sizeof(EspNowEnvelope) + offsetof(EspNowPosition, pvt) + offsetof(EspNowPvt, txMicros);
+    frame.stamp.timeRefOffset = snap.utcEpoch != 0 ? sizeof(EspNowEnvelope) + offsetof(EspNowPosition, time) : 0;
+    frame.stamp.utcRefMicros = (uint32_t)snap.utcRefMicros;
+  } else if (ESPNOW_PACKET_VERSION == ESPNOW_PACKET_V2) {
+    buildPacketV2(snap, *(GpsEspNowPacketV2*)frame.data);
+    frame.len = sizeof(GpsEspNowPacketV2);
+    frame.stamped = true;
+    frame.stamp.txMicrosOffset = offsetof(GpsEspNowPacketV2, pvt) + offsetof(EspNowPvt, txMicros);
+    frame.stamp.timeRefOffset = 0;
   } else {
-    gpsData.espNowStatus = "Send Error";
-    gpsData.espNowError = "esp_now_send returned error";
-    webSerialLog("ESP-NOW: All transmissions failed");
+    GpsEspNowGroupPacket* packetV1 = (GpsEspNowGroupPacket*)frame.data;
+    buildPacketV1(snap, packetV1->packet);
+    packetV1->groupId = ESPNOW_GROUP_ID;
+    frame.len = ESPNOW_BROADCAST_MODE ? sizeof(GpsEspNowGroupPacket) : sizeof(GpsEspNowPacket);
+    frame.stamped = false;
   }
+
+  // Newest fix wins: a frame the TX task has not started on is replaced
+  if (uxQueueMessagesWaiting(frameMailbox) > 0) txQueueStats.superseded++;
+  xQueueOverwrite(frameMailbox, &frame);
+  txQueueStats.frames++;
+  xTaskNotify(txTaskHandle, TX_NOTIFY_WORK, eSetBits);
+
+  if (ESPNOW_PACKET_VERSION >= ESPNOW_PACKET_V3) queueBulkMessages(snap);
 }
 
 // Check for client timeouts and update connection status
-// Only considers a client connected if a pong was received within the last 30 seconds
+// A client is connected if a pong was received within the last 30 seconds and, for
+// unicast peers, its frames are still being ACKed at the MAC layer
 void checkEspNowClientTimeouts() {
   unsigned long currentTime = millis();
   int activeClients = 0;
+  int failingClients = 0;
   
-  for (int i = 0; i < numReceivers; i++) {
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    if (!espNowPeerUsed(i)) continue;
     bool wasActive = gpsData.espNowClients[i].isActive;
-    
-    // Client is only considered connected if we received a pong within timeout period
-    if (gpsData.espNowClients[i].lastResponseTime > 0) {
-      unsigned long timeSinceResponse = currentTime - gpsData.espNowClients[i].lastResponseTime;
-      
-      if (timeSinceResponse <= gpsData.espNowTimeoutMs) {
-        // Client is active - pong received within timeout
-        gpsData.espNowClients[i].isActive = true;
-        activeClients++;
-        
-        // Log when client becomes active
-        if (!wasActive) {
-          Serial.printf("Client %d connected (pong received)\n", i + 1);
-          webSerialLog("ESP-NOW: Client " + String(i + 1) + " connected (pong received)");
-        }
+    unsigned long lastResponse = gpsData.espNowClients[i].lastResponseTime;
+    unsigned long timeSinceResponse = currentTime - lastResponse;
+    bool pongRecent = lastResponse > 0 && timeSinceResponse <= gpsData.espNowTimeoutMs;
+
+    // Broadcast frames are never ACKed, so delivery only says something about unicast peers.
+    // Unanswered ACKs show a dead link within a few epochs, long before the pong timeout.
+    EspNowTxStats tx;
+    getEspNowTxStats(i, tx);
+    bool linkFailing = !ESPNOW_BROADCAST_MODE && tx.consecutiveFailures >= ESPNOW_FAILURE_THRESHOLD;
+    if (linkFailing) failingClients++;
+
+    bool isActive = pongRecent && !linkFailing;
+    gpsData.espNowClients[i].isActive = isActive;
+    if (isActive) activeClients++;
+
+    // Log transitions
+    if (isActive && !wasActive) {
+      Serial.printf("Client %d connected (pong received)\n", i + 1);
+      webSerialLog("ESP-NOW: Client " + String(i + 1) + " connected (pong received)");
+    } else if (!isActive && wasActive) {
+      if (linkFailing) {
+        Serial.printf("Client %d disconnected (%u frames not delivered)\n", i + 1, tx.consecutiveFailures);
+        webSerialLog("ESP-NOW: Client " + String(i + 1) + " disconnected (" + String(tx.consecutiveFailures) + " frames not delivered)");
       } else {
-        // Client timed out - no pong within timeout period
-        gpsData.espNowClients[i].isActive = false;
-        
-        // Log when client becomes inactive
-        if (wasActive) {
-          Serial.printf("Client %d disconnected (no pong for %lu ms)\n", i + 1, timeSinceResponse);
-          webSerialLog("ESP-NOW: Client " + String(i + 1) + " disconnected (no pong for " + String(timeSinceResponse / 1000) + "s)");
-        }
+        Serial.printf("Client %d disconnected (no pong for %lu ms)\n", i + 1, timeSinceResponse);
+        webSerialLog("ESP-NOW: Client " + String(i + 1) + " disconnected (no pong for " + String(timeSinceResponse / 1000) + "s)");
       }
-    } else {
-      // Never received a pong from this client - mark as inactive
-      gpsData.espNowClients[i].isActive = false;
     }
   }
   
   // Update overall status
   if (activeClients > 0) {
     char statusBuf[32];
-    snprintf(statusBuf, sizeof(statusBuf), "Connected (%d/%d)", activeClients, numReceivers);
+    snprintf(statusBuf, sizeof(statusBuf), "Connected (%d/%d)", activeClients, countEspNowPeers());
     gpsData.espNowStatus = statusBuf;
   } else {
     gpsData.espNowStatus = "No Clients";
   }
+  gpsData.espNowError = failingClients > 0 ? "Delivery failing to " + String(failingClients) + " client(s)" : "";
 }
 
 // // Set the display page and immediately send an update
@@ -3,8 +3,66 @@
 
 #include "Types.h"
 
+// Per-peer delivery counters: frames handed to esp_now_send, and the outcome the
+// send callback reported for them (MAC-layer ACK for unicast peers)
+struct EspNowTxStats {
+  uint32_t attempted = 0;
+  uint32_t delivered = 0;
+  uint32_t failed = 0;              // Not delivered after all retries
+  uint32_t consecutiveFailures = 0;
+  uint32_t retries = 0;             // Resends after a missing ACK, timeout or driver refusal
+  uint32_t lastLatencyUs = 0;       // esp_now_send -> send callback
+  uint32_t maxLatencyUs = 0;
+  uint32_t lastDeliveredMs = 0;     // millis(); 0 = never
+};
+
+// Transmit queue: GPS frames and control frames drained by the pacing task
+struct EspNowTxQueueStats {
+  uint32_t frames = 0;              // GPS frames handed to the TX task
+  uint32_t superseded = 0;          // Replaced in the mailbox before the task took them
+  uint32_t abandoned = 0;           // Rounds cut short by a newer fix
+  uint32_t noMem = 0;               // esp_now_send: driver queue full
+  uint32_t sendErrors = 0;          // esp_now_send: any other error
+  uint32_t timeouts = 0;            // No send callback within ESPNOW_TX_TIMEOUT_MS
+  uint32_t controlSent = 0;         // Pair acks and other control frames
+  uint32_t bulkQueued = 0;          // v3 sky view, stats and health messages
+  uint32_t bulkSent = 0;            // Completed for every receiver
+  uint32_t bulkSuperseded = 0;      // Replaced by a newer message of the same type mid-send
+};
+
+// Receive path: the Wi-Fi callback only queues frames; serviceEspNowReceive handles them
+struct EspNowRxStats {
+  uint32_t callbacks = 0;
+  uint32_t processed = 0;
+  uint32_t dropped = 0;             // Ring full: the loop task fell behind
+  uint32_t lastCallbackUs = 0;      // Time spent in the receive callback
+  uint32_t maxCallbackUs = 0;
+  uint32_t pongs = 0;               // Matched to a peer; not logged one by one
+  uint32_t unrecognized = 0;        // Unknown size or unknown sender; logged at most every 10 s
+};
+
+// Round trip from a v2 ping to the pong echoing its timestamp
+struct EspNowRttStats {
+  uint32_t samples = 0;
+  uint32_t lastUs = 0;
+  uint32_t minUs = 0;
+  uint32_t meanUs = 0;              // Moving average
+  uint32_t p95Us = 0;               // From the histogram (upper bin edge)
+  uint32_t jitterUs = 0;            // RFC 3550 style smoothed |delta|
+  uint32_t windowSamples = 0;       // Histogram total; halved periodically
+  uint16_t histogram[ESPNOW_RTT_BINS] = {0};
+};
+
 void setupEspNow();
 void sendGpsDataViaEspNow();
 void checkEspNowClientTimeouts();  // Check for client timeouts
+void serviceEspNowReceive();       // Loop task: process queued pongs and announces
+const EspNowRxStats& getEspNowRxStats();
+const EspNowTxQueueStats& getEspNowTxQueueStats();
+bool queueEspNowControlFrame(const uint8_t* mac, const uint8_t* data, size_t len); // Sent ahead of GPS frames; any task
+void getEspNowTxStats(int slot, EspNowTxStats &out); // slot -1 = group broadcast frames
+void resetEspNowPeerStats(int slot); // A new peer took the slot
+const EspNowRttStats& getEspNowRttStats(int slot);
+const uint32_t* getEspNowRttBinEdges(); // ESPNOW_RTT_BINS - 1 upper edges (us)
 
 #endif
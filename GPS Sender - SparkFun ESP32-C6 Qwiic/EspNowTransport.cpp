@@ -0,0 +1,37 @@
+#include <Arduino.h>
+#include <esp_now.h>
+#include "EspNowTransport.h"
+
+// ESP-NOW callbacks run in the Wi-Fi driver task; the handlers only queue or notify
+static void OnDataSent(const wifi_tx_info_t *info, esp_now_send_status_t status) {
+  onEspNowSendComplete(info->des_addr, status == ESP_NOW_SEND_SUCCESS);
+}
+
+static void OnDataReceived(const esp_now_recv_info_t *recv_info, const uint8_t *data, int size) {
+  onEspNowFrameReceived(recv_info->src_addr, data, size);
+}
+
+bool espNowTransportBegin() {
+  if (esp_now_init() != ESP_OK) return false;
+  esp_now_register_send_cb(OnDataSent);
+  esp_now_register_recv_cb(OnDataReceived);
+  return true;
+}
+
+esp_err_t espNowTransportSend(const uint8_t* mac, const uint8_t* data, size_t len) {
+  return esp_now_send(mac, data, len);
+}
+
+bool espNowTransportAddPeer(const uint8_t* mac) {
+  if (esp_now_is_peer_exist(mac)) return true;
+  esp_now_peer_info_t peerInfo;
+  memset(&peerInfo, 0, sizeof(peerInfo));
+  memcpy(peerInfo.peer_addr, mac, 6);
+  peerInfo.channel = 0;  // 0 = use current WiFi channel (works with AP_STA mode)
+  peerInfo.encrypt = false;
+  return esp_now_add_peer(&peerInfo) == ESP_OK;
+}
+
+void espNowTransportRemovePeer(const uint8_t* mac) {
+  esp_now_del_peer(mac);
+}
@@ -0,0 +1,23 @@
+#ifndef ESP_NOW_TRANSPORT_H
+#define ESP_NOW_TRANSPORT_H
+
+#include <Arduino.h>
+#include <esp_now.h>
+
+// The radio under EspNowSender and EspNowPeers. EspNowTransport.cpp maps it onto
+// ESP-NOW; tools/espnow_sim links a loopback with simulated receivers instead, so the
+// sender logic runs unchanged on a PC.
+//
+// Send completions and received frames come back through the two handlers at the
+// bottom, on the transport's own task (the Wi-Fi task on the board). They must not block.
+
+bool espNowTransportBegin();                       // Start the radio and hook up the handlers
+esp_err_t espNowTransportSend(const uint8_t* mac, const uint8_t* data, size_t len); // ESP_ERR_ESPNOW_NO_MEM: driver queue full
+bool espNowTransportAddPeer(const uint8_t* mac);   // True if registered now or already
+void espNowTransportRemovePeer(const uint8_t* mac);
+
+// Implemented in EspNowSender.cpp
+void onEspNowSendComplete(const uint8_t* mac, bool delivered);  // ACKed (or broadcast sent)
+void onEspNowFrameReceived(const uint8_t* mac, const uint8_t* data, int size);
+
+#endif
@@ -23,6 +23,11 @@
 #include "TcpServer.h"
 #include "Storage.h"
 #include "EspNowSender.h"
+#include "EspNowPeers.h"
+#include "GpsSnapshot.h"
+#include "UdpOutput.h"
+#include "UbxPassthrough.h"
+#include "RtcmIngest.h"
 
 // Define Global Instances
 SFE_UBLOX_GNSS myGNSS;
@@ -38,7 +43,8 @@ void setup() {
   initLed();
   webSerialLog("System startup initiated");
   gpsData.startTime = millis();
-  setupGPS();
+  publishGpsSnapshot(); // Readers get the stored stats before the first epoch
+  startGpsTask(); // From here on the GNSS task owns myGNSS and the I2C bus
 
   // Network Init
   webSerialLog("Initializing WiFi in AP+STA mode");
@@ -69,6 +75,9 @@ void setup() {
   setupWeb();
   webSerialLog("Starting TCP server on port " + String(TCP_PORT));
   setupTCP();
+  setupUDP();
+  setupUbxPassthrough();
+  setupRtcm();
   webSerialLog("Initializing ESP-NOW...");
   setupEspNow();
   webSerialLog("System initialization complete");
@@ -86,26 +95,38 @@ void loop() {
     return;
   }
   
-  bool shouldBroadcast = false;
+  // GPS Epoch Handling - the GNSS task hands over one record per navigation solution
+  serviceGpsEvents(); // Module detected/lost, config saved
+  bool newEpoch = false;
+  GpsEpoch epoch;
+  if (receiveGpsEpoch(epoch)) {
+    applyGpsEpoch(epoch);
+    newEpoch = true;
+  } else if (gpsData.gpsInterval > 0 && (millis() - gpsData.lastGPSPoll >= gpsData.gpsInterval)) {
+    // No solutions to wait for: demo data, or keep clients fed while the module is missing
+    if (gpsData.demoMode) {
+      generateDemoData();
+      newEpoch = true;
+    } else if (!gpsData.isConnected) {
+      newEpoch = true;
+    }
+  }
 
-  // GPS Polling Loop
-  if (gpsData.gpsInterval > 0 && (millis() - gpsData.lastGPSPoll >= gpsData.gpsInterval)) {
+  if (newEpoch) {
     gpsData.lastGPSPoll = millis();
-    pollGPS();
     gpsData.cpuTemp = temperatureRead();
+    publishGpsSnapshot(); // Consumers below and in other tasks read this copy
     sendGpsDataViaEspNow();
     checkEspNowClientTimeouts();  // Check for client timeouts after sending
-    shouldBroadcast = true;
-  }
-  
-  // Check for new TCP clients to send immediate data
-  if (hasNewConnections()) {
-    shouldBroadcast = true;
+    broadcastData(); // New TCP clients are served from the cached frame on connect
+    webPublishStatus(); // Dashboards subscribed to /ws/status
   }
 
-  if (shouldBroadcast) {
-    broadcastData();
-  }
+  // Raw UBX bytes arrive from the GNSS task whenever the module sends them
+  pumpUbxPassthrough();
+  serviceRtcm(); // NTRIP caster (re)connects
+  serviceEspNowReceive(); // Pongs and announces queued by the ESP-NOW callback
+  serviceEspNowPeers(); // Pairing requests, evictions, NVS writes
   
   // WiFi connection management
   static bool connectedPrinted = false;
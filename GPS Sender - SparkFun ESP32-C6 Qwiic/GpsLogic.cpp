@@ -7,6 +7,8 @@
 #include "LedControl.h"
 #include "Storage.h"
 #include "WebServer.h"
+#include "UbxPassthrough.h"
+#include "RtcmIngest.h"
 
 void syncSystemTimeFromGPS() {
   // Validate GPS data is reasonable before syncing
@@ -46,28 +48,182 @@ void syncSystemTimeFromGPS() {
   }
 }
 
-void setupGPS() {
-  webSerialLog("Initializing I2C for GPS module");
-  Wire.begin(I2C_SDA, I2C_SCL);
-  Wire.setClock(400000);
+// Unix time from a UTC calendar date in integer math (days-from-civil), unlike mktime
+// it ignores the TZ setting
+static uint32_t unixTimeFromUtc(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t min, uint8_t sec) {
+  int32_t y = year - (month <= 2 ? 1 : 0);
+  int32_t era = y / 400;
+  int32_t yoe = y - era * 400;
+  int32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  int32_t days = era * 146097 + doe - 719468;
+  return (uint32_t)days * 86400 + hour * 3600 + min * 60 + sec;
+}
+
+// Latest auto-message frames, copied by the callbacks below.
+// checkCallbacks() runs them on the GNSS task, so plain copies are safe.
+static UBX_NAV_PVT_data_t latestPVT;
+static UBX_NAV_DOP_data_t latestDOP;
+static uint8_t latestNumSvs = 0;
+static uint8_t latestSatCount = 0;
+static SatInfo latestSats[GPS_SAT_TABLE_MAX];
+static bool pvtPending = false;
+static bool dopPending = false;
+static bool satPending = false;
+
+// Wire for the GNSS module that counts what actually crosses the bus. The u-blox library
+// only moves data through these virtuals (TwoWire::write(buf, len) and endTransmission()
+// forward to the overloads below), so polls skipped by its polling gate cost nothing here.
+class CountingWire : public TwoWire {
+public:
+  explicit CountingWire(uint8_t bus) : TwoWire(bus) {}
+
+  int read() override {
+    int c = TwoWire::read();
+    if (c >= 0) {
+      bytes++;
+      if (TwoWire::available() == 0) transactions++; // Library reads every requestFrom() out completely
+    }
+    return c;
+  }
+
+  size_t write(uint8_t data) override {
+    size_t n = TwoWire::write(data);
+    bytes += n;
+    return n;
+  }
+
+  uint8_t endTransmission(bool sendStop) override {
+    transactions++;
+    return TwoWire::endTransmission(sendStop);
+  }
+
+  uint32_t bytes = 0;          // Payload bytes read and written (GNSS task only)
+  uint32_t transactions = 0;   // Register writes, RTCM/command writes and completed reads
+};
+static CountingWire gnssWire(0);
+static uint32_t epochBusBytes = 0;        // gnssWire counters when the previous epoch was handed over
+static uint32_t epochBusTransactions = 0;
+
+// GNSS task state; the loop task learns about changes through gpsEvents
+static bool moduleConnected = false;
+static bool almanacSaved = false;
+static int64_t lastPvtMicros = 0;         // 0 until the first solution, and after a rate change
+static int64_t lastContactMicros = 0;     // Last PVT, (re)connect or rate change: the lost-module clock
+
+static void onNavPVT(UBX_NAV_PVT_data_t *pvt) {
+  latestPVT = *pvt;
+  pvtPending = true;
+}
+
+static void onNavDOP(UBX_NAV_DOP_data_t *dop) {
+  latestDOP = *dop;
+  dopPending = true;
+}
+
+static void onNavSAT(UBX_NAV_SAT_data_t *sat) {
+  latestNumSvs = sat->header.numSvs;
+  latestSatCount = latestNumSvs < GPS_SAT_TABLE_MAX ? latestNumSvs : GPS_SAT_TABLE_MAX;
+  for (int i = 0; i < latestSatCount; i++) {
+    const UBX_NAV_SAT_block_t &block = sat->blocks[i];
+    SatInfo &info = latestSats[i];
+    info.gnssId = block.gnssId;
+    info.svId = block.svId;
+    info.cno = block.cno;
+    info.elev = block.elev;
+    info.azim = block.azim;
+    info.quality = block.flags.bits.qualityInd;
+    info.health = block.flags.bits.health;
+    info.used = block.flags.bits.svUsed;
+  }
+  satPending = true;
+}
+
+// ================= GNSS TASK EVENTS =================
+// gpsData and the web log belong to the loop task, so the GNSS task only posts what happened
+enum GpsTaskEvent : uint8_t {
+  GPS_EVT_DETECTED,
+  GPS_EVT_NOT_DETECTED,
+  GPS_EVT_LOST,
+  GPS_EVT_RATE_CHANGED,
+  GPS_EVT_CONFIG_SAVED
+};
+static QueueHandle_t gpsEvents = NULL;
+
+static void postGpsEvent(GpsTaskEvent event) {
+  uint8_t code = event;
+  xQueueSend(gpsEvents, &code, 0);
+}
+
+void serviceGpsEvents() {
+  if (gpsEvents == NULL) return;
+  uint8_t code;
+  while (xQueueReceive(gpsEvents, &code, 0) == pdTRUE) {
+    switch (code) {
+      case GPS_EVT_DETECTED:
+        gpsData.isConnected = true;
+        Serial.println(F("u-blox GNSS connected"));
+        webSerialLog("u-blox GNSS module connected successfully");
+        webSerialLog("GPS configured - Update rate: " + String(gpsData.gpsInterval) + "ms");
+        break;
+      case GPS_EVT_NOT_DETECTED:
+        gpsData.isConnected = false;
+        Serial.println(F("u-blox GNSS not detected. Check wiring!"));
+        webSerialLog("ERROR: u-blox GNSS not detected on I2C");
+        break;
+      case GPS_EVT_LOST:
+        gpsData.isConnected = false;
+        gpsData.hasFix = false; // The last solution is going stale
+        Serial.println(F("u-blox GNSS stopped responding"));
+        webSerialLog("ERROR: u-blox GNSS lost (no solution for " + String(GPS_LOST_INTERVALS) + " intervals), retrying");
+        break;
+      case GPS_EVT_RATE_CHANGED:
+        Serial.print(F("GPS Rate updated to: "));
+        Serial.println(gpsData.gpsInterval);
+        webSerialLog("GPS update rate changed to " + String(gpsData.gpsInterval) + "ms");
+        break;
+      case GPS_EVT_CONFIG_SAVED:
+        gpsData.configSaved = true;
+        Serial.println("Fix Obtained! Almanac saved to Battery Backup");
+        webSerialLog("GPS configuration saved to backup");
+        break;
+    }
+  }
+}
+
+// GNSS task only
+static bool beginGnss() {
+  gnssWire.begin(I2C_SDA, I2C_SCL);
+  gnssWire.setClock(400000);
   
   // Increase I2C buffer for large NAV-SAT messages
   myGNSS.setPacketCfgPayloadSize(1024);
 
-  if (myGNSS.begin(Wire, 0x42) == false) {
-    Serial.println(F("u-blox GNSS not detected. Check wiring!"));
-    webSerialLog("ERROR: u-blox GNSS not detected on I2C");
-    gpsData.isConnected = false;
-  } else {
-    Serial.println(F("u-blox GNSS connected"));
-    webSerialLog("u-blox GNSS module connected successfully");
-    gpsData.isConnected = true;
-    
-    myGNSS.setI2COutput(COM_TYPE_UBX); 
-    myGNSS.setMeasurementRate(gpsData.gpsInterval);
-    myGNSS.setAutoNAVSAT(true);
-    webSerialLog("GPS configured - Update rate: " + String(gpsData.gpsInterval) + "ms");
+  // Raw passthrough copies of the logged frames (must be sized before begin())
+  if (UBX_RAW_ENABLED) myGNSS.setFileBufferSize(UBX_RAW_FILE_BUFFER);
+
+  if (myGNSS.begin(gnssWire, 0x42) == false) {
+    postGpsEvent(GPS_EVT_NOT_DETECTED);
+    return false;
   }
+
+  myGNSS.setI2COutput(COM_TYPE_UBX); 
+  if (RTCM_INPUT_ENABLED) myGNSS.setI2CInput(COM_TYPE_UBX | COM_TYPE_RTCM3);
+  myGNSS.setMeasurementRate(gpsData.gpsInterval);
+  // The task paces its own polls around each epoch; keep the library's polling gate out of the way
+  myGNSS.setI2CpollingWait(1);
+  // Let the module push PVT, DOP and SAT every epoch instead of polling per field
+  myGNSS.setAutoPVTcallbackPtr(&onNavPVT);
+  myGNSS.setAutoDOPcallbackPtr(&onNavDOP);
+  myGNSS.setAutoNAVSATcallbackPtr(&onNavSAT);
+  if (UBX_RAW_ENABLED) {
+    // Also keep the complete frames for the raw UBX port; the callbacks are unaffected
+    myGNSS.logNAVPVT();
+    myGNSS.logNAVDOP();
+    myGNSS.logNAVSAT();
+  }
+  postGpsEvent(GPS_EVT_DETECTED);
+  return true;
 }
 
 void generateDemoData() {
@@ -119,12 +275,27 @@ void generateDemoData() {
   gpsData.vdop = 1.2;
   gpsData.hAcc = 2.5;
   gpsData.vAcc = 3.0;
+
+  gpsData.latE7 = (int32_t)(demoLat * 1e7);
+  gpsData.lonE7 = (int32_t)(demoLon * 1e7);
+  gpsData.heightMm = (int32_t)(demoAlt * 1000);
+  gpsData.gSpeedMmS = (int32_t)(demoSpeed * 1000);
+  gpsData.headMotE5 = (int32_t)(demoHeading * 100000);
+  gpsData.pdopE2 = 150;
+  gpsData.hdopE2 = 90;
+  gpsData.vdopE2 = 120;
+  gpsData.hAccMm = 2500;
+  gpsData.vAccMm = 3000;
   
   // Set time to current system time
   unsigned long seconds = (now / 1000) % 86400;
   gpsData.hour = (seconds / 3600) % 24;
   gpsData.minute = (seconds % 3600) / 60;
   gpsData.second = seconds % 60;
+  gpsData.utcEpoch = seconds; // Demo clock: uptime from 1970-01-01
+  gpsData.utcMillis = now % 1000;
+  gpsData.utcRefMicros = esp_timer_get_time();
+  gpsData.timezoneOffsetMinutes = 0;
   
   char timeBuf[12];
   snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d:%02d", gpsData.hour, gpsData.minute, gpsData.second);
@@ -137,58 +308,54 @@ void generateDemoData() {
   }
 }
 
-void pollGPS() {
-  // If demo mode is active, generate fake data instead
-  if (gpsData.demoMode) {
-    generateDemoData();
-    return;
-  }
-  
-  if (!gpsData.isConnected) {
-    static unsigned long lastRetry = 0;
-    if (millis() - lastRetry > 5000) {
-      lastRetry = millis();
-      setupGPS();
-    }
-    return;
-  }
-  
-  static unsigned long lastInterval = 0;
-  if (lastInterval != gpsData.gpsInterval) {
-    myGNSS.setMeasurementRate(gpsData.gpsInterval);
-    lastInterval = gpsData.gpsInterval;
-    Serial.print(F("GPS Rate updated to: "));
-    Serial.println(lastInterval);
-    webSerialLog("GPS update rate changed to " + String(lastInterval) + "ms");
+// Fill gpsData from one epoch record (NAV-PVT plus the latest DOP/SAT frames) in a single pass.
+// Runs on the loop task, so NVS writes in Storage never hold up acquisition.
+// esp_timer at the solution time from the TIMEPULSE edge of its UTC second, or 0 when no edge fits.
+// The edge has to precede the read by less than half a second, which rules out stale edges (the
+// module stops pulsing without a fix) and the edge of the following second.
+static int64_t timepulseReference(const GpsEpoch &epoch, int32_t millisPart) {
+  for (int i = 0; i < 2; i++) {
+    if (epoch.ppsMicros[i] == 0) continue;
+    int64_t ref = epoch.ppsMicros[i] + (int64_t)millisPart * 1000;
+    int64_t delayUs = epoch.rxMicros - ref;
+    if (delayUs >= 0 && delayUs < 500000) return ref;
   }
+  return 0;
+}
+
+void applyGpsEpoch(const GpsEpoch &epoch) {
+  const UBX_NAV_PVT_data_t &pvt = epoch.pvt;
 
-  while(myGNSS.checkUblox()); 
-  myGNSS.checkCallbacks();
+  gpsData.i2cBytesPerEpoch = epoch.i2cBytes;
+  gpsData.i2cTransactionsPerEpoch = epoch.i2cTransactions;
 
   // If LED Mode is Blink on Read
   if (gpsData.ledMode == LED_BLINK_ON_GPS_READ) triggerLed();
 
-  long lat = myGNSS.getLatitude();
-  long lon = myGNSS.getLongitude();
-  long alt = myGNSS.getAltitude();
-  long altMSL = myGNSS.getAltitudeMSL();
-  byte sats = myGNSS.getSIV();
-  byte fixType = myGNSS.getFixType();
-  bool gnssFixOk = myGNSS.getGnssFixOk();
+  byte sats = pvt.numSV;
+  byte fixType = pvt.fixType;
+  bool gnssFixOk = pvt.flags.bits.gnssFixOK;
+  bool timeValid = pvt.valid.bits.validTime;
+  bool dateValid = pvt.valid.bits.validDate;
 
   gpsData.satellites = sats;
   storage.updateSats(sats);
 
-  if (myGNSS.getDOP()){
-    gpsData.pdop = myGNSS.getPositionDOP() / 100.0;
-    gpsData.hdop = myGNSS.getHorizontalDOP() / 100.0;
-    gpsData.vdop = myGNSS.getVerticalDOP() / 100.0;
+  if (epoch.hasDOP) {
+    gpsData.pdop = epoch.dop.pDOP / 100.0;
+    gpsData.hdop = epoch.dop.hDOP / 100.0;
+    gpsData.vdop = epoch.dop.vDOP / 100.0;
+    gpsData.pdopE2 = epoch.dop.pDOP;
+    gpsData.hdopE2 = epoch.dop.hDOP;
+    gpsData.vdopE2 = epoch.dop.vDOP;
     storage.updateDOP(gpsData.pdop, gpsData.hdop, gpsData.vdop);
   }
   
-  // Get Visible Satellites (from NAV SAT)
-  if (myGNSS.getNAVSAT()) {
-    gpsData.satellitesVisible = myGNSS.packetUBXNAVSAT->data.header.numSvs;
+  // Visible Satellites (from NAV SAT)
+  if (epoch.hasSAT) {
+    gpsData.satellitesVisible = epoch.numSvs;
+    gpsData.satCount = epoch.satCount;
+    memcpy(gpsData.sats, epoch.sats, epoch.satCount * sizeof(SatInfo));
     storage.updateVisibleSats(gpsData.satellitesVisible);
   }
 
@@ -203,13 +370,6 @@ void pollGPS() {
     webSerialLog("GPS fix acquired");
     webSerialLog("Satellites: " + String(sats));
     webSerialLog("TTFF: " + String(gpsData.ttffSeconds) + "s");
-    
-    if (!gpsData.configSaved) {
-      Serial.println("Fix Obtained! Saving Almanac to Battery Backup...");
-      webSerialLog("Saving GPS configuration to backup...");
-      myGNSS.saveConfiguration(); 
-      gpsData.configSaved = true;
-    }
   }
   
   switch(fixType) {
@@ -223,10 +383,10 @@ void pollGPS() {
   if (gpsData.hasFix) {
     if (gpsData.ledMode == LED_BLINK_ON_FIX) triggerLed();
 
-    gpsData.lat = lat / 10000000.0;
-    gpsData.lon = lon / 10000000.0;
-    gpsData.alt = alt / 1000.0;
-    gpsData.altMSL = altMSL / 1000.0;
+    gpsData.lat = pvt.lat / 10000000.0;
+    gpsData.lon = pvt.lon / 10000000.0;
+    gpsData.alt = pvt.height / 1000.0;
+    gpsData.altMSL = pvt.hMSL / 1000.0;
     
     storage.updateAlt(gpsData.alt);
 
@@ -239,20 +399,28 @@ void pollGPS() {
     gpsData.lastLat = gpsData.lat;
     gpsData.lastLon = gpsData.lon;
 
-    gpsData.speed = myGNSS.getGroundSpeed() / 1000.0;
+    gpsData.speed = pvt.gSpeed / 1000.0;
     storage.updateSpeed(gpsData.speed);
     
-    gpsData.heading = myGNSS.getHeading() / 100000.0; 
+    gpsData.heading = pvt.headMot / 100000.0; 
     
-    gpsData.hAcc = myGNSS.getHorizontalAccEst() / 1000.0;
-    gpsData.vAcc = myGNSS.getVerticalAccEst() / 1000.0;
+    gpsData.hAcc = pvt.hAcc / 1000.0;
+    gpsData.vAcc = pvt.vAcc / 1000.0;
+
+    gpsData.latE7 = pvt.lat;
+    gpsData.lonE7 = pvt.lon;
+    gpsData.heightMm = pvt.height;
+    gpsData.gSpeedMmS = pvt.gSpeed;
+    gpsData.headMotE5 = pvt.headMot;
+    gpsData.hAccMm = pvt.hAcc;
+    gpsData.vAccMm = pvt.vAcc;
     storage.updateAcc(gpsData.hAcc, gpsData.vAcc);
   }
 
-  if (myGNSS.getTimeValid()) {
-    gpsData.hour = myGNSS.getHour();
-    gpsData.minute = myGNSS.getMinute();
-    gpsData.second = myGNSS.getSecond();
+  if (timeValid) {
+    gpsData.hour = pvt.hour;
+    gpsData.minute = pvt.min;
+    gpsData.second = pvt.sec;
     char timeBuf[12];
     snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d:%02d", gpsData.hour, gpsData.minute, gpsData.second);
     gpsData.timeStr = String(timeBuf);
@@ -276,10 +444,28 @@ void pollGPS() {
     }
   }
   
-  if (myGNSS.getDateValid()) {
-    gpsData.year = myGNSS.getYear();
-    gpsData.month = myGNSS.getMonth();
-    gpsData.day = myGNSS.getDay();
+  gpsData.utcEpoch = (timeValid && dateValid)
+      ? unixTimeFromUtc(pvt.year, pvt.month, pvt.day, pvt.hour, pvt.min, pvt.sec) : 0;
+  if (gpsData.utcEpoch != 0) {
+    // nano is the signed fraction to add to hour:min:sec; fold it into whole milliseconds
+    int32_t millisPart = pvt.nano / 1000000;
+    if (pvt.nano < 0 && pvt.nano % 1000000 != 0) millisPart--;
+    if (millisPart < 0) {
+      gpsData.utcEpoch--;
+      millisPart += 1000;
+    } else if (millisPart >= 1000) {
+      gpsData.utcEpoch++;
+      millisPart -= 1000;
+    }
+    gpsData.utcMillis = millisPart;
+    int64_t ppsRef = timepulseReference(epoch, millisPart);
+    gpsData.utcRefMicros = ppsRef != 0 ? ppsRef : epoch.rxMicros - (int64_t)GPS_PVT_LATENCY_MS * 1000;
+  }
+
+  if (dateValid) {
+    gpsData.year = pvt.year;
+    gpsData.month = pvt.month;
+    gpsData.day = pvt.day;
     char dateBuf[12];
     snprintf(dateBuf, sizeof(dateBuf), "%04d-%02d-%02d", gpsData.year, gpsData.month, gpsData.day);
     gpsData.dateStr = String(dateBuf);
@@ -287,13 +473,13 @@ void pollGPS() {
   
   // Sync system time from GPS only once at first fix
   if (gpsData.hadFirstFix && !gpsData.timeSynced) {
-    if (myGNSS.getTimeValid() && myGNSS.getDateValid()) {
+    if (timeValid && dateValid) {
       syncSystemTimeFromGPS();
     } else {
-      webSerialLog("Debug: Fix acquired but time/date not valid yet. Time: " + String(myGNSS.getTimeValid()) + " Date: " + String(myGNSS.getDateValid()));
+      webSerialLog("Debug: Fix acquired but time/date not valid yet. Time: " + String(timeValid) + " Date: " + String(dateValid));
     }
   }
-  
+
   // Periodic status logging to web console (every 60 seconds if fix acquired)
   static unsigned long lastWebLog = 0;
   if (gpsData.hasFix && (millis() - lastWebLog >= 60000)) {
@@ -306,3 +492,190 @@ void pollGPS() {
     webSerialLog(statusLog);
   }
 }
+
+// ================= GNSS ACQUISITION TASK =================
+// The task owns myGNSS and the I2C bus; everything else sees epoch records only.
+static QueueHandle_t epochQueue = NULL;
+static TaskHandle_t gpsTaskHandle = NULL;
+static GpsTaskStats taskStats;
+
+// TIMEPULSE rising edges, latched in the ISR. The module aligns them to the top of each UTC second.
+static portMUX_TYPE ppsMux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t ppsEdgeMicros[2] = {0, 0};
+
+static void IRAM_ATTR onTimepulse() {
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL_ISR(&ppsMux);
+  ppsEdgeMicros[1] = ppsEdgeMicros[0];
+  ppsEdgeMicros[0] = now;
+  taskStats.ppsEdges++;
+  portEXIT_CRITICAL_ISR(&ppsMux);
+}
+
+// Track how closely epoch arrival follows the module's own epoch clock (iTOW)
+static void updateJitterStats(const GpsEpoch &epoch) {
+  static int64_t lastRxMicros = 0;
+  static uint32_t lastITOW = 0;
+
+  taskStats.epochs++;
+  if (lastRxMicros != 0 && epoch.pvt.iTOW > lastITOW) {
+    int64_t rxDelta = epoch.rxMicros - lastRxMicros;
+    int64_t towDelta = (int64_t)(epoch.pvt.iTOW - lastITOW) * 1000;
+    int32_t jitter = (int32_t)(rxDelta - towDelta);
+    int32_t absJitter = jitter < 0 ? -jitter : jitter;
+
+    taskStats.lastIntervalMs = (uint32_t)(rxDelta / 1000);
+    taskStats.lastJitterUs = jitter;
+    if (absJitter > taskStats.maxJitterUs) taskStats.maxJitterUs = absJitter;
+    // Exponential moving average, 1/16 weight per epoch
+    taskStats.meanJitterUs += (absJitter - (int32_t)taskStats.meanJitterUs) / 16;
+  }
+  lastRxMicros = epoch.rxMicros;
+  lastITOW = epoch.pvt.iTOW;
+}
+
+static void pollGPS() {
+  static unsigned long lastInterval = 0;
+  if (!moduleConnected) {
+    static unsigned long lastRetry = 0;
+    if (lastRetry != 0 && millis() - lastRetry < 5000) return;
+    lastRetry = millis();
+    moduleConnected = beginGnss();
+    lastInterval = gpsData.gpsInterval;
+    lastContactMicros = esp_timer_get_time();
+    return;
+  }
+  
+  if (lastInterval != gpsData.gpsInterval) {
+    myGNSS.setMeasurementRate(gpsData.gpsInterval);
+    myGNSS.setI2CpollingWait(1);
+    lastInterval = gpsData.gpsInterval;
+    lastPvtMicros = 0; // Poll closely until the first solution at the new rate
+    lastContactMicros = esp_timer_get_time();
+    postGpsEvent(GPS_EVT_RATE_CHANGED);
+  }
+
+  // Corrections first, so the module has them before its next solution
+  pushRtcmCorrections();
+
+  // Drain everything the module has queued; the callbacks copy out the frames. Each read is
+  // stamped before it starts, and the read that brings in NAV-PVT keeps its stamp.
+  int64_t pvtReadMicros = 0;
+  for (;;) {
+    int64_t readMicros = esp_timer_get_time();
+    if (!myGNSS.checkUblox()) break;
+    myGNSS.checkCallbacks();
+    if (pvtPending && pvtReadMicros == 0) pvtReadMicros = readMicros;
+  }
+  serviceUbxPassthrough();
+
+  if (!pvtPending) {
+    // The module sends a PVT every epoch, fix or not: a long silence means it is gone.
+    // Drop it so the retry path above runs beginGnss() again.
+    int64_t lostAfterUs = (int64_t)gpsData.gpsInterval * 1000 * GPS_LOST_INTERVALS;
+    if (esp_timer_get_time() - lastContactMicros > lostAfterUs) {
+      moduleConnected = false;
+      lastPvtMicros = 0;
+      postGpsEvent(GPS_EVT_LOST);
+    }
+    return; // No new navigation solution since the last poll
+  }
+  pvtPending = false;
+
+  GpsEpoch epoch;
+  epoch.rxMicros = pvtReadMicros != 0 ? pvtReadMicros : esp_timer_get_time();
+  lastPvtMicros = epoch.rxMicros;
+  lastContactMicros = epoch.rxMicros;
+  portENTER_CRITICAL(&ppsMux);
+  epoch.ppsMicros[0] = ppsEdgeMicros[0];
+  epoch.ppsMicros[1] = ppsEdgeMicros[1];
+  portEXIT_CRITICAL(&ppsMux);
+  epoch.pvt = latestPVT;
+  epoch.dop = latestDOP;
+  epoch.hasDOP = dopPending;
+  epoch.numSvs = latestNumSvs;
+  epoch.hasSAT = satPending;
+  epoch.satCount = latestSatCount;
+  memcpy(epoch.sats, latestSats, latestSatCount * sizeof(SatInfo));
+  dopPending = false;
+  satPending = false;
+
+  // Bus traffic since the previous epoch, as counted by gnssWire
+  epoch.i2cBytes = gnssWire.bytes - epochBusBytes;
+  epoch.i2cTransactions = gnssWire.transactions - epochBusTransactions;
+  epochBusBytes = gnssWire.bytes;
+  epochBusTransactions = gnssWire.transactions;
+
+  updateJitterStats(epoch);
+
+  // Save almanac to battery backup once, on the first good fix
+  if (!almanacSaved && epoch.pvt.fixType >= 2 && epoch.pvt.flags.bits.gnssFixOK) {
+    myGNSS.saveConfiguration(); 
+    almanacSaved = true;
+    postGpsEvent(GPS_EVT_CONFIG_SAVED);
+  }
+
+  // Newest epoch wins if the loop task has not picked up the previous one
+  if (uxQueueMessagesWaiting(epochQueue) > 0) taskStats.epochsOverwritten++;
+  xQueueOverwrite(epochQueue, &epoch);
+}
+
+// Sleep until shortly before the next NAV-PVT is due, then poll every GPS_TASK_POLL_MS until
+// it has been read. The bus stays quiet between epochs whatever the measurement rate.
+static TickType_t gpsTaskSleepTicks() {
+  if (gpsData.demoMode || gpsData.gpsInterval == 0 || !moduleConnected) return pdMS_TO_TICKS(GPS_TASK_IDLE_MS);
+  if (lastPvtMicros == 0) return pdMS_TO_TICKS(GPS_TASK_POLL_MS);
+
+  int64_t intervalUs = (int64_t)gpsData.gpsInterval * 1000;
+  int64_t sinceUs = esp_timer_get_time() - lastPvtMicros;
+  int64_t pollFromUs = intervalUs - intervalUs / 8;
+  if (sinceUs < pollFromUs) {
+    TickType_t ticks = pdMS_TO_TICKS((pollFromUs - sinceUs) / 1000);
+    return ticks > 0 ? ticks : 1;
+  }
+  // Solutions stopped coming: fall back to a quarter of the interval, as the library would
+  if (sinceUs > 2 * intervalUs && gpsData.gpsInterval / 4 > GPS_TASK_POLL_MS) {
+    return pdMS_TO_TICKS(gpsData.gpsInterval / 4);
+  }
+  return pdMS_TO_TICKS(GPS_TASK_POLL_MS);
+}
+
+static void gpsTask(void *param) {
+  for (;;) {
+    // Demo mode and a zero interval both pause acquisition
+    if (!gpsData.demoMode && gpsData.gpsInterval > 0) {
+      pollGPS();
+    } else {
+      lastContactMicros = esp_timer_get_time(); // Not listening, so silence means nothing
+    }
+    taskStats.stackFree = uxTaskGetStackHighWaterMark(NULL);
+    // RTCM frames and UBX commands for the module end the sleep early (wakeGpsTask)
+    ulTaskNotifyTake(pdTRUE, gpsTaskSleepTicks());
+  }
+}
+
+void wakeGpsTask() {
+  if (gpsTaskHandle != NULL) xTaskNotifyGive(gpsTaskHandle);
+}
+
+void startGpsTask() {
+  webSerialLog("Initializing I2C for GPS module");
+  if (GPS_PPS_PIN >= 0) {
+    pinMode(GPS_PPS_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(GPS_PPS_PIN), onTimepulse, RISING);
+    webSerialLog("TIMEPULSE reference on GPIO " + String(GPS_PPS_PIN));
+  }
+  epochQueue = xQueueCreate(1, sizeof(GpsEpoch));
+  gpsEvents = xQueueCreate(4, sizeof(uint8_t));
+  xTaskCreate(gpsTask, "gnss", GPS_TASK_STACK_SIZE, NULL, GPS_TASK_PRIORITY, &gpsTaskHandle);
+  webSerialLog("GNSS task started (priority " + String(GPS_TASK_PRIORITY) + ", stack " + String(GPS_TASK_STACK_SIZE) + ")");
+}
+
+bool receiveGpsEpoch(GpsEpoch &epoch) {
+  if (epochQueue == NULL) return false;
+  return xQueueReceive(epochQueue, &epoch, 0) == pdTRUE;
+}
+
+const GpsTaskStats& getGpsTaskStats() {
+  return taskStats;
+}
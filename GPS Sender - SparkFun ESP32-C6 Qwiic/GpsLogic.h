@@ -1,8 +1,43 @@
 #ifndef GPS_LOGIC_H
 #define GPS_LOGIC_H
 
-void setupGPS();
-void pollGPS();
+#include <SparkFun_u-blox_GNSS_Arduino_Library.h>
+#include "Types.h"
+
+// One navigation solution, produced by the GNSS task and consumed by loop()
+struct GpsEpoch {
+  int64_t rxMicros = 0;          // esp_timer time the I2C read that delivered the PVT frame started
+  int64_t ppsMicros[2] = {0, 0}; // Latest TIMEPULSE rising edge and the one before (0 = none)
+  UBX_NAV_PVT_data_t pvt;
+  UBX_NAV_DOP_data_t dop;
+  bool hasDOP = false;
+  uint8_t numSvs = 0;            // From NAV-SAT
+  bool hasSAT = false;
+  uint8_t satCount = 0;          // Rows in sats (numSvs capped at GPS_SAT_TABLE_MAX)
+  SatInfo sats[GPS_SAT_TABLE_MAX];
+  uint32_t i2cBytes = 0;
+  uint32_t i2cTransactions = 0;
+};
+
+// Acquisition timing, updated by the GNSS task
+struct GpsTaskStats {
+  uint32_t epochs = 0;
+  uint32_t epochsOverwritten = 0; // Epochs replaced before loop() consumed them
+  uint32_t lastIntervalMs = 0;
+  int32_t lastJitterUs = 0;       // Arrival interval minus iTOW interval
+  int32_t maxJitterUs = 0;
+  int32_t meanJitterUs = 0;       // Moving average of |jitter|
+  uint32_t stackFree = 0;         // Stack high-water mark (bytes)
+  uint32_t ppsEdges = 0;          // TIMEPULSE rising edges seen (GPS_PPS_PIN)
+};
+
+void startGpsTask();               // The task brings up the module and owns myGNSS and the I2C bus
+void wakeGpsTask();                // Data queued for the module (RTCM, UBX commands)
+bool receiveGpsEpoch(GpsEpoch &epoch);
+void serviceGpsEvents();           // Loop task: module detected/lost, rate changes, config saved
+void applyGpsEpoch(const GpsEpoch &epoch);
+void generateDemoData();
 void syncSystemTimeFromGPS();
+const GpsTaskStats& getGpsTaskStats();
 
 #endif
@@ -0,0 +1,101 @@
+#include <Arduino.h>
+#include <atomic>
+#include "GpsSnapshot.h"
+#include "Context.h"
+
+// Seqlock over two slots. The writer fills the slot readers are not using and
+// then bumps the sequence; the current slot is (sequence & 1). A reader only
+// retries if a whole publish completed while it was copying.
+static GpsSnapshot slots[2];
+static std::atomic<uint32_t> sequence(0);
+
+static void copyString(char *dest, size_t size, const String &src) {
+  strncpy(dest, src.c_str(), size - 1);
+  dest[size - 1] = '\0';
+}
+
+void publishGpsSnapshot() {
+  uint32_t next = sequence.load(std::memory_order_relaxed) + 1;
+  GpsSnapshot &snap = slots[next & 1];
+
+  snap.version = next;
+  snap.publishedAt = millis();
+
+  snap.isConnected = gpsData.isConnected;
+  snap.hasFix = gpsData.hasFix;
+  snap.hadFirstFix = gpsData.hadFirstFix;
+  snap.demoMode = gpsData.demoMode;
+  snap.fixType = gpsData.fixType;
+  copyString(snap.fixStatus, sizeof(snap.fixStatus), gpsData.fixStatus);
+  snap.satellites = gpsData.satellites;
+  snap.satellitesVisible = gpsData.satellitesVisible;
+  snap.ttffSeconds = gpsData.ttffSeconds;
+
+  snap.lat = gpsData.lat;
+  snap.lon = gpsData.lon;
+  snap.alt = gpsData.alt;
+  snap.altMSL = gpsData.altMSL;
+  snap.speed = gpsData.speed;
+  snap.heading = gpsData.heading;
+  snap.pdop = gpsData.pdop;
+  snap.hdop = gpsData.hdop;
+  snap.vdop = gpsData.vdop;
+  snap.hAcc = gpsData.hAcc;
+  snap.vAcc = gpsData.vAcc;
+
+  snap.latE7 = gpsData.latE7;
+  snap.lonE7 = gpsData.lonE7;
+  snap.heightMm = gpsData.heightMm;
+  snap.gSpeedMmS = gpsData.gSpeedMmS;
+  snap.headMotE5 = gpsData.headMotE5;
+  snap.pdopE2 = gpsData.pdopE2;
+  snap.hdopE2 = gpsData.hdopE2;
+  snap.vdopE2 = gpsData.vdopE2;
+  snap.hAccMm = gpsData.hAccMm;
+  snap.vAccMm = gpsData.vAccMm;
+  snap.utcEpoch = gpsData.utcEpoch;
+  snap.utcMillis = gpsData.utcMillis;
+  snap.utcRefMicros = gpsData.utcRefMicros;
+
+  copyString(snap.timeStr, sizeof(snap.timeStr), gpsData.timeStr);
+  copyString(snap.dateStr, sizeof(snap.dateStr), gpsData.dateStr);
+  copyString(snap.localTimeStr, sizeof(snap.localTimeStr), gpsData.localTimeStr);
+  snap.hour = gpsData.hour;
+  snap.minute = gpsData.minute;
+  snap.second = gpsData.second;
+  snap.year = gpsData.year;
+  snap.month = gpsData.month;
+  snap.day = gpsData.day;
+  snap.timezoneOffsetMinutes = gpsData.timezoneOffsetMinutes;
+
+  snap.cpuTemp = gpsData.cpuTemp;
+  snap.i2cBytesPerEpoch = gpsData.i2cBytesPerEpoch;
+  snap.i2cTransactionsPerEpoch = gpsData.i2cTransactionsPerEpoch;
+
+  snap.altMin = gpsData.altMin;
+  snap.altMax = gpsData.altMax;
+  snap.speedMax = gpsData.speedMax;
+  snap.satellitesMax = gpsData.satellitesMax;
+  snap.satellitesVisibleMax = gpsData.satellitesVisibleMax;
+  snap.pdopMin = gpsData.pdopMin;
+  snap.hdopMin = gpsData.hdopMin;
+  snap.vdopMin = gpsData.vdopMin;
+  snap.hAccMin = gpsData.hAccMin;
+  snap.vAccMin = gpsData.vAccMin;
+
+  // Make the slot contents visible before readers can select it
+  sequence.store(next, std::memory_order_release);
+}
+
+void readGpsSnapshot(GpsSnapshot &out) {
+  for (;;) {
+    uint32_t before = sequence.load(std::memory_order_acquire);
+    memcpy(&out, &slots[before & 1], sizeof(GpsSnapshot));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) == before) return;
+  }
+}
+
+uint32_t gpsSnapshotVersion() {
+  return sequence.load(std::memory_order_acquire);
+}
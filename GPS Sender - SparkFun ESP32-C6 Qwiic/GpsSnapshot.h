@@ -0,0 +1,14 @@
+#ifndef GPS_SNAPSHOT_H
+#define GPS_SNAPSHOT_H
+
+#include "Types.h"
+
+// Single-writer / multi-reader publication of GPS epochs.
+// The loop task publishes after each epoch; AsyncTCP, web server and ESP-NOW
+// code read a coherent copy without taking a lock.
+
+void publishGpsSnapshot();                 // Writer: copy current gpsData (loop task only)
+void readGpsSnapshot(GpsSnapshot &out);    // Reader: lock-free, retries if a publish races the copy
+uint32_t gpsSnapshotVersion();             // Cheap check for "anything new since version X"
+
+#endif
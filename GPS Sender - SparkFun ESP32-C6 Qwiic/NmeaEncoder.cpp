@@ -0,0 +1,193 @@
+#include <Arduino.h>
+#include "NmeaEncoder.h"
+#include "Config.h"
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+static const uint32_t POW10[] = {1, 10, 100, 1000, 10000};
+
+// num / den rounded to nearest, halves away from zero (den > 0)
+static int32_t divRound(int64_t num, int64_t den) {
+  return (int32_t)(num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den));
+}
+
+// Speed from mm/s in hundredths; 1 kn = 1852/3600 m/s exactly
+static int32_t knotsE2(int32_t mmS) { return divRound((int64_t)mmS * 90, 463); }
+static int32_t kmhE2(int32_t mmS) { return divRound((int64_t)mmS * 9, 25); }
+
+NmeaWriter::NmeaWriter(char* dest, size_t cap) : dest(dest), cap(cap) {}
+
+void NmeaWriter::put(char c) {
+  if (len < cap) {
+    dest[len++] = c;
+    checksum ^= (uint8_t)c;
+  } else {
+    overflow = true;
+  }
+}
+
+void NmeaWriter::begin(const char* type) {
+  sentenceStart = len;
+  overflow = false;
+  put('$');
+  checksum = 0; // '$' is not part of the checksum
+  text(type);
+}
+
+void NmeaWriter::field() {
+  put(',');
+}
+
+void NmeaWriter::text(const char* s) {
+  while (*s) put(*s++);
+}
+
+void NmeaWriter::chr(char c) {
+  put(c);
+}
+
+void NmeaWriter::number(uint32_t value, uint8_t width) {
+  char digits[10];
+  uint8_t n = 0;
+  do {
+    digits[n++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  while (width > n) {
+    put('0');
+    width--;
+  }
+  while (n > 0) put(digits[--n]);
+}
+
+void NmeaWriter::integer(int32_t value) {
+  if (value < 0) put('-');
+  number(value < 0 ? 0u - (uint32_t)value : (uint32_t)value, 1);
+}
+
+void NmeaWriter::fixed(int32_t scaled, uint8_t decimals) {
+  if (scaled < 0) put('-');
+  uint32_t magnitude = scaled < 0 ? 0u - (uint32_t)scaled : (uint32_t)scaled;
+  number(magnitude / POW10[decimals], 1);
+  if (decimals > 0) {
+    put('.');
+    number(magnitude % POW10[decimals], decimals);
+  }
+}
+
+void NmeaWriter::coord(int32_t degE7, bool isLon) {
+  uint32_t magnitude = degE7 < 0 ? 0u - (uint32_t)degE7 : (uint32_t)degE7;
+  uint32_t deg = magnitude / 10000000;
+  // 1e-7 deg -> 1e-4 minutes is x 6/100; at most 59999994 before rounding, so 32 bits suffice
+  uint32_t minE4 = ((magnitude % 10000000) * 6 + 50) / 100;
+  if (minE4 >= 600000) { // 59.99995' and up round to the next degree
+    minE4 -= 600000;
+    deg++;
+  }
+  number(deg, isLon ? 3 : 2);
+  number(minE4 / 10000, 2);
+  put('.');
+  number(minE4 % 10000, 4);
+}
+
+bool NmeaWriter::end() {
+  uint8_t cs = checksum;
+  put('*');
+  put(HEX_DIGITS[cs >> 4]);
+  put(HEX_DIGITS[cs & 0x0F]);
+  put('\r');
+  put('\n');
+  if (overflow) {
+    len = sentenceStart; // Never leave half a sentence in the buffer
+    return false;
+  }
+  return true;
+}
+
+// --- Sentences ---
+
+static void timeField(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.number(snap.hour, 2);
+  w.number(snap.minute, 2);
+  w.number(snap.second, 2);
+  w.text(".00");
+}
+
+static void positionFields(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.field(); w.coord(snap.latE7, false);
+  w.field(); w.chr(snap.latE7 >= 0 ? 'N' : 'S');
+  w.field(); w.coord(snap.lonE7, true);
+  w.field(); w.chr(snap.lonE7 >= 0 ? 'E' : 'W');
+}
+
+void nmeaRMC(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.begin("GPRMC");
+  w.field(); timeField(w, snap);
+  w.field(); w.chr(snap.hasFix ? 'A' : 'V');
+  positionFields(w, snap);
+  w.field(); w.fixed(knotsE2(snap.gSpeedMmS), 2);
+  w.field(); w.fixed(divRound(snap.headMotE5, 1000), 2);
+  w.field(); w.number(snap.day, 2); w.number(snap.month, 2); w.number(snap.year % 100, 2);
+  w.text(",,,");
+  w.end();
+}
+
+void nmeaGGA(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.begin("GPGGA");
+  w.field(); timeField(w, snap);
+  positionFields(w, snap);
+  w.field(); w.chr(snap.hasFix ? '1' : '0');
+  w.field(); w.integer(snap.satellites);
+  w.field(); w.fixed(snap.hdopE2, 2);
+  w.field(); w.fixed(divRound(snap.heightMm, 10), 2);
+  w.text(",M,0.0,M,,");
+  w.end();
+}
+
+void nmeaGSA(NmeaWriter& w, const GpsSnapshot& snap) {
+  int mode = 1; // Default No Fix
+  if (snap.fixType == 2) mode = 2; // 2D
+  if (snap.fixType == 3) mode = 3; // 3D
+
+  w.begin("GPGSA");
+  w.text(",A,");
+  w.integer(mode);
+  w.text(",,,,,,,,,,,,,");
+  w.fixed(snap.pdopE2, 2);
+  w.field(); w.fixed(snap.hdopE2, 2);
+  w.field(); w.fixed(snap.vdopE2, 2);
+  w.end();
+}
+
+void nmeaVTG(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.begin("GPVTG");
+  w.field(); w.fixed(divRound(snap.headMotE5, 1000), 2);
+  w.text(",T,,M,");
+  w.fixed(knotsE2(snap.gSpeedMmS), 2);
+  w.text(",N,");
+  w.fixed(kmhE2(snap.gSpeedMmS), 2);
+  w.text(",K,");
+  w.chr(snap.hasFix ? 'A' : 'N');
+  w.end();
+}
+
+void nmeaZDA(NmeaWriter& w, const GpsSnapshot& snap) {
+  w.begin("GPZDA");
+  w.field(); timeField(w, snap);
+  w.field(); w.number(snap.day, 2);
+  w.field(); w.number(snap.month, 2);
+  w.field(); w.number(snap.year, 4);
+  w.text(",00,00"); // Local zone: always UTC
+  w.end();
+}
+
+size_t renderNmeaEpoch(char* dest, size_t cap, const GpsSnapshot& snap) {
+  NmeaWriter w(dest, cap);
+  nmeaRMC(w, snap);
+  nmeaGGA(w, snap);
+  nmeaGSA(w, snap);
+#if NMEA_EXTENDED_SENTENCES
+  nmeaVTG(w, snap);
+  nmeaZDA(w, snap);
+#endif
+  return w.length();
+}
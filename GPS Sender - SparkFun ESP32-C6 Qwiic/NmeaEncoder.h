@@ -0,0 +1,48 @@
+#ifndef NMEA_ENCODER_H
+#define NMEA_ENCODER_H
+
+#include "Types.h"
+
+// NMEA 0183 sentence writer over a caller-supplied buffer.
+// Numbers come in as scaled integers (the UBX units kept in GpsSnapshot) and are
+// emitted as fixed-point digits; the XOR checksum is accumulated as each character
+// is written - no heap, no printf, no floating point.
+class NmeaWriter {
+public:
+  NmeaWriter(char* dest, size_t cap);
+
+  void begin(const char* type);                 // '$' + talker/type, restarts the checksum
+  void field();                                 // ',' separator
+  void text(const char* s);
+  void chr(char c);
+  void number(uint32_t value, uint8_t width);   // Zero-padded to at least width digits ("%0*u")
+  void integer(int32_t value);                  // "%d"
+  void fixed(int32_t scaled, uint8_t decimals); // scaled / 10^decimals as "%.*f", decimals <= 4
+  void coord(int32_t degE7, bool isLon);        // ddmm.mmmm / dddmm.mmmm, hemisphere is a separate field
+  bool end();                                   // "*CS\r\n"; drops the sentence and returns false if it did not fit
+
+  size_t length() const { return len; }
+
+private:
+  void put(char c);
+
+  char* dest;
+  size_t cap;
+  size_t len = 0;
+  size_t sentenceStart = 0;
+  uint8_t checksum = 0;
+  bool overflow = false;
+};
+
+// Append one sentence built from a published epoch
+void nmeaRMC(NmeaWriter& w, const GpsSnapshot& snap);
+void nmeaGGA(NmeaWriter& w, const GpsSnapshot& snap);
+void nmeaGSA(NmeaWriter& w, const GpsSnapshot& snap);
+void nmeaVTG(NmeaWriter& w, const GpsSnapshot& snap);
+void nmeaZDA(NmeaWriter& w, const GpsSnapshot& snap);
+
+// The block sent to NMEA clients each epoch: RMC, GGA, GSA
+// (followed by VTG and ZDA when NMEA_EXTENDED_SENTENCES is set). Returns bytes written.
+size_t renderNmeaEpoch(char* dest, size_t cap, const GpsSnapshot& snap);
+
+#endif
@@ -0,0 +1,81 @@
+#include "RtcmFramer.h"
+
+// Bitwise CRC-24Q (poly 0x1864CFB). A few KB/s of corrections do not justify a table.
+uint32_t crc24q(const uint8_t* data, size_t len) {
+  uint32_t crc = 0;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint32_t)data[i] << 16;
+    for (int bit = 0; bit < 8; bit++) {
+      crc <<= 1;
+      if (crc & 0x1000000) crc ^= 0x1864CFB;
+    }
+  }
+  return crc & 0xFFFFFF;
+}
+
+// Add one byte, found at stream position pos, to the candidate frame. Returns false
+// when the candidate turns out not to be a frame; its bytes are left in place for rtcmResync.
+static bool framerAdd(RtcmFramer& f, uint8_t b, uint32_t pos) {
+  uint8_t* frame = f.msg + RTCM_MSG_PREFIX;
+  if (f.len == 0) {
+    if (b != RTCM_PREAMBLE) return true;
+    f.candidateStart = pos;
+  }
+  frame[f.len++] = b;
+
+  if (f.len == RTCM_HEADER_LEN) {
+    if (frame[1] & 0xFC) return false; // Reserved bits set: not a frame start
+    f.need = RTCM_HEADER_LEN + (((frame[1] & 0x03) << 8) | frame[2]) + RTCM_CRC_LEN;
+  }
+  if (f.len >= RTCM_HEADER_LEN && f.len == f.need) {
+    size_t payloadEnd = f.need - RTCM_CRC_LEN;
+    uint32_t crc = ((uint32_t)frame[payloadEnd] << 16) | ((uint32_t)frame[payloadEnd + 1] << 8) | frame[payloadEnd + 2];
+    if (crc24q(frame, payloadEnd) != crc) {
+      // A stray 0xD3 inside a frame already counted is debris, not another bad frame
+      if ((int32_t)(f.candidateStart - f.countedEnd) >= 0) {
+        f.crcErrors++;
+        f.countedEnd = f.candidateStart + f.need;
+      }
+      return false;
+    }
+    if (f.onFrame) f.onFrame(f);
+    f.len = 0;
+  }
+  return true;
+}
+
+// The candidate was not a frame, but a real one may start inside it (a corrupted
+// length swallows the frames after it). Feed its bytes again from the next preamble
+// after the false one, repeating until they are all accounted for. The candidate's
+// bytes are always the last f.len bytes of the stream, so their positions are known.
+static void rtcmResync(RtcmFramer& f) {
+  uint8_t* frame = f.msg + RTCM_MSG_PREFIX;
+  while (f.len > 0) {
+    uint8_t* next = (uint8_t*)memchr(frame + 1, RTCM_PREAMBLE, f.len - 1);
+    if (next == NULL) {
+      f.len = 0;
+      break;
+    }
+    size_t count = f.len - (next - frame);
+    uint32_t base = f.fed - count;
+    memmove(frame, next, count);
+    f.len = 0;
+    // The framer never writes ahead of the byte being replayed, so this is in place
+    size_t i = 0;
+    while (i < count && framerAdd(f, frame[i], base + i)) i++;
+    if (i == count) break;
+    // Another false start: keep its bytes and append the ones not replayed yet
+    memmove(frame + f.len, frame + i + 1, count - i - 1);
+    f.len += count - i - 1;
+  }
+}
+
+void rtcmFeed(RtcmFramer& f, const uint8_t* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (!framerAdd(f, data[i], f.fed++)) rtcmResync(f);
+  }
+}
+
+void rtcmReset(RtcmFramer& f) {
+  f.len = 0;
+}
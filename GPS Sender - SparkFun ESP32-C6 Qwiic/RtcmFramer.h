@@ -0,0 +1,33 @@
+#ifndef RTCM_FRAMER_H
+#define RTCM_FRAMER_H
+
+#include <Arduino.h>
+
+// RTCM3 frame: 0xD3, 6 reserved bits + 10-bit payload length, payload, CRC-24Q
+#define RTCM_PREAMBLE 0xD3
+#define RTCM_HEADER_LEN 3
+#define RTCM_CRC_LEN 3
+#define RTCM_MAX_FRAME (RTCM_HEADER_LEN + 1023 + RTCM_CRC_LEN)
+#define RTCM_MSG_PREFIX 4 // Room ahead of the frame for the caller's receive timestamp
+
+// Reassembles RTCM3 frames from a byte stream that may be cut anywhere. Bytes
+// outside a frame are skipped up to the next preamble. When a candidate frame fails
+// (reserved bits set or bad CRC, e.g. a corrupted length), the framer rescans
+// the bytes after its preamble. A real frame that the bad length swallowed is
+// still found. One framer per source, so two sources never splice each other's frames.
+struct RtcmFramer {
+  uint8_t msg[RTCM_MSG_PREFIX + RTCM_MAX_FRAME]; // Prefix, then the candidate frame as received
+  uint16_t len = 0;                // Candidate bytes collected
+  uint16_t need = 0;               // Full frame length once the header is in
+  uint32_t crcErrors = 0;          // Candidates that failed CRC, less those starting inside one already counted
+  uint32_t fed = 0;                // Stream position: bytes fed so far
+  uint32_t candidateStart = 0;     // Stream position of the candidate's preamble
+  uint32_t countedEnd = 0;         // End of the last candidate counted in crcErrors
+  void (*onFrame)(RtcmFramer& f) = NULL; // Each good frame: need bytes at msg + RTCM_MSG_PREFIX
+};
+
+uint32_t crc24q(const uint8_t* data, size_t len);
+void rtcmFeed(RtcmFramer& f, const uint8_t* data, size_t len);
+void rtcmReset(RtcmFramer& f); // Drop any partial frame, e.g. when a new source connects
+
+#endif
@@ -0,0 +1,220 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <AsyncTCP.h>
+#include <atomic>
+#include <base64.h>
+#include <freertos/message_buffer.h>
+#include "RtcmIngest.h"
+#include "RtcmFramer.h"
+#include "Config.h"
+#include "Context.h"
+#include "WebServer.h"
+#include "GpsSnapshot.h"
+#include "GpsLogic.h"
+#include "NmeaEncoder.h"
+
+static RtcmStats rtcmStats;
+
+// Each message is [uint32 rx time (esp_timer, low 32 bits)][frame]; the buffer keeps
+// frames whole, so the module never sees a partial one. Written only from the
+// async_tcp task, read only by the GNSS task.
+static MessageBufferHandle_t rtcmBuffer = NULL;
+
+// ================= FRAMING =================
+// One per source, so a TCP pusher and the caster can never splice each other's frames
+static RtcmFramer inputFramer;
+static RtcmFramer ntripFramer;
+
+// A frame passed CRC: stamp it and queue it for the GNSS task
+static void rtcmQueueFrame(RtcmFramer& f) {
+  uint8_t* frame = f.msg + RTCM_MSG_PREFIX;
+  rtcmStats.frames++;
+  if (f.need > RTCM_HEADER_LEN + RTCM_CRC_LEN + 1) {
+    rtcmStats.lastMessageType = ((uint16_t)frame[3] << 4) | (frame[4] >> 4);
+  }
+
+  // Bounded: a frame that does not fit is dropped whole, never split
+  size_t msgLen = RTCM_MSG_PREFIX + f.need;
+  if (xMessageBufferSpacesAvailable(rtcmBuffer) < msgLen + sizeof(size_t)) {
+    rtcmStats.dropped++;
+    return;
+  }
+  uint32_t rxMicros = (uint32_t)esp_timer_get_time();
+  memcpy(f.msg, &rxMicros, sizeof(rxMicros));
+  xMessageBufferSend(rtcmBuffer, f.msg, msgLen, 0);
+  wakeGpsTask();
+}
+
+// ================= TCP INPUT PORT =================
+static AsyncServer rtcmServer(RTCM_INPUT_PORT);
+static AsyncClient* inputClient = NULL; // async_tcp task only
+
+static void handleRtcmClient(void* arg, AsyncClient* client) {
+  String clientIP = client->remoteIP().toString();
+  if (inputClient != NULL) {
+    webSerialLog("RTCM input rejected, already fed by " + inputClient->remoteIP().toString() + ": " + clientIP);
+    client->onDisconnect([](void* arg, AsyncClient* c) { delete c; }, NULL);
+    client->close();
+    return;
+  }
+  webSerialLog("RTCM input connected: " + clientIP);
+  inputClient = client;
+  rtcmReset(inputFramer);
+  rtcmStats.inputConnected = true;
+
+  client->onData([](void* arg, AsyncClient* c, void* data, size_t len) {
+    rtcmFeed(inputFramer, (const uint8_t*)data, len);
+  }, NULL);
+  client->onDisconnect([](void* arg, AsyncClient* c) {
+    webSerialLog("RTCM input disconnected: " + c->remoteIP().toString());
+    inputClient = NULL;
+    rtcmStats.inputConnected = false;
+    delete c;
+  }, NULL);
+}
+
+// ================= NTRIP CLIENT =================
+#define NTRIP_IDLE 0
+#define NTRIP_CONNECTING 1   // Request sent, waiting for the caster's status line
+#define NTRIP_STREAMING 2
+
+static std::atomic<uint8_t> ntripState(NTRIP_IDLE);
+static char ntripStatus[64];       // Caster status line as it arrives
+static uint8_t ntripStatusLen = 0;
+static unsigned long lastNtripAttempt = 0;
+static unsigned long lastGgaSent = 0;
+
+static void ntripSendRequest(AsyncClient* c) {
+  // NTRIP 1.0: the caster answers "ICY 200 OK" and then streams raw RTCM
+  String request = "GET /" + String(NTRIP_MOUNTPOINT) + " HTTP/1.0\r\n";
+  request += "User-Agent: NTRIP ESP32-NINA-GPS/1.0\r\n";
+  if (NTRIP_USER[0] != '\0') {
+    request += "Authorization: Basic " + base64::encode(String(NTRIP_USER) + ":" + String(NTRIP_PASS)) + "\r\n";
+  }
+  request += "\r\n";
+  c->write(request.c_str(), request.length());
+}
+
+// Casters serving VRS or nearest-base streams need to know where the rover is
+static void ntripSendGga(AsyncClient* c) {
+  if (NTRIP_GGA_INTERVAL_MS == 0 || millis() - lastGgaSent < NTRIP_GGA_INTERVAL_MS) return;
+  GpsSnapshot snap;
+  readGpsSnapshot(snap);
+  if (!snap.hasFix) return;
+  lastGgaSent = millis();
+  char gga[96];
+  NmeaWriter w(gga, sizeof(gga));
+  nmeaGGA(w, snap);
+  c->write(gga, w.length());
+}
+
+static void handleNtripData(void* arg, AsyncClient* c, void* data, size_t len) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  if (ntripState.load() == NTRIP_CONNECTING) {
+    bool lineDone = false;
+    size_t i = 0;
+    while (i < len && !lineDone) {
+      char ch = bytes[i++];
+      if (ch == '\n') lineDone = true;
+      else if (ntripStatusLen < sizeof(ntripStatus) - 1) ntripStatus[ntripStatusLen++] = ch;
+    }
+    if (!lineDone) return; // Status line continues in the next segment
+    ntripStatus[ntripStatusLen] = '\0';
+
+    // "ICY 200 OK" (NTRIP 1.0) or "HTTP/1.x 200 OK"; a sourcetable reply means a bad mountpoint
+    if (strstr(ntripStatus, " 200") == NULL) {
+      webSerialLog("NTRIP caster refused /" + String(NTRIP_MOUNTPOINT) + ": " + String(ntripStatus));
+      c->close();
+      return;
+    }
+    webSerialLog("NTRIP streaming from " + String(NTRIP_HOST) + "/" + String(NTRIP_MOUNTPOINT));
+    ntripState.store(NTRIP_STREAMING);
+    rtcmStats.ntripConnected = true;
+    rtcmStats.ntripConnects++;
+    lastGgaSent = millis() - NTRIP_GGA_INTERVAL_MS; // Report the position straight away
+    ntripSendGga(c);
+    bytes += i; // Remaining header lines are skipped by the framer
+    len -= i;
+  }
+  rtcmFeed(ntripFramer, bytes, len);
+}
+
+static void ntripConnect() {
+  AsyncClient* c = new AsyncClient();
+  if (c == NULL) return;
+  ntripStatusLen = 0;
+  rtcmReset(ntripFramer);
+  ntripState.store(NTRIP_CONNECTING);
+
+  c->onConnect([](void* arg, AsyncClient* c) { ntripSendRequest(c); }, NULL);
+  c->onData(&handleNtripData, NULL);
+  c->onPoll([](void* arg, AsyncClient* c) {
+    if (ntripState.load() == NTRIP_STREAMING) ntripSendGga(c);
+  }, NULL);
+  // AsyncTCP also calls this after a failed connect, so it is the one place the client is freed
+  c->onDisconnect([](void* arg, AsyncClient* c) {
+    if (rtcmStats.ntripConnected) webSerialLog("NTRIP caster disconnected");
+    rtcmStats.ntripConnected = false;
+    delete c;
+    ntripState.store(NTRIP_IDLE);
+  }, NULL);
+
+  if (!c->connect(NTRIP_HOST, NTRIP_PORT)) {
+    delete c;
+    ntripState.store(NTRIP_IDLE);
+  }
+}
+
+void setupRtcm() {
+  if (!RTCM_INPUT_ENABLED) return;
+  rtcmBuffer = xMessageBufferCreate(RTCM_BUFFER_SIZE);
+  inputFramer.onFrame = &rtcmQueueFrame;
+  ntripFramer.onFrame = &rtcmQueueFrame;
+  rtcmServer.onClient(&handleRtcmClient, NULL);
+  rtcmServer.begin();
+  webSerialLog("RTCM input on port " + String(RTCM_INPUT_PORT));
+  if (NTRIP_HOST[0] != '\0') {
+    webSerialLog("NTRIP client for " + String(NTRIP_HOST) + ":" + String(NTRIP_PORT) + "/" + String(NTRIP_MOUNTPOINT));
+  }
+}
+
+void serviceRtcm() {
+  if (!RTCM_INPUT_ENABLED || NTRIP_HOST[0] == '\0') return;
+  if (ntripState.load() != NTRIP_IDLE || WiFi.status() != WL_CONNECTED) return;
+  if (lastNtripAttempt != 0 && millis() - lastNtripAttempt < NTRIP_RETRY_MS) return;
+  lastNtripAttempt = millis();
+  ntripConnect();
+}
+
+void pushRtcmCorrections() {
+  if (rtcmBuffer == NULL) return;
+  static uint8_t msg[RTCM_MSG_PREFIX + RTCM_MAX_FRAME]; // GNSS task only
+  static unsigned long windowStart = 0;
+  static uint32_t windowBytes = 0;
+
+  size_t len;
+  while ((len = xMessageBufferReceive(rtcmBuffer, msg, sizeof(msg), 0)) > 4) {
+    myGNSS.pushRawData(msg + 4, len - 4);
+
+    uint32_t rxMicros;
+    memcpy(&rxMicros, msg, sizeof(rxMicros));
+    uint32_t latency = (uint32_t)esp_timer_get_time() - rxMicros;
+    rtcmStats.lastLatencyUs = latency;
+    if (latency > rtcmStats.maxLatencyUs) rtcmStats.maxLatencyUs = latency;
+    rtcmStats.pushed++;
+    rtcmStats.bytesPushed += len - 4;
+    rtcmStats.lastPushMs = millis();
+    windowBytes += len - 4;
+  }
+
+  if (millis() - windowStart >= 1000) {
+    rtcmStats.bytesPerSec = windowBytes;
+    windowBytes = 0;
+    windowStart = millis();
+  }
+}
+
+const RtcmStats& getRtcmStats() {
+  rtcmStats.crcErrors = inputFramer.crcErrors + ntripFramer.crcErrors;
+  return rtcmStats;
+}
@@ -0,0 +1,31 @@
+#ifndef RTCM_INGEST_H
+#define RTCM_INGEST_H
+
+#include <Arduino.h>
+
+// RTCM3 corrections for RTK-capable modules (ZED-F9P etc.), taken from a TCP input
+// port and/or an NTRIP caster. Frames are checked (CRC-24Q) on the async_tcp task,
+// queued whole in a bounded message buffer, and written to the module over I2C by
+// the GNSS task, which owns the bus.
+struct RtcmStats {
+  uint32_t frames = 0;            // Good frames received
+  uint32_t crcErrors = 0;
+  uint32_t dropped = 0;           // Good frames discarded because the buffer was full
+  uint32_t pushed = 0;            // Frames written to the module
+  uint64_t bytesPushed = 0;
+  uint32_t bytesPerSec = 0;       // I2C write throughput over the last second
+  uint16_t lastMessageType = 0;
+  uint32_t lastPushMs = 0;        // millis() of the last frame written; 0 = none yet
+  uint32_t lastLatencyUs = 0;     // Frame complete on the network -> written to the module
+  uint32_t maxLatencyUs = 0;
+  bool inputConnected = false;    // A client is pushing to RTCM_INPUT_PORT
+  bool ntripConnected = false;    // Caster accepted the mountpoint request
+  uint32_t ntripConnects = 0;
+};
+
+void setupRtcm();                 // Network side, after WiFi
+void serviceRtcm();               // Loop task: NTRIP (re)connects
+void pushRtcmCorrections();       // GNSS task: write queued frames to the module
+const RtcmStats& getRtcmStats();
+
+#endif
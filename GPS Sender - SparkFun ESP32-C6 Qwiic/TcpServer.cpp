@@ -1,205 +1,886 @@
 #include <Arduino.h>
 #include <AsyncTCP.h>
-#include <vector>
+#include <atomic>
+#include <new>
 #include "TcpServer.h"
 #include "Config.h"
 #include "Context.h"
 #include "WebServer.h"
+#include "GpsSnapshot.h"
+#include "NmeaEncoder.h"
+#include "UdpOutput.h"
 
 AsyncServer tcpServer(TCP_PORT);
 
+// ================= SHARED BROADCAST FRAMES =================
+// Each epoch is rendered once into a pooled buffer laid out as [NMEA][TPV SKY], so
+// any mix of subscriptions is one contiguous slice. Clients are handed slices with
+// no-copy writes, and the buffer stays referenced until every client has ACKed its bytes.
+struct BroadcastFrame {
+  std::atomic<int> refs;
+  bool fromHeap;          // Pool was exhausted and this frame had to be allocated
+  uint16_t nmeaLen;
+  uint16_t jsonLen;       // TPV + SKY lines
+  char data[TCP_FRAME_SIZE];
+};
+static BroadcastFrame framePool[TCP_FRAME_POOL_SIZE];
+static TcpBroadcastStats broadcastStats;
+
+static BroadcastFrame* acquireFrame() {
+  for (int i = 0; i < TCP_FRAME_POOL_SIZE; i++) {
+    int expected = 0;
+    if (framePool[i].refs.compare_exchange_strong(expected, 1)) {
+      framePool[i].fromHeap = false;
+      return &framePool[i];
+    }
+  }
+  // Every pooled frame is still held by unacknowledged client data
+  BroadcastFrame* frame = new (std::nothrow) BroadcastFrame();
+  if (frame == NULL) return NULL;
+  frame->refs.store(1);
+  frame->fromHeap = true;
+  return frame;
+}
+
+static void retainFrame(BroadcastFrame* frame) {
+  frame->refs.fetch_add(1);
+}
+
+static void releaseFrame(BroadcastFrame* frame) {
+  if (frame->refs.fetch_sub(1) == 1 && frame->fromHeap) {
+    delete frame;
+  }
+}
+
+// Bytes written to a client but not yet ACKed, oldest first.
+// frame is NULL for copied writes that hold no buffer.
+struct InFlightWrite {
+  BroadcastFrame* frame;
+  uint16_t remaining;
+};
+
+// An epoch waiting for a client that could not take it yet, oldest first
+struct QueuedFrame {
+  BroadcastFrame* frame;
+  uint16_t offset;          // Slice of the frame this client subscribes to
+  uint16_t len;
+  unsigned long queuedAt;   // millis()
+};
+
+// Report formats a client can receive
+#define FORMAT_NMEA 0x01
+#define FORMAT_JSON 0x02
+
+// gpsd WATCH settings, as last sent by the client
+struct GpsdWatch {
+  bool enable = false;
+  bool json = false;      // TPV and SKY reports
+  bool nmea = false;      // NMEA sentences
+  uint8_t raw = 0;        // NMEA is this device's raw form, so raw >= 1 also means NMEA
+};
+
 struct ClientContext {
   AsyncClient* client;
-  bool isGpsd = false; 
+  bool isGpsd = false;      // Has sent at least one gpsd command
+  GpsdWatch watch;
+  InFlightWrite inFlight[TCP_CLIENT_INFLIGHT];
+  uint8_t inFlightHead = 0;
+  uint8_t inFlightCount = 0;
+  QueuedFrame queue[TCP_CLIENT_QUEUE_DEPTH];
+  uint8_t queueHead = 0;
+  uint8_t queueCount = 0;
+  uint32_t framesQueued = 0;
+  uint32_t framesSent = 0;
+  uint32_t framesDropped = 0;
+
+  // Command line being reassembled across TCP segments
+  char line[TCP_CMD_MAX_LEN];
+  uint16_t lineLen = 0;
+  bool lineTooLong = false;       // Discard up to the next terminator
+  unsigned long rateWindowStart = 0;
+  uint8_t rateCount = 0;          // Commands accepted in the current one-second window
+  uint32_t commands = 0;
+  uint32_t commandsRejected = 0;  // Over-long, over the rate cap, the command queue or the send queue
+
+  int64_t connectedAt = 0;        // esp_timer time of accept
+  bool firstByteSent = false;
 };
-std::vector<ClientContext> clients;
-SemaphoreHandle_t clientsMutex = NULL;
-volatile bool newClientConnected = false;
-volatile bool pendingBroadcast = false;
+
+// ================= CLIENT SLOTS =================
+// Fixed table of TCP_MAX_CLIENTS slots. The state word packs a generation counter
+// with the slot state, so a slot is claimed or retired with one atomic operation,
+// and callbacks carry a handle (index + generation) that stops matching once the
+// slot is reused. Work on a slot is serialised by a try-lock nobody waits on: a
+// task that finds the slot busy posts its work (ACKed bytes, the newest frame,
+// commands, a disconnect) and the holder applies it before letting go.
+#define SLOT_FREE 0
+#define SLOT_CLAIMED 1            // Being set up by the accept callback
+#define SLOT_ACTIVE 2
+#define SLOT_STATE(word) ((word) & 0x3)
+#define SLOT_GEN(word) ((word) >> 2)
+
+static_assert((TCP_CMD_QUEUE_DEPTH & (TCP_CMD_QUEUE_DEPTH - 1)) == 0, "TCP_CMD_QUEUE_DEPTH must be a power of two");
+
+struct ClientSlot {
+  std::atomic<uint32_t> state;
+  std::atomic<bool> busy;
+  std::atomic<uint8_t> formats;              // clientFormats(ctx), readable without the slot
+
+  // Work posted for whoever holds the slot next
+  std::atomic<uint32_t> postedAcks;
+  std::atomic<BroadcastFrame*> postedFrame;  // Newest epoch not yet queued
+  std::atomic<bool> postedClose;
+  std::atomic<uint32_t> postedDropped;       // Epochs replaced in postedFrame before they were queued
+
+  // Complete command lines, oldest first. Only the AsyncTCP task advances
+  // commandTail; whoever holds the slot runs them and advances commandHead.
+  std::atomic<uint8_t> commandHead;
+  std::atomic<uint8_t> commandTail;
+  char command[TCP_CMD_QUEUE_DEPTH][TCP_CMD_MAX_LEN];
+  uint16_t commandLen[TCP_CMD_QUEUE_DEPTH];
+
+  // Closed client whose slot has been retired. Whoever retires the slot parks it
+  // here; only the AsyncTCP task frees it (collectRetiredClients).
+  std::atomic<AsyncClient*> retiredClient;
+
+  ClientContext ctx;
+
+  // Copy of ctx's counters, refreshed by the holder under statsMux for readers
+  // that must not take the slot
+  TcpClientStats stats;
+  unsigned long oldestQueuedAt;
+};
+static ClientSlot slots[TCP_MAX_CLIENTS];
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Last epoch's frame, kept so a new connection is served at once without a
+// re-render or a broadcast
+static BroadcastFrame* cachedFrame = NULL;
+static portMUX_TYPE cacheMux = portMUX_INITIALIZER_UNLOCKED;
+static TcpConnectStats connectStats;
+
+// Queue one write on a client and remember it until ACKed. Caller holds the slot.
+// With a frame the bytes are referenced in place; without one they are copied.
+static bool clientWrite(ClientContext& ctx, BroadcastFrame* frame, const char* data, size_t len) {
+  if (len == 0) return true;
+  if (ctx.inFlightCount >= TCP_CLIENT_INFLIGHT || ctx.client->space() < len) return false;
+
+  size_t added = ctx.client->add(data, len, frame ? 0 : ASYNC_WRITE_FLAG_COPY);
+  if (added != len) return false; // space() said yes, so this only fails on a dead pcb
+  ctx.client->send();
+
+  if (frame) retainFrame(frame);
+  uint8_t slot = (ctx.inFlightHead + ctx.inFlightCount) % TCP_CLIENT_INFLIGHT;
+  ctx.inFlight[slot].frame = frame;
+  ctx.inFlight[slot].remaining = len;
+  ctx.inFlightCount++;
+  return true;
+}
+
+// Retire ACKed writes, releasing their frames. Caller holds the slot.
+static void clientAcked(ClientContext& ctx, size_t len) {
+  while (len > 0 && ctx.inFlightCount > 0) {
+    InFlightWrite& head = ctx.inFlight[ctx.inFlightHead];
+    size_t step = len < head.remaining ? len : head.remaining;
+    head.remaining -= step;
+    len -= step;
+    if (head.remaining == 0) {
+      if (head.frame) releaseFrame(head.frame);
+      ctx.inFlightHead = (ctx.inFlightHead + 1) % TCP_CLIENT_INFLIGHT;
+      ctx.inFlightCount--;
+    }
+  }
+}
+
+static void clientPopQueued(ClientContext& ctx) {
+  releaseFrame(ctx.queue[ctx.queueHead].frame);
+  ctx.queueHead = (ctx.queueHead + 1) % TCP_CLIENT_QUEUE_DEPTH;
+  ctx.queueCount--;
+}
+
+// Formats this client should be sent each epoch. Plain NMEA-over-TCP readers
+// (NINA etc.) never speak gpsd and keep the NMEA stream they always had.
+static uint8_t clientFormats(const ClientContext& ctx) {
+  if (!ctx.isGpsd) return FORMAT_NMEA;
+  if (!ctx.watch.enable) return 0;
+  uint8_t formats = 0;
+  if (ctx.watch.json) formats |= FORMAT_JSON;
+  if (ctx.watch.nmea || ctx.watch.raw > 0) formats |= FORMAT_NMEA;
+  return formats;
+}
+
+// Part of a frame a client with these formats is sent: [NMEA], [TPV SKY] or both.
+// Returns false when there is nothing for it in this frame.
+static bool frameSlice(const BroadcastFrame* frame, uint8_t formats, uint16_t& offset, uint16_t& len) {
+  offset = (formats & FORMAT_NMEA) ? 0 : frame->nmeaLen;
+  uint16_t end = (formats & FORMAT_JSON) ? frame->nmeaLen + frame->jsonLen : frame->nmeaLen;
+  len = end > offset ? end - offset : 0;
+  return len > 0;
+}
+
+// Queue an epoch slice for a client. When the queue is full the oldest epoch is
+// dropped, so a slow client always ends up with the newest fix. Caller holds the slot.
+static void clientEnqueue(ClientContext& ctx, BroadcastFrame* frame, uint16_t offset, uint16_t len) {
+  if (ctx.queueCount >= TCP_CLIENT_QUEUE_DEPTH) {
+    clientPopQueued(ctx);
+    ctx.framesDropped++;
+  }
+  retainFrame(frame);
+  uint8_t slot = (ctx.queueHead + ctx.queueCount) % TCP_CLIENT_QUEUE_DEPTH;
+  ctx.queue[slot].frame = frame;
+  ctx.queue[slot].offset = offset;
+  ctx.queue[slot].len = len;
+  ctx.queue[slot].queuedAt = millis();
+  ctx.queueCount++;
+  ctx.framesQueued++;
+}
+
+// Hand queued epochs to the socket until it pushes back. Called on broadcast and
+// again from onAck/onPoll as the window reopens. Returns bytes written. Caller holds the slot.
+static size_t clientDrain(ClientContext& ctx) {
+  size_t bytes = 0;
+  while (ctx.queueCount > 0 && ctx.client->connected() && ctx.client->canSend()) {
+    QueuedFrame& head = ctx.queue[ctx.queueHead];
+    size_t len = head.len;
+    if (!clientWrite(ctx, head.frame, head.frame->data + head.offset, len)) break;
+    if (!ctx.firstByteSent) {
+      ctx.firstByteSent = true;
+      uint32_t latency = esp_timer_get_time() - ctx.connectedAt;
+      connectStats.lastFirstByteUs = latency;
+      if (latency > connectStats.maxFirstByteUs) connectStats.maxFirstByteUs = latency;
+    }
+    clientPopQueued(ctx);
+    ctx.framesSent++;
+    bytes += len;
+  }
+  return bytes;
+}
+
+// Drop everything still referenced by a closed client. Caller holds the slot.
+static void clientReleaseAll(ClientContext& ctx) {
+  while (ctx.inFlightCount > 0) {
+    InFlightWrite& head = ctx.inFlight[ctx.inFlightHead];
+    if (head.frame) releaseFrame(head.frame);
+    ctx.inFlightHead = (ctx.inFlightHead + 1) % TCP_CLIENT_INFLIGHT;
+    ctx.inFlightCount--;
+  }
+  while (ctx.queueCount > 0) clientPopQueued(ctx);
+}
 
 // --- Helper Functions Local to this file ---
-String getChecksum(String content) {
-  int xorResult = 0;
-  for (int i = 0; i < content.length(); i++) {
-    xorResult ^= content.charAt(i);
-  }
-  char hex[3];
-  sprintf(hex, "%02X", xorResult);
-  return String(hex);
-}
-
-String toNMEA(double deg, bool isLon) {
-  int d = (int)abs(deg);
-  double m = (abs(deg) - d) * 60.0;
-  char buf[20];
-  if (isLon) sprintf(buf, "%03d%07.4f", d, m);
-  else sprintf(buf, "%02d%07.4f", d, m); 
-  return String(buf);
-}
-
-String generateTPV() {
-  if (!gpsData.hasFix) return "";
-
-  int mode = 1; // Default No Fix
-  if (gpsData.fixType == 2) mode = 2; // 2D
-  if (gpsData.fixType == 3) mode = 3; // 3D
-
-  String tpv = "{\"class\":\"TPV\",\"device\":\"/dev/i2c\"";
-  tpv += ",\"status\":1"; 
-  tpv += ",\"mode\":" + String(mode);
-  tpv += ",\"time\":\"" + gpsData.dateStr + "T" + gpsData.timeStr + "Z\"";
-  tpv += ",\"lat\":" + String(gpsData.lat, 7);
-  tpv += ",\"lon\":" + String(gpsData.lon, 7);
-  tpv += ",\"alt\":" + String(gpsData.alt, 3);
-  tpv += ",\"altHAE\":" + String(gpsData.alt, 3);
-  tpv += ",\"altMSL\":" + String(gpsData.altMSL, 3);
-  tpv += ",\"speed\":" + String(gpsData.speed, 3);
-  tpv += ",\"track\":" + String(gpsData.heading, 2);
-  tpv += ",\"epx\":" + String(gpsData.hAcc, 2);
-  tpv += ",\"epy\":" + String(gpsData.hAcc, 2);
-  tpv += ",\"epv\":" + String(gpsData.vAcc, 2); 
-  tpv += "}\n";
-  return tpv;
+
+static int fixMode(const GpsSnapshot &snap) {
+  if (snap.fixType == 2) return 2; // 2D
+  if (snap.fixType == 3) return 3; // 3D
+  return 1; // No Fix
 }
 
-static void handleClientData(void* arg, AsyncClient* client, void* data, size_t len) {
-  String cmd = String((char*)data).substring(0, len);
-  if (cmd.indexOf("?WATCH") != -1) {
-    webSerialLog("GPSD client registered: " + client->remoteIP().toString());
-    if (xSemaphoreTake(clientsMutex, portMAX_DELAY)) {
-      for (auto& ctx : clients) {
-        if (ctx.client == client) {
-          ctx.isGpsd = true;
-          String ack = "{\"class\":\"VERSION\",\"release\":\"3.23\",\"rev\":\"ESP32\",\"proto_major\":3,\"proto_minor\":14}\\n";
-          ack += "{\"class\":\"DEVICES\",\"devices\":[{\"class\":\"DEVICE\",\"path\":\"/dev/i2c\",\"driver\":\"u-blox\",\"activated\":\"" + gpsData.dateStr + "T" + gpsData.timeStr + "Z\"}]}\\n";
-          ack += "{\"class\":\"WATCH\",\"enable\":true,\"json\":true}\\n";
-          
-          // IMMEDIATE UPDATE: Send current TPV if valid
-          if (gpsData.hasFix) {
-             ack += generateTPV();
-          }
-
-          client->write(ack.c_str());
-          break;
-        }
+// Clamp an snprintf result to what actually landed in the buffer
+static size_t fitted(int len, size_t cap) {
+  return (len > 0 && (size_t)len < cap) ? len : 0;
+}
+
+static size_t renderTPV(char* dest, size_t cap, const GpsSnapshot &snap) {
+  if (!snap.hasFix) {
+    return fitted(snprintf(dest, cap, "{\"class\":\"TPV\",\"device\":\"/dev/i2c\",\"mode\":1}\n"), cap);
+  }
+  return fitted(snprintf(dest, cap,
+    "{\"class\":\"TPV\",\"device\":\"/dev/i2c\",\"status\":1,\"mode\":%d,\"time\":\"%sT%sZ\""
+    ",\"lat\":%.7f,\"lon\":%.7f,\"alt\":%.3f,\"altHAE\":%.3f,\"altMSL\":%.3f"
+    ",\"speed\":%.3f,\"track\":%.2f,\"epx\":%.2f,\"epy\":%.2f,\"epv\":%.2f}\n",
+    fixMode(snap), snap.dateStr, snap.timeStr, snap.lat, snap.lon, snap.alt, snap.alt, snap.altMSL,
+    snap.speed, snap.heading, snap.hAcc, snap.hAcc, snap.vAcc), cap);
+}
+
+static size_t renderSKY(char* dest, size_t cap, const GpsSnapshot &snap) {
+  return fitted(snprintf(dest, cap,
+    "{\"class\":\"SKY\",\"device\":\"/dev/i2c\",\"time\":\"%sT%sZ\",\"nSat\":%d,\"uSat\":%d"
+    ",\"hdop\":%.2f,\"vdop\":%.2f,\"pdop\":%.2f}\n",
+    snap.dateStr, snap.timeStr, snap.satellitesVisible, snap.satellites,
+    snap.hdop, snap.vdop, snap.pdop), cap);
+}
+
+static size_t renderVersion(char* dest, size_t cap) {
+  return fitted(snprintf(dest, cap,
+    "{\"class\":\"VERSION\",\"release\":\"3.23\",\"rev\":\"ESP32\",\"proto_major\":3,\"proto_minor\":14}\n"), cap);
+}
+
+static size_t renderDevices(char* dest, size_t cap, const GpsSnapshot &snap) {
+  return fitted(snprintf(dest, cap,
+    "{\"class\":\"DEVICES\",\"devices\":[{\"class\":\"DEVICE\",\"path\":\"/dev/i2c\",\"driver\":\"u-blox\""
+    ",\"activated\":\"%sT%sZ\"}]}\n", snap.dateStr, snap.timeStr), cap);
+}
+
+static size_t renderWatch(char* dest, size_t cap, const GpsdWatch &watch) {
+  return fitted(snprintf(dest, cap,
+    "{\"class\":\"WATCH\",\"enable\":%s,\"json\":%s,\"nmea\":%s,\"raw\":%d}\n",
+    watch.enable ? "true" : "false", watch.json ? "true" : "false",
+    watch.nmea ? "true" : "false", watch.raw), cap);
+}
+
+// ?POLL embeds the latest TPV and SKY objects (without their newlines)
+static size_t renderPoll(char* dest, size_t cap, const GpsSnapshot &snap) {
+  size_t len = fitted(snprintf(dest, cap, "{\"class\":\"POLL\",\"time\":\"%sT%sZ\",\"active\":%d,\"tpv\":[",
+                               snap.dateStr, snap.timeStr, snap.isConnected ? 1 : 0), cap);
+  size_t part = renderTPV(dest + len, cap - len, snap);
+  if (part == 0) return 0;
+  len += part - 1;
+  part = fitted(snprintf(dest + len, cap - len, "],\"sky\":["), cap - len);
+  len += part;
+  part = renderSKY(dest + len, cap - len, snap);
+  if (part == 0) return 0;
+  len += part - 1;
+  part = fitted(snprintf(dest + len, cap - len, "]}\n"), cap - len);
+  return part ? len + part : 0;
+}
+
+// One member value of a ?WATCH object. Strings are accepted (gpsd has "device")
+// but only literals and numbers mean anything here.
+struct WatchValue {
+  bool given = false;     // Present and not null
+  bool isBool = false;
+  int32_t number = 0;     // true is 1, false and strings are 0
+};
+
+static void skipSpace(const char*& p, const char* end) {
+  while (p < end && (*p == ' ' || *p == '\t')) p++;
+}
+
+static bool skipLiteral(const char*& p, const char* end, const char* literal) {
+  size_t n = strlen(literal);
+  if ((size_t)(end - p) < n || memcmp(p, literal, n) != 0) return false;
+  p += n;
+  return true;
+}
+
+// Read a JSON string, keeping at most cap - 1 characters of it in out
+static bool scanString(const char*& p, const char* end, char* out, size_t cap) {
+  if (p >= end || *p != '"') return false;
+  p++;
+  size_t n = 0;
+  while (p < end && *p != '"') {
+    if (*p == '\\' && ++p >= end) return false;
+    if (n + 1 < cap) out[n++] = *p;
+    p++;
+  }
+  if (p >= end) return false;
+  p++;
+  out[n] = '\0';
+  return true;
+}
+
+static bool scanValue(const char*& p, const char* end, WatchValue& value) {
+  value = WatchValue();
+  value.given = true;
+  if (p < end && *p == '"') {
+    char ignored[1];
+    return scanString(p, end, ignored, sizeof(ignored));
+  }
+  if (skipLiteral(p, end, "true")) {
+    value.isBool = true;
+    value.number = 1;
+  } else if (skipLiteral(p, end, "false")) {
+    value.isBool = true;
+  } else if (skipLiteral(p, end, "null")) {
+    value.given = false;
+  } else {
+    bool negative = p < end && *p == '-';
+    if (negative) p++;
+    const char* digits = p;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (value.number < 100000) value.number = value.number * 10 + (*p - '0');
+      p++;
+    }
+    if (p == digits) return false;
+    // A fraction or exponent is read past and dropped, as as<int>() would
+    while (p < end && ((*p >= '0' && *p <= '9') || *p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-')) p++;
+    if (negative) value.number = -value.number;
+  }
+  return true;
+}
+
+// Apply a ?WATCH={...} object. Unspecified flags keep their value, except that
+// enabling with no format at all means JSON, as gpsd does.
+// The object is flat, so it is scanned in place rather than built into a document
+// on the AsyncTCP task; nested values are rejected along with malformed JSON.
+static bool parseWatch(GpsdWatch &watch, const char* json, size_t len) {
+  const char* p = json;
+  const char* end = json + len;
+  WatchValue enable, jsonFlag, nmea, raw;
+
+  skipSpace(p, end);
+  if (p >= end || *p != '{') return false;
+  p++;
+  skipSpace(p, end);
+  if (p < end && *p == '}') {
+    p++;
+  } else {
+    for (;;) {
+      char key[8]; // Longer than any key we act on, so a truncated key never matches
+      WatchValue value;
+      skipSpace(p, end);
+      if (!scanString(p, end, key, sizeof(key))) return false;
+      skipSpace(p, end);
+      if (p >= end || *p != ':') return false;
+      p++;
+      skipSpace(p, end);
+      if (!scanValue(p, end, value)) return false;
+      if (strcmp(key, "enable") == 0) enable = value;
+      else if (strcmp(key, "json") == 0) jsonFlag = value;
+      else if (strcmp(key, "nmea") == 0) nmea = value;
+      else if (strcmp(key, "raw") == 0) raw = value;
+      skipSpace(p, end);
+      if (p < end && *p == ',') {
+        p++;
+        continue;
+      }
+      if (p < end && *p == '}') {
+        p++;
+        break;
       }
-      xSemaphoreGive(clientsMutex);
+      return false;
     }
   }
+  skipSpace(p, end);
+  if (p != end) return false;
+
+  bool formatGiven = jsonFlag.given || nmea.given || raw.given;
+  watch.enable = enable.given ? enable.number != 0 : true;
+  if (jsonFlag.given) watch.json = jsonFlag.number != 0;
+  else if (watch.enable && !formatGiven) watch.json = true;
+  if (nmea.given) watch.nmea = nmea.number != 0;
+  if (raw.given) watch.raw = raw.number < 0 ? 0 : (raw.number > 255 ? 255 : raw.number);
+  return true;
+}
+
+// Handle one gpsd command ("?NAME" or "?NAME={...}", terminator stripped, not NUL-terminated).
+// The reply (a ?POLL carries a whole TPV and SKY) is rendered into a pooled frame, so the
+// AsyncTCP task never holds it on its stack, and queued behind the epochs already waiting
+// for this client: a full send window delays it instead of losing it. Caller holds the slot.
+static void handleGpsdCommand(ClientContext& ctx, const char* cmd, size_t len) {
+  GpsSnapshot snap;
+  readGpsSnapshot(snap);
+
+  const char* args = (const char*)memchr(cmd, '=', len);
+  size_t nameLen = args ? args - cmd : len;
+  size_t argsLen = args ? len - nameLen - 1 : 0;
+  if (args) args++;
+
+  BroadcastFrame* frame = acquireFrame();
+  if (frame == NULL) {
+    ctx.commandsRejected++; // Out of memory for the reply
+    return;
+  }
+  char* reply = frame->data;
+  const size_t cap = TCP_FRAME_SIZE;
+  size_t out = 0;
+
+  // gpsd greets with VERSION on connect; we hold it back until the client shows it
+  // speaks gpsd, so plain NMEA readers never see JSON
+  if (!ctx.isGpsd) {
+    ctx.isGpsd = true;
+    out += renderVersion(reply + out, cap - out);
+    webSerialLog("GPSD client registered: " + ctx.client->remoteIP().toString());
+  }
+
+  if (nameLen == 6 && memcmp(cmd, "?WATCH", 6) == 0) {
+    if (args && !parseWatch(ctx.watch, args, argsLen)) {
+      out += fitted(snprintf(reply + out, cap - out,
+                             "{\"class\":\"ERROR\",\"message\":\"Invalid WATCH: bad JSON\"}\n"), cap - out);
+    } else {
+      if (args) out += renderDevices(reply + out, cap - out, snap);
+      out += renderWatch(reply + out, cap - out, ctx.watch);
+      // Immediate update rather than making the client wait a whole interval
+      if (args && ctx.watch.enable && ctx.watch.json && snap.hasFix) {
+        out += renderTPV(reply + out, cap - out, snap);
+      }
+    }
+  } else if (nameLen == 5 && memcmp(cmd, "?POLL", 5) == 0) {
+    out += renderPoll(reply + out, cap - out, snap);
+  } else if (nameLen == 8 && memcmp(cmd, "?DEVICES", 8) == 0) {
+    out += renderDevices(reply + out, cap - out, snap);
+  } else if (nameLen == 8 && memcmp(cmd, "?VERSION", 8) == 0) {
+    if (out == 0) out += renderVersion(reply + out, cap - out);
+  } else {
+    out += fitted(snprintf(reply + out, cap - out,
+                           "{\"class\":\"ERROR\",\"message\":\"Unrecognized request '%.*s'\"}\n",
+                           (int)(nameLen > 1 ? nameLen - 1 : 0), cmd + 1), cap - out);
+  }
+
+  if (out > 0) {
+    // Never displaces a queued epoch: the client asked too fast for its own window
+    if (ctx.queueCount >= TCP_CLIENT_QUEUE_DEPTH) ctx.commandsRejected++;
+    else clientEnqueue(ctx, frame, 0, out);
+  }
+  releaseFrame(frame); // The queue holds its own reference
+}
+
+// Apply a slot's posted work, then push out whatever its window allows. Caller holds the slot.
+static void slotApply(ClientSlot& slot) {
+  uint32_t word = slot.state.load(std::memory_order_acquire);
+  if (SLOT_STATE(word) == SLOT_CLAIMED) return; // The accept callback runs it once published
+
+  uint32_t acked = slot.postedAcks.exchange(0);
+  BroadcastFrame* frame = slot.postedFrame.exchange(NULL);
+  if (SLOT_STATE(word) != SLOT_ACTIVE) {
+    // Posted just as the client went away
+    if (frame) releaseFrame(frame);
+    slot.commandHead.store(slot.commandTail.load(std::memory_order_acquire), std::memory_order_release);
+    slot.postedClose.store(false);
+    return;
+  }
+
+  ClientContext& ctx = slot.ctx;
+  if (acked) clientAcked(ctx, acked);
+  uint8_t tail = slot.commandTail.load(std::memory_order_acquire);
+  for (uint8_t head = slot.commandHead.load(); head != tail; head++) {
+    uint8_t i = head % TCP_CMD_QUEUE_DEPTH;
+    handleGpsdCommand(ctx, slot.command[i], slot.commandLen[i]);
+    slot.formats.store(clientFormats(ctx));
+    slot.commandHead.store(head + 1, std::memory_order_release);
+  }
+  if (frame) {
+    uint16_t offset, len;
+    if (frameSlice(frame, clientFormats(ctx), offset, len)) clientEnqueue(ctx, frame, offset, len);
+    releaseFrame(frame); // The queue holds its own reference
+  }
+  if (slot.postedClose.exchange(false)) {
+    // Retire the slot but leave the client alone: the holder may be the loop task while
+    // AsyncTCP is still inside this client's disconnect path
+    slot.retiredClient.store(ctx.client);
+    clientReleaseAll(ctx);
+    ctx.client = NULL;
+    slot.state.store(((SLOT_GEN(word) + 1) << 2) | SLOT_FREE, std::memory_order_release);
+    return;
+  }
+  clientDrain(ctx);
+}
+
+// Refresh the slot's published counters. Caller holds the slot.
+static void slotPublishStats(ClientSlot& slot) {
+  if (SLOT_STATE(slot.state.load(std::memory_order_acquire)) != SLOT_ACTIVE) return;
+  const ClientContext& ctx = slot.ctx;
+  uint8_t formats = slot.formats.load();
+  portENTER_CRITICAL(&statsMux);
+  TcpClientStats& st = slot.stats;
+  st.isGpsd = ctx.isGpsd;
+  st.nmea = formats & FORMAT_NMEA;
+  st.json = formats & FORMAT_JSON;
+  st.framesQueued = ctx.framesQueued;
+  st.framesSent = ctx.framesSent;
+  st.framesDropped = ctx.framesDropped;
+  st.pending = ctx.queueCount;
+  st.commands = ctx.commands;
+  st.commandsRejected = ctx.commandsRejected;
+  slot.oldestQueuedAt = ctx.queueCount > 0 ? ctx.queue[ctx.queueHead].queuedAt : 0;
+  portEXIT_CRITICAL(&statsMux);
+}
+
+static bool slotHasPostedWork(ClientSlot& slot) {
+  return slot.postedAcks.load() != 0 || slot.postedFrame.load() != NULL ||
+         slot.commandHead.load() != slot.commandTail.load() || slot.postedClose.load();
+}
+
+// Run a slot if nobody else is in it. Never waits: if the slot is busy, the
+// holder picks up anything posted before it lets go.
+static void slotRun(ClientSlot& slot) {
+  do {
+    bool expected = false;
+    if (!slot.busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) return;
+    slotApply(slot);
+    slotPublishStats(slot);
+    slot.busy.store(false, std::memory_order_release);
+  } while (slotHasPostedWork(slot) && SLOT_STATE(slot.state.load()) != SLOT_CLAIMED);
+}
+
+// Hand a frame reference to a slot. An epoch the slot never got round to is dropped.
+static void slotPostFrame(ClientSlot& slot, BroadcastFrame* frame) {
+  BroadcastFrame* stale = slot.postedFrame.exchange(frame);
+  if (stale) {
+    releaseFrame(stale);
+    slot.postedDropped.fetch_add(1);
+  }
+}
+
+static void* slotHandle(uint8_t index, uint32_t word) {
+  return (void*)(uintptr_t)(((SLOT_GEN(word) & 0xFFFFFF) << 8) | index);
+}
+
+// Slot behind a callback handle, or NULL once that client's slot has been retired
+static ClientSlot* slotFromHandle(void* handle) {
+  uintptr_t h = (uintptr_t)handle;
+  ClientSlot& slot = slots[h & 0xFF];
+  uint32_t word = slot.state.load(std::memory_order_acquire);
+  if (SLOT_STATE(word) != SLOT_ACTIVE || (SLOT_GEN(word) & 0xFFFFFF) != (h >> 8)) return NULL;
+  return &slot;
+}
+
+// Free the clients of retired slots. AsyncTCP task only: from a client's own onDisconnect
+// (as the other TCP ports do), or from a later callback when another task retired the slot.
+static void collectRetiredClients() {
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    AsyncClient* client = slots[i].retiredClient.exchange(NULL);
+    if (client) delete client;
+  }
+}
+
+static BroadcastFrame* retainCachedFrame() {
+  portENTER_CRITICAL(&cacheMux);
+  BroadcastFrame* frame = cachedFrame;
+  if (frame) retainFrame(frame);
+  portEXIT_CRITICAL(&cacheMux);
+  return frame;
+}
+
+static void replaceCachedFrame(BroadcastFrame* frame) {
+  retainFrame(frame);
+  portENTER_CRITICAL(&cacheMux);
+  BroadcastFrame* old = cachedFrame;
+  cachedFrame = frame;
+  portEXIT_CRITICAL(&cacheMux);
+  if (old) releaseFrame(old);
+}
+
+// A complete line has been assembled: enforce the rate cap, then hand it to the
+// slot. Runs on the AsyncTCP task, which owns the line buffer.
+static void clientLineComplete(ClientSlot& slot) {
+  ClientContext& ctx = slot.ctx;
+  const char* cmd = ctx.line;
+  size_t len = ctx.lineLen;
+  while (len > 0 && *cmd == ' ') {
+    cmd++;
+    len--;
+  }
+  if (len == 0 || *cmd != '?') return; // Blank lines and stray bytes are not commands
+
+  unsigned long now = millis();
+  if (now - ctx.rateWindowStart >= 1000) {
+    ctx.rateWindowStart = now;
+    ctx.rateCount = 0;
+  }
+  // Over the cap, or TCP_CMD_QUEUE_DEPTH commands are already waiting for a busy slot
+  uint8_t tail = slot.commandTail.load(std::memory_order_relaxed);
+  if (ctx.rateCount >= TCP_CMD_RATE_LIMIT ||
+      (uint8_t)(tail - slot.commandHead.load(std::memory_order_acquire)) >= TCP_CMD_QUEUE_DEPTH) {
+    ctx.commandsRejected++;
+    return;
+  }
+  ctx.rateCount++;
+  ctx.commands++;
+  uint8_t i = tail % TCP_CMD_QUEUE_DEPTH;
+  memcpy(slot.command[i], cmd, len);
+  slot.commandLen[i] = len;
+  slot.commandTail.store(tail + 1, std::memory_order_release);
+  slotRun(slot);
+}
+
+// Feed received bytes into the client's line buffer. Commands end in ';' or a
+// newline and may arrive split across any number of segments.
+static void clientReceive(ClientSlot& slot, const char* data, size_t len) {
+  ClientContext& ctx = slot.ctx;
+  for (size_t i = 0; i < len; i++) {
+    char c = data[i];
+    if (c == ';' || c == '\n' || c == '\r') {
+      if (ctx.lineTooLong) ctx.commandsRejected++;
+      else if (ctx.lineLen > 0) clientLineComplete(slot);
+      ctx.lineLen = 0;
+      ctx.lineTooLong = false;
+    } else if (ctx.lineLen < TCP_CMD_MAX_LEN) {
+      ctx.line[ctx.lineLen++] = c;
+    } else {
+      ctx.lineTooLong = true;
+    }
+  }
+}
+
+static void handleClientData(void* arg, AsyncClient* client, void* data, size_t len) {
+  ClientSlot* slot = slotFromHandle(arg);
+  if (slot) clientReceive(*slot, (const char*)data, len);
 }
 
 static void handleNewClient(void* arg, AsyncClient* client) {
-  ClientContext ctx;
-  ctx.client = client;
-  ctx.isGpsd = false; 
-  
+  int64_t connectedAt = esp_timer_get_time();
+  collectRetiredClients(); // Before any retired slot is claimed again
   String clientIP = client->remoteIP().toString();
-  webSerialLog("TCP client connected: " + clientIP);
-  
-  if (xSemaphoreTake(clientsMutex, portMAX_DELAY)) {
-    clients.push_back(ctx);
-    newClientConnected = true;
-    xSemaphoreGive(clientsMutex);
+
+  // Admission: claim a free slot, or turn the connection away
+  ClientSlot* slot = NULL;
+  uint8_t index = 0;
+  uint32_t word = 0;
+  for (uint8_t i = 0; i < TCP_MAX_CLIENTS && slot == NULL; i++) {
+    uint32_t current = slots[i].state.load(std::memory_order_acquire);
+    if (SLOT_STATE(current) == SLOT_FREE &&
+        slots[i].state.compare_exchange_strong(current, current | SLOT_CLAIMED)) {
+      slot = &slots[i];
+      index = i;
+      word = current;
+    }
   }
+  if (slot == NULL) {
+    connectStats.rejected++;
+    webSerialLog("TCP client rejected, " + String(TCP_MAX_CLIENTS) + " already connected: " + clientIP);
+    static const char busy[] = "{\"class\":\"ERROR\",\"message\":\"Too many clients\"}\n";
+    client->onDisconnect([](void* arg, AsyncClient* c) { delete c; }, NULL);
+    client->write(busy, sizeof(busy) - 1);
+    client->close();
+    return;
+  }
+  webSerialLog("TCP client connected: " + clientIP);
+
+  // Nobody else touches a CLAIMED slot. Clear anything the last client left posted.
+  BroadcastFrame* stale = slot->postedFrame.exchange(NULL);
+  if (stale) releaseFrame(stale);
+  slot->postedAcks.store(0);
+  slot->postedClose.store(false);
+  slot->postedDropped.store(0);
+  slot->commandHead.store(slot->commandTail.load());
+  slot->ctx = ClientContext();
+  slot->ctx.client = client;
+  slot->ctx.connectedAt = connectedAt;
+  slot->formats.store(clientFormats(slot->ctx));
+  portENTER_CRITICAL(&statsMux);
+  slot->stats = TcpClientStats();
+  slot->stats.ip = client->remoteIP();
+  slot->stats.port = client->remotePort();
+  slot->oldestQueuedAt = 0;
+  portEXIT_CRITICAL(&statsMux);
+  void* handle = slotHandle(index, word);
 
   client->onDisconnect([](void* arg, AsyncClient* c) {
     String clientIP = c->remoteIP().toString();
     webSerialLog("TCP client disconnected: " + clientIP);
-    if (xSemaphoreTake(clientsMutex, portMAX_DELAY)) {
-      for (auto it = clients.begin(); it != clients.end(); ++it) {
-        if (it->client == c) {
-          clients.erase(it);
-          break;
-        }
-      }
-      xSemaphoreGive(clientsMutex);
+    ClientSlot* slot = slotFromHandle(arg);
+    if (slot) {
+      slot->postedClose.store(true);
+      slotRun(*slot);
+    }
+    // Frees c here if the slot was retired just now; if another task holds the slot,
+    // c is parked when it lets go and freed by the next AsyncTCP callback
+    collectRetiredClients();
+  }, handle);
+  client->onAck([](void* arg, AsyncClient* c, size_t len, uint32_t time) {
+    ClientSlot* slot = slotFromHandle(arg);
+    if (slot) {
+      slot->postedAcks.fetch_add(len);
+      slotRun(*slot);
     }
-  }, NULL);
-  client->onData(&handleClientData, NULL);
+  }, handle);
+  client->onPoll([](void* arg, AsyncClient* c) {
+    ClientSlot* slot = slotFromHandle(arg);
+    if (slot) slotRun(*slot); // Drains anything still queued
+    collectRetiredClients();
+  }, handle);
+  client->onData(&handleClientData, handle);
+
+  slot->state.store((SLOT_GEN(word) << 2) | SLOT_ACTIVE, std::memory_order_release);
+  connectStats.connects++;
+
+  // New connections start on NMEA: hand over the last epoch's block now,
+  // aimed at this client only. Everyone else is untouched.
+  BroadcastFrame* cached = retainCachedFrame();
+  if (cached != NULL) {
+    slotPostFrame(*slot, cached);
+    connectStats.servedFromCache++;
+  }
+  slotRun(*slot);
 }
 
 void setupTCP() {
-  clientsMutex = xSemaphoreCreateMutex();
   tcpServer.onClient(&handleNewClient, NULL);
   tcpServer.begin();
   Serial.println("TCP server started on port " + String(TCP_PORT));
 }
 
-bool hasNewConnections() {
-  if (newClientConnected) {
-    newClientConnected = false; 
-    return true;
+void broadcastData() {
+  // Check who is listening, and for what, before rendering.
+  // NMEA is always rendered: it is what a new connection is served from the cache.
+  // JSON is only built while some client is subscribed to it.
+  uint8_t wanted = FORMAT_NMEA;
+  if (udpWantsJson()) wanted |= FORMAT_JSON;
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (SLOT_STATE(slots[i].state.load(std::memory_order_acquire)) == SLOT_ACTIVE) {
+      wanted |= slots[i].formats.load();
+    }
+  }
+
+  // Render each subscribed format once, from one coherent epoch
+  GpsSnapshot snap;
+  readGpsSnapshot(snap);
+
+  broadcastStats.lastAllocs = 0;
+  BroadcastFrame* frame = acquireFrame();
+  if (frame == NULL) return;
+  if (frame->fromHeap) {
+    broadcastStats.lastAllocs++;
+    broadcastStats.totalAllocs++;
+  }
+  frame->nmeaLen = 0;
+  frame->jsonLen = 0;
+  if (wanted & FORMAT_NMEA) {
+    frame->nmeaLen = renderNmeaEpoch(frame->data, TCP_FRAME_SIZE, snap);
   }
-  return false;
+  if (wanted & FORMAT_JSON) {
+    char* json = frame->data + frame->nmeaLen;
+    size_t cap = TCP_FRAME_SIZE - frame->nmeaLen;
+    size_t tpvLen = renderTPV(json, cap, snap);
+    frame->jsonLen = tpvLen + renderSKY(json + tpvLen, cap - tpvLen, snap);
+  }
+  uint32_t frameBytes = frame->nmeaLen + frame->jsonLen;
+  replaceCachedFrame(frame);
+
+  // UDP listeners cost one datagram per format, however many there are
+  sendUdpEpoch(frame->data, frame->nmeaLen, frame->data + frame->nmeaLen, frame->jsonLen);
+
+  // Post the epoch to every subscriber. Slots that are free take it now, straight
+  // out of the shared frame; a busy slot's holder queues it on the way out.
+  uint32_t bytes = 0;
+  uint32_t offered = 0;
+  uint32_t backlogged = 0;
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    ClientSlot& slot = slots[i];
+    if (SLOT_STATE(slot.state.load(std::memory_order_acquire)) != SLOT_ACTIVE) continue;
+    uint16_t offset, len;
+    if (!frameSlice(frame, slot.formats.load(), offset, len)) continue;
+    retainFrame(frame);
+    slotPostFrame(slot, frame);
+    slotRun(slot);
+    bytes += len;
+    offered++;
+    if (slot.postedFrame.load() != NULL || slot.ctx.queueCount > 0) backlogged++;
+  }
+  releaseFrame(frame); // Clients and the cache hold their own references
+
+  broadcastStats.broadcasts++;
+  broadcastStats.lastFrameBytes = frameBytes;
+  broadcastStats.lastBytes = bytes;
+  broadcastStats.lastClients = offered;
+  broadcastStats.lastBacklogged = backlogged;
+  broadcastStats.totalBytes += bytes;
 }
 
-void broadcastData() {
-  // OPTIMIZATION: Check if anyone is actually listening before building strings
-  bool hasActiveClients = false;
-  if (xSemaphoreTake(clientsMutex, portMAX_DELAY)) {
-    for (auto& ctx : clients) {
-      if (ctx.client->connected()) {
-        hasActiveClients = true;
-        break;
-      }
-    }
-    xSemaphoreGive(clientsMutex);
-  }
-
-  if (!hasActiveClients) return; // Exit immediately if no clients, saving CPU/RAM
-
-  // Construct strings first to minimize lock time, relying on extern gpsData
-  
-  // --- PREPARE NMEA ---
-  String rmc = "GPRMC,";
-  char timeBuf[15];
-  sprintf(timeBuf, "%02d%02d%02d.00,", gpsData.hour, gpsData.minute, gpsData.second);
-  rmc += timeBuf;
-  rmc += (gpsData.hasFix ? "A," : "V,");
-  rmc += toNMEA(gpsData.lat, false) + (gpsData.lat >= 0 ? ",N," : ",S,");
-  rmc += toNMEA(gpsData.lon, true) + (gpsData.lon >= 0 ? ",E," : ",W,");
-  rmc += String(gpsData.speed * 1.94384) + ",";
-  rmc += String(gpsData.heading) + ",";
-  char dateBuf[10];
-  sprintf(dateBuf, "%02d%02d%02d,", gpsData.day, gpsData.month, gpsData.year % 100);
-  rmc += dateBuf;
-  rmc += ",,";
-  String rmcFull = "$" + rmc + "*" + getChecksum(rmc) + "\r\n";
-
-  String gga = "GPGGA,";
-  gga += String(timeBuf);
-  gga += toNMEA(gpsData.lat, false) + (gpsData.lat >= 0 ? ",N," : ",S,");
-  gga += toNMEA(gpsData.lon, true) + (gpsData.lon >= 0 ? ",E," : ",W,");
-  gga += (gpsData.hasFix ? "1," : "0,");
-  gga += String(gpsData.satellites) + ",";
-  gga += String(gpsData.hdop) + ",";
-  gga += String(gpsData.alt) + ",M,";
-  gga += "0.0,M,,";
-  String ggaFull = "$" + gga + "*" + getChecksum(gga) + "\r\n";
-  
-  int mode = 1; // Default No Fix
-  if (gpsData.fixType == 2) mode = 2; // 2D
-  if (gpsData.fixType == 3) mode = 3; // 3D
-  
-  String gsa = "GPGSA,A," + String(mode) + ",,,,,,,,,,,,,";
-  gsa += String(gpsData.pdop) + "," + String(gpsData.hdop) + "," + String(gpsData.vdop);
-  String gsaFull = "$" + gsa + "*" + getChecksum(gsa) + "\r\n";
-
-  // --- PREPARE GPSD JSON ---
-  String tpv = generateTPV();
-
-  if (xSemaphoreTake(clientsMutex, portMAX_DELAY)) {
-    for (auto& ctx : clients) {
-      if (ctx.client->connected() && ctx.client->canSend()) {
-        if (ctx.isGpsd && gpsData.hasFix) {
-          ctx.client->write(tpv.c_str());
-        } else {
-          ctx.client->write(rmcFull.c_str());
-          ctx.client->write(ggaFull.c_str());
-          ctx.client->write(gsaFull.c_str());
-        }
-      }
-    }
-    xSemaphoreGive(clientsMutex);
+const TcpBroadcastStats& getTcpBroadcastStats() {
+  return broadcastStats;
+}
+
+const TcpConnectStats& getTcpConnectStats() {
+  return connectStats;
+}
+
+// Rows are copied from what each slot last published, so a client that is being
+// served right now shows its counters as of the last time it was let go
+size_t getTcpClientStats(TcpClientStats* out, size_t max) {
+  size_t n = 0;
+  unsigned long now = millis();
+  for (int i = 0; i < TCP_MAX_CLIENTS && n < max; i++) {
+    ClientSlot& slot = slots[i];
+    if (SLOT_STATE(slot.state.load(std::memory_order_acquire)) != SLOT_ACTIVE) continue;
+    TcpClientStats& st = out[n++];
+    portENTER_CRITICAL(&statsMux);
+    st = slot.stats;
+    unsigned long queuedAt = slot.oldestQueuedAt;
+    portEXIT_CRITICAL(&statsMux);
+    st.framesDropped += slot.postedDropped.load();
+    st.lagMs = st.pending > 0 ? now - queuedAt : 0;
   }
-}
\ No newline at end of file
+  return n;
+}
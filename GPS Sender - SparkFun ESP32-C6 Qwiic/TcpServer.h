@@ -1,8 +1,49 @@
 #ifndef TCP_SERVER_H
 #define TCP_SERVER_H
 
+#include <Arduino.h>
+
+// Per-broadcast cost counters (updated by broadcastData on the loop task)
+struct TcpBroadcastStats {
+  uint32_t broadcasts = 0;
+  uint32_t lastFrameBytes = 0;   // Bytes rendered into the shared frame
+  uint32_t lastBytes = 0;        // Bytes queued across all clients
+  uint32_t lastClients = 0;      // Clients that took the epoch immediately
+  uint32_t lastBacklogged = 0;   // Clients left with epochs queued (window full)
+  uint32_t lastAllocs = 0;       // Heap allocations made by the last broadcast
+  uint32_t totalAllocs = 0;
+  uint64_t totalBytes = 0;
+};
+
+// New-connection service
+struct TcpConnectStats {
+  uint32_t connects = 0;
+  uint32_t rejected = 0;         // Turned away because all TCP_MAX_CLIENTS slots were taken
+  uint32_t servedFromCache = 0;  // Handed the last epoch's frame on accept
+  uint32_t lastFirstByteUs = 0;  // Accept -> first epoch bytes handed to the socket
+  uint32_t maxFirstByteUs = 0;
+};
+
+// Per-client delivery state, for spotting a client that is falling behind
+struct TcpClientStats {
+  IPAddress ip;
+  uint16_t port = 0;
+  bool isGpsd = false;
+  bool nmea = false;             // Subscribed to NMEA sentences
+  bool json = false;             // Subscribed to gpsd TPV/SKY reports
+  uint32_t framesQueued = 0;     // Epochs offered to this client
+  uint32_t framesSent = 0;       // Epochs handed to the socket
+  uint32_t framesDropped = 0;    // Oldest epochs discarded because the queue was full
+  uint8_t pending = 0;           // Epochs waiting now
+  uint32_t lagMs = 0;            // Age of the oldest waiting epoch
+  uint32_t commands = 0;         // gpsd commands handled
+  uint32_t commandsRejected = 0; // Over-long lines, over the rate cap, the command queue or the send queue
+};
+
 void setupTCP();
 void broadcastData();
-bool hasNewConnections();
+const TcpBroadcastStats& getTcpBroadcastStats();
+const TcpConnectStats& getTcpConnectStats();
+size_t getTcpClientStats(TcpClientStats* out, size_t max); // Returns clients copied
 
 #endif
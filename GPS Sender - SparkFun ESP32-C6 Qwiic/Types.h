@@ -2,6 +2,7 @@
 #define TYPES_H
 
 #include <Arduino.h>
+#include "Config.h"
 
 enum LedMode {
   LED_OFF = 0,
@@ -11,6 +12,18 @@ enum LedMode {
   LED_BLINK_ON_MOVEMENT = 4
 };
 
+// One row of the sky view (UBX-NAV-SAT)
+struct SatInfo {
+  uint8_t gnssId;
+  uint8_t svId;
+  uint8_t cno;                   // dBHz
+  int8_t elev;                   // deg
+  int16_t azim;                  // deg
+  uint8_t quality;               // UBX qualityInd
+  uint8_t health;                // UBX: 0 unknown, 1 healthy, 2 unhealthy
+  bool used;                     // In the navigation solution
+};
+
 struct GPSData {
   LedMode ledMode = LED_BLINK_ON_GPS_READ; // Default
   bool isConnected = false;
@@ -40,6 +53,18 @@ struct GPSData {
   float vdop = 0.0;
   float hAcc = 0.0;
   float vAcc = 0.0;
+
+  // The same solution in UBX integer units, for packing without float math (ESP-NOW v2)
+  int32_t latE7 = 0;             // deg * 1e7
+  int32_t lonE7 = 0;
+  int32_t heightMm = 0;          // Above ellipsoid
+  int32_t gSpeedMmS = 0;
+  int32_t headMotE5 = 0;         // deg * 1e5
+  uint16_t pdopE2 = 0, hdopE2 = 0, vdopE2 = 0; // DOP * 100
+  uint32_t hAccMm = 0, vAccMm = 0;
+  uint32_t utcEpoch = 0;         // Unix seconds of the solution; 0 = no valid date/time
+  uint16_t utcMillis = 0;        // Milliseconds of the solution time (from PVT nano)
+  int64_t utcRefMicros = 0;      // esp_timer at the solution time (TIMEPULSE edge, or PVT read less latency)
   
   String timeStr = "00:00:00";
   String dateStr = "1970-01-01";
@@ -51,6 +76,14 @@ struct GPSData {
   
   byte fixType = 0;
 
+  // Sky view from the last NAV-SAT frame. Loop task only, and not part of GpsSnapshot.
+  SatInfo sats[GPS_SAT_TABLE_MAX];
+  uint8_t satCount = 0;
+
+  // I2C traffic between the last two navigation epochs (frames, polls, RTCM and command writes)
+  uint32_t i2cBytesPerEpoch = 0;
+  uint32_t i2cTransactionsPerEpoch = 0;
+
   double lastLat = 0.0;
   double lastLon = 0.0;
   const double movementThreshold = 0.00001; 
@@ -67,17 +100,15 @@ struct GPSData {
   // ESP-NOW Status
   String espNowStatus = "Disabled";
   String espNowError = "";
-  unsigned long espNowLastTxTime = 0;
   
-  // Per-client ESP-NOW Metrics (up to 3 clients)
+  // Per-client ESP-NOW Metrics (up to ESPNOW_MAX_CLIENTS clients)
   struct EspNowClientMetrics {
     uint8_t macAddr[6];
     bool isActive;
     unsigned long lastResponseTime;  // Last time we got a pong response
-    unsigned long lastTransmitTime;  // Last time we successfully transmitted to this client
     uint32_t lastPingReceived;       // Last ping value received back
   };
-  EspNowClientMetrics espNowClients[3];
+  EspNowClientMetrics espNowClients[ESPNOW_MAX_CLIENTS];
   
   // Ping-pong mechanism for connection tracking
   uint32_t espNowPingCounter = 0;    // Incremented with each send
@@ -96,4 +127,69 @@ struct GPSData {
   float vAccMin = 99999.0;
 };
 
+// Immutable copy of one GPS epoch, published by the loop task (see GpsSnapshot.h).
+// Plain data only - no String members - so readers can copy it without locking.
+struct GpsSnapshot {
+  uint32_t version = 0;          // Publish sequence number
+  unsigned long publishedAt = 0; // millis() at publish
+
+  bool isConnected = false;
+  bool hasFix = false;
+  bool hadFirstFix = false;
+  bool demoMode = false;
+  byte fixType = 0;
+  char fixStatus[24] = "Initializing";
+  int satellites = 0;
+  int satellitesVisible = 0;
+  int ttffSeconds = 0;
+
+  double lat = 0.0;
+  double lon = 0.0;
+  double alt = 0.0;
+  double altMSL = 0.0;
+  float speed = 0.0;
+  float heading = 0.0;
+  float pdop = 0.0;
+  float hdop = 0.0;
+  float vdop = 0.0;
+  float hAcc = 0.0;
+  float vAcc = 0.0;
+
+  // The same solution in UBX integer units, for packing without float math (ESP-NOW v2)
+  int32_t latE7 = 0;             // deg * 1e7
+  int32_t lonE7 = 0;
+  int32_t heightMm = 0;          // Above ellipsoid
+  int32_t gSpeedMmS = 0;
+  int32_t headMotE5 = 0;         // deg * 1e5
+  uint16_t pdopE2 = 0, hdopE2 = 0, vdopE2 = 0; // DOP * 100
+  uint32_t hAccMm = 0, vAccMm = 0;
+  uint32_t utcEpoch = 0;         // Unix seconds of the solution; 0 = no valid date/time
+  uint16_t utcMillis = 0;        // Milliseconds of the solution time (from PVT nano)
+  int64_t utcRefMicros = 0;      // esp_timer at the solution time (TIMEPULSE edge, or PVT read less latency)
+
+  char timeStr[9] = "00:00:00";
+  char dateStr[11] = "1970-01-01";
+  char localTimeStr[9] = "--:--:--";
+  uint8_t hour = 0, minute = 0, second = 0;
+  uint16_t year = 0;
+  uint8_t month = 0, day = 0;
+  int timezoneOffsetMinutes = 0;
+
+  float cpuTemp = 0.0;
+  uint32_t i2cBytesPerEpoch = 0;
+  uint32_t i2cTransactionsPerEpoch = 0;
+
+  // Min/Max Statistics
+  double altMin = 99999.0;
+  double altMax = -99999.0;
+  float speedMax = 0.0;
+  int satellitesMax = 0;
+  int satellitesVisibleMax = 0;
+  float pdopMin = 100.0;
+  float hdopMin = 100.0;
+  float vdopMin = 100.0;
+  float hAccMin = 99999.0;
+  float vAccMin = 99999.0;
+};
+
 #endif
@@ -0,0 +1,192 @@
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <atomic>
+#include <freertos/stream_buffer.h>
+#include "UbxPassthrough.h"
+#include "Config.h"
+#include "Context.h"
+#include "WebServer.h"
+#include "GpsLogic.h"
+
+static AsyncServer ubxServer(UBX_RAW_PORT);
+// The GNSS, loop and AsyncTCP tasks all count into ubxStats, and the 64-bit totals
+// cannot be updated or read in one access, so every touch goes through statsMux
+static UbxPassthroughStats ubxStats;
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define COUNT(field, n) do { portENTER_CRITICAL(&statsMux); ubxStats.field += (n); portEXIT_CRITICAL(&statsMux); } while (0)
+
+// ================= MODULE -> TOOLS =================
+// Positions are free-running byte counts; index with & (UBX_RAW_RING_SIZE - 1).
+// The GNSS task only appends whole frames, so ringHead always sits on a frame
+// boundary and a client that starts there never sees half a message.
+static uint8_t ring[UBX_RAW_RING_SIZE];
+static std::atomic<uint32_t> ringHead(0);   // Written by the GNSS task
+static std::atomic<uint32_t> ringTail(0);   // Oldest byte a client has not ACKed yet
+static std::atomic<uint8_t> clientCount(0);
+
+struct RawClient {
+  AsyncClient* client = NULL;
+  uint32_t sent = 0;    // Ring position written to the socket up to
+  uint32_t acked = 0;   // Ring position ACKed up to; bytes in [acked, sent) are referenced in place
+};
+static RawClient rawClients[UBX_RAW_MAX_CLIENTS];
+static SemaphoreHandle_t rawMutex = NULL;
+
+// ================= TOOLS -> MODULE =================
+// Single writer (async_tcp task), single reader (GNSS task)
+static StreamBufferHandle_t commandStream = NULL;
+
+// Lowest ACKed position across clients, or the head when nobody is connected.
+// Caller holds rawMutex.
+static void updateRingTail() {
+  uint32_t head = ringHead.load(std::memory_order_acquire);
+  uint32_t tail = head;
+  for (int i = 0; i < UBX_RAW_MAX_CLIENTS; i++) {
+    if (rawClients[i].client != NULL && head - rawClients[i].acked > head - tail) {
+      tail = rawClients[i].acked;
+    }
+  }
+  ringTail.store(tail, std::memory_order_release);
+}
+
+// Write whatever the ring holds beyond what this client was already given, without
+// copying. Caller holds rawMutex.
+static void rawDrain(RawClient& rc) {
+  uint32_t head = ringHead.load(std::memory_order_acquire);
+  bool wrote = false;
+  while (rc.sent != head && rc.client->canSend()) {
+    uint32_t offset = rc.sent & (UBX_RAW_RING_SIZE - 1);
+    size_t len = head - rc.sent;
+    if (len > UBX_RAW_RING_SIZE - offset) len = UBX_RAW_RING_SIZE - offset; // Up to the wrap
+    size_t space = rc.client->space();
+    if (len > space) len = space;
+    if (len == 0) break;
+    size_t added = rc.client->add((const char*)ring + offset, len, 0);
+    if (added == 0) break;
+    rc.sent += added;
+    COUNT(bytesOut, added);
+    wrote = true;
+  }
+  if (wrote) rc.client->send();
+}
+
+static void handleRawData(void* arg, AsyncClient* client, void* data, size_t len) {
+  // UBX commands from the tool. A segment is queued whole or not at all, so a
+  // frame is never cut short on its way to the module.
+  if (xStreamBufferSpacesAvailable(commandStream) < len) {
+    COUNT(commandBytesDropped, len);
+    return;
+  }
+  xStreamBufferSend(commandStream, data, len, 0);
+  wakeGpsTask();
+}
+
+static void handleRawClient(void* arg, AsyncClient* client) {
+  String clientIP = client->remoteIP().toString();
+  RawClient* rc = NULL;
+  xSemaphoreTake(rawMutex, portMAX_DELAY);
+  for (int i = 0; i < UBX_RAW_MAX_CLIENTS && rc == NULL; i++) {
+    if (rawClients[i].client == NULL) rc = &rawClients[i];
+  }
+  if (rc != NULL) {
+    // Start at the next frame the module delivers
+    rc->client = client;
+    rc->sent = rc->acked = ringHead.load(std::memory_order_acquire);
+    clientCount.fetch_add(1);
+    updateRingTail();
+  }
+  xSemaphoreGive(rawMutex);
+
+  if (rc == NULL) {
+    COUNT(rejected, 1);
+    webSerialLog("UBX client rejected, " + String(UBX_RAW_MAX_CLIENTS) + " already connected: " + clientIP);
+    client->onDisconnect([](void* arg, AsyncClient* c) { delete c; }, NULL);
+    client->close();
+    return;
+  }
+  webSerialLog("UBX client connected: " + clientIP);
+  client->setNoDelay(true);
+
+  client->onDisconnect([](void* arg, AsyncClient* c) {
+    webSerialLog("UBX client disconnected: " + c->remoteIP().toString());
+    RawClient* rc = (RawClient*)arg;
+    xSemaphoreTake(rawMutex, portMAX_DELAY);
+    rc->client = NULL;
+    clientCount.fetch_sub(1);
+    updateRingTail();
+    xSemaphoreGive(rawMutex);
+    delete c;
+  }, rc);
+  client->onAck([](void* arg, AsyncClient* c, size_t len, uint32_t time) {
+    RawClient* rc = (RawClient*)arg;
+    xSemaphoreTake(rawMutex, portMAX_DELAY);
+    rc->acked += len;
+    updateRingTail();
+    rawDrain(*rc);
+    xSemaphoreGive(rawMutex);
+  }, rc);
+  client->onData(&handleRawData, rc);
+}
+
+void setupUbxPassthrough() {
+  if (!UBX_RAW_ENABLED) return;
+  rawMutex = xSemaphoreCreateMutex();
+  commandStream = xStreamBufferCreate(UBX_RAW_COMMAND_BUFFER, 1);
+  ubxServer.onClient(&handleRawClient, NULL);
+  ubxServer.begin();
+  webSerialLog("Raw UBX server started on port " + String(UBX_RAW_PORT));
+}
+
+void serviceUbxPassthrough() {
+  if (!UBX_RAW_ENABLED || commandStream == NULL) return;
+
+  // Tool -> module
+  uint8_t command[64];
+  size_t len;
+  while ((len = xStreamBufferReceive(commandStream, command, sizeof(command), 0)) > 0) {
+    myGNSS.pushRawData(command, len);
+    COUNT(commandBytes, len);
+  }
+
+  // Module -> tools. checkUblox() has just stored the logged frames in the file buffer.
+  uint16_t avail = myGNSS.fileBufferAvailable();
+  if (avail == 0) return;
+  if (clientCount.load() == 0) {
+    myGNSS.clearFileBuffer(); // Nobody to forward to
+    return;
+  }
+  uint32_t head = ringHead.load(std::memory_order_relaxed);
+  uint32_t used = head - ringTail.load(std::memory_order_acquire);
+  if (avail > UBX_RAW_RING_SIZE - used) {
+    // The slowest client still references the space: skip these frames whole
+    myGNSS.clearFileBuffer();
+    COUNT(bytesDropped, avail);
+    return;
+  }
+
+  uint32_t offset = head & (UBX_RAW_RING_SIZE - 1);
+  uint16_t first = avail;
+  if (first > UBX_RAW_RING_SIZE - offset) first = UBX_RAW_RING_SIZE - offset;
+  myGNSS.extractFileBufferData(ring + offset, first);
+  if (avail > first) myGNSS.extractFileBufferData(ring, avail - first);
+  ringHead.store(head + avail, std::memory_order_release);
+  COUNT(bytesIn, avail);
+}
+
+void pumpUbxPassthrough() {
+  if (!UBX_RAW_ENABLED || rawMutex == NULL || clientCount.load() == 0) return;
+  xSemaphoreTake(rawMutex, portMAX_DELAY);
+  for (int i = 0; i < UBX_RAW_MAX_CLIENTS; i++) {
+    if (rawClients[i].client != NULL) rawDrain(rawClients[i]);
+  }
+  xSemaphoreGive(rawMutex);
+}
+
+UbxPassthroughStats getUbxPassthroughStats() {
+  portENTER_CRITICAL(&statsMux);
+  UbxPassthroughStats stats = ubxStats;
+  portEXIT_CRITICAL(&statsMux);
+  stats.clients = clientCount.load();
+  return stats;
+}
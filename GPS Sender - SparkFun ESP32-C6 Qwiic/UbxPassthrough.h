@@ -0,0 +1,26 @@
+#ifndef UBX_PASSTHROUGH_H
+#define UBX_PASSTHROUGH_H
+
+#include <Arduino.h>
+
+// Raw UBX TCP port for u-center, RTKLIB and other tools that want the binary stream.
+// The GNSS task copies logged UBX frames out of the library's file buffer into a
+// byte ring; every client is written straight from that ring and the bytes stay
+// put until the client ACKs them. Bytes from the tool go the other way through a
+// stream buffer and are pushed to the module by the GNSS task.
+struct UbxPassthroughStats {
+  uint8_t clients = 0;
+  uint32_t rejected = 0;          // Connections turned away, all slots taken
+  uint64_t bytesIn = 0;           // UBX bytes taken from the module into the ring
+  uint64_t bytesOut = 0;          // Bytes handed to client sockets (all clients)
+  uint32_t bytesDropped = 0;      // Module bytes discarded because the slowest client had the ring full
+  uint32_t commandBytes = 0;      // Tool -> module bytes pushed over I2C
+  uint32_t commandBytesDropped = 0;
+};
+
+void setupUbxPassthrough();     // Network side, after WiFi
+void serviceUbxPassthrough();   // GNSS task, after each checkUblox() drain
+void pumpUbxPassthrough();      // Loop task: hand newly arrived bytes to the sockets
+UbxPassthroughStats getUbxPassthroughStats(); // Consistent copy; the counters have several writers
+
+#endif
@@ -0,0 +1,74 @@
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include "UdpOutput.h"
+#include "Config.h"
+#include "WebServer.h"
+#include "NmeaEncoder.h"
+
+static AsyncUDP udp;
+static IPAddress multicastGroup;
+static bool useMulticast = false;
+static UdpOutputStats udpStats;
+
+// Sequence header + the largest slice of a broadcast frame. Loop task only.
+static char datagram[TCP_FRAME_SIZE + 48];
+
+void setupUDP() {
+  if (!UDP_OUTPUT_ENABLED) return;
+
+  if (UDP_MULTICAST_GROUP[0] != '\0') {
+    useMulticast = multicastGroup.fromString(UDP_MULTICAST_GROUP);
+    if (!useMulticast) webSerialLog("UDP: invalid multicast group '" + String(UDP_MULTICAST_GROUP) + "', using broadcast");
+  }
+  webSerialLog("UDP output on port " + String(UDP_PORT) + " to " +
+               (useMulticast ? multicastGroup.toString() : String("broadcast")));
+}
+
+bool udpWantsJson() {
+  return UDP_OUTPUT_ENABLED && UDP_SEND_JSON;
+}
+
+static void sendDatagram(size_t len) {
+  size_t sent = useMulticast
+    ? udp.writeTo((const uint8_t*)datagram, len, multicastGroup, UDP_PORT)
+    : udp.broadcastTo((uint8_t*)datagram, len, UDP_PORT);
+  if (sent != len) {
+    udpStats.errors++;
+    return;
+  }
+  udpStats.datagrams++;
+  udpStats.lastBytes += len;
+  udpStats.totalBytes += len;
+}
+
+// Called by broadcastData() with slices of the epoch's shared frame
+void sendUdpEpoch(const char* nmea, size_t nmeaLen, const char* json, size_t jsonLen) {
+  if (!UDP_OUTPUT_ENABLED) return;
+  udpStats.lastBytes = 0;
+
+  if (UDP_SEND_NMEA && nmeaLen > 0) {
+    NmeaWriter w(datagram, sizeof(datagram));
+    w.begin("PESPU");
+    w.field();
+    w.number(++udpStats.sequence, 1);
+    w.end();
+    size_t len = w.length();
+    if (len + nmeaLen <= sizeof(datagram)) {
+      memcpy(datagram + len, nmea, nmeaLen);
+      sendDatagram(len + nmeaLen);
+    }
+  }
+
+  if (UDP_SEND_JSON && jsonLen > 0) {
+    int len = snprintf(datagram, sizeof(datagram), "{\"class\":\"SEQ\",\"seq\":%lu}\n",
+                       (unsigned long)++udpStats.sequence);
+    if (len > 0 && (size_t)len + jsonLen <= sizeof(datagram)) {
+      memcpy(datagram + len, json, jsonLen);
+      sendDatagram(len + jsonLen);
+    }
+  }
+}
+
+const UdpOutputStats& getUdpOutputStats() {
+  return udpStats;
+}
@@ -0,0 +1,23 @@
+#ifndef UDP_OUTPUT_H
+#define UDP_OUTPUT_H
+
+#include <Arduino.h>
+
+// One datagram per format per epoch, broadcast or multicast, so listener count
+// costs nothing. Every datagram opens with a sequence number:
+//   NMEA: "$PESPU,<seq>*CS" proprietary sentence, skipped by NMEA readers
+//   JSON: {"class":"SEQ","seq":<seq>} line, skipped by gpsd clients
+struct UdpOutputStats {
+  uint32_t sequence = 0;     // Last sequence number sent
+  uint32_t datagrams = 0;
+  uint32_t errors = 0;       // Datagrams the stack refused
+  uint32_t lastBytes = 0;    // Bytes sent for the last epoch
+  uint64_t totalBytes = 0;
+};
+
+void setupUDP();
+bool udpWantsJson();   // JSON datagrams enabled, so the broadcast frame must carry TPV/SKY
+void sendUdpEpoch(const char* nmea, size_t nmeaLen, const char* json, size_t jsonLen);
+const UdpOutputStats& getUdpOutputStats();
+
+#endif
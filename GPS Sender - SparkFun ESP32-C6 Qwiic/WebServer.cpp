@@ -9,13 +9,32 @@
 volatile bool otaInProgress = false;
 #include <ArduinoJson.h>
 #include "WebServer.h"
+#include "DashboardHtml.h"
 #include "Config.h"
 #include "Context.h"
 #include "LedControl.h" 
 #include "Storage.h"
+#include "GpsLogic.h"
+#include "GpsSnapshot.h"
+#include "TcpServer.h"
+#include "UdpOutput.h"
+#include "UbxPassthrough.h"
+#include "RtcmIngest.h"
+#include "EspNowPeers.h"
+#include "EspNowSender.h"
 
 AsyncWebServer webServer(WEB_PORT);
 AsyncWebSocket wsSerial("/ws/serial");
+AsyncWebSocket wsStatus("/ws/status");
+
+// Live status push: one frame per epoch, shared by every /ws/status subscriber
+static String statusFrame;                     // Reused between epochs, only touched by the loop task
+// Subscribers waiting for their first frame, queued by async_tcp and served by the loop task
+#define STATUS_JOIN_QUEUE 4
+static portMUX_TYPE statusJoinMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t statusJoinIds[STATUS_JOIN_QUEUE];
+static uint8_t statusJoinCount = 0;
+static StatusPushStats statusPushStats;
 
 // Circular buffer for serial logs
 #define LOG_BUFFER_SIZE 100
@@ -29,1149 +48,313 @@ int logBufferHead = 0;
 int logBufferCount = 0;
 SemaphoreHandle_t logMutex = NULL;
 
-const char index_html[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>ESP32 GPS Dashboard</title>
-  <style>
-    :root {
-      --bg-color: #121212;
-      --card-bg: #1e1e1e;
-      --accent: #00e5ff;
-      --text-main: #ffffff;
-      --text-muted: #aaaaaa;
-      --success: #00c853;
-      --warning: #ffd600;
-      --danger: #d50000;
-      /* Map Specific Colors */
-      --map-water: #161616;
-      --map-land: #2f2f2f;
-      --map-border: #3d3d3d;
-      --map-grid: rgba(0, 229, 255, 0.05);
-    }
-    * { margin: 0; padding: 0; box-sizing: border-box; }
-    body { font-family: 'Segoe UI', Roboto, Helvetica, Arial, sans-serif; background: var(--bg-color); color: var(--text-main); padding: 1rem; }
-    
-    /* Layout */
-    .container { max-width: 1200px; margin: 0 auto; }
-    .header { display: flex; justify-content: space-between; align-items: center; margin-bottom: 1.5rem; padding: 0 0.5rem; }
-    .status-badge { display: flex; align-items: center; gap: 8px; background: rgba(255,255,255,0.1); padding: 6px 12px; border-radius: 20px; font-size: 0.9rem; }
-    .status-dot { width: 10px; height: 10px; border-radius: 50%; background: var(--text-muted); box-shadow: 0 0 8px currentColor; transition: all 0.3s; }
-    
-    /* Grid System */
-    .dashboard { display: grid; grid-template-columns: repeat(auto-fit, minmax(300px, 1fr)); gap: 1rem; }
-    .card { background: var(--card-bg); border-radius: 16px; padding: 1.5rem; box-shadow: 0 4px 6px rgba(0,0,0,0.3); border: 1px solid rgba(255,255,255,0.05); }
-    .card-title { font-size: 0.85rem; text-transform: uppercase; letter-spacing: 1px; color: var(--text-muted); margin-bottom: 1rem; display: flex; justify-content: space-between; }
-    
-    /* Typography */
-    .big-value { font-size: 2rem; font-weight: 300; letter-spacing: -0.5px; }
-    .unit { font-size: 1rem; color: var(--text-muted); margin-left: 4px; }
-    .mono { font-family: 'Courier New', monospace; }
-    
-    /* Specific Components */
-    .coord-grid { display: grid; gap: 1rem; }
-    .coord-item { position: relative; }
-    .coord-label { display: block; font-size: 0.75rem; color: var(--text-muted); margin-bottom: 4px; }
-    .copy-btn { position: absolute; right: 0; top: 0; background: transparent; border: 1px solid rgba(255,255,255,0.2); color: var(--text-muted); padding: 2px 8px; border-radius: 4px; cursor: pointer; font-size: 0.7rem; transition: all 0.2s; }
-    .copy-btn:hover { border-color: var(--accent); color: var(--accent); }
-    
-    /* Compass & Speed */
-    .nav-row { display: flex; align-items: center; justify-content: space-around; }
-    .compass-container { position: relative; width: 120px; height: 120px; border: 2px solid rgba(255,255,255,0.1); border-radius: 50%; display: flex; justify-content: center; align-items: center; }
-    .compass-mark { position: absolute; font-size: 0.8rem; font-weight: bold; color: var(--text-muted); }
-    .mark-n { top: 5px; color: var(--accent); }
-    .mark-s { bottom: 5px; }
-    .mark-e { right: 8px; }
-    .mark-w { left: 8px; }
-    .needle { width: 4px; height: 100%; position: absolute; transition: transform 0.5s cubic-bezier(0.4, 0, 0.2, 1); }
-    .needle::before { content: ''; position: absolute; top: 15px; left: 0; border-left: 6px solid transparent; border-right: 6px solid transparent; border-bottom: 30px solid var(--accent); transform: translateX(-4px); }
-    .heading-text { position: absolute; font-size: 1.2rem; font-weight: bold; background: var(--card-bg); padding: 2px 6px; border-radius: 4px; }
-    
-    /* Stats Grid */
-    .stats-grid { display: grid; grid-template-columns: repeat(3, 1fr); gap: 10px; text-align: center; }
-    .stat-box { background: rgba(255,255,255,0.03); padding: 10px; border-radius: 8px; }
-    .stat-val { font-size: 1.1rem; font-weight: 500; display: block; }
-    .stat-lbl { font-size: 0.7rem; color: var(--text-muted); }
-    .stat-sub { font-size: 0.65rem; color: var(--accent); margin-top: 2px; }
-    .sub-val-row { display: flex; justify-content: center; gap: 10px; margin-top: 5px; font-size: 0.8rem; color: var(--text-muted); }
-    .sub-val-lbl { font-size: 0.7rem; margin-right: 3px; }
-    .sub-val-dat { color: var(--accent); font-family: 'Courier New', monospace; }
-
-    /* Forms */
-    input, select { width: 100%; background: rgba(0,0,0,0.2); border: 1px solid rgba(255,255,255,0.1); color: white; padding: 10px; border-radius: 8px; margin-top: 5px; }
-    .btn { width: 100%; padding: 12px; border: none; border-radius: 8px; font-weight: 600; cursor: pointer; margin-top: 10px; transition: opacity 0.2s; }
-    .btn-primary { background: var(--accent); color: #000; }
-    .btn-outline { background: transparent; border: 1px solid rgba(255,255,255,0.2); color: white; }
-    .btn-danger { background: var(--danger); color: white; }
-    .btn:hover { opacity: 0.9; }
-
-    .btn-muted { background: rgba(255,255,255,0.08); border: 1px solid rgba(255,255,255,0.1); color: var(--text-muted); padding: 8px 12px; font-size: 0.85rem; font-weight: normal; border-radius: 8px; height: 38px; box-sizing: border-box; }
-    .btn-muted:hover { background: rgba(255,255,255,0.15); color: white; border-color: rgba(255,255,255,0.3); }
-
-    /* Log Filter Select - Match button style */
-    #logFilter { 
-      background: rgba(255,255,255,0.08); 
-      border: 1px solid rgba(255,255,255,0.1); 
-      color: var(--text-muted); 
-      padding: 8px 12px; 
-      font-size: 0.85rem; 
-      font-weight: normal;
-      border-radius: 8px;
-      height: 38px;
-      box-sizing: border-box;
-      cursor: pointer;
-      appearance: none;
-      -webkit-appearance: none;
-      -moz-appearance: none;
-      background-image: url("data:image/svg+xml,%3Csvg xmlns='http://www.w3.org/2000/svg' width='12' height='8' viewBox='0 0 12 8'%3E%3Cpath fill='%23aaaaaa' d='M0 0l6 8 6-8z'/%3E%3C/svg%3E");
-      background-repeat: no-repeat;
-      background-position: right 10px center;
-      padding-right: 30px;
-    }
-    #logFilter:hover {
-      background-color: rgba(255,255,255,0.15);
-      color: white;
-      border-color: rgba(255,255,255,0.3);
-    }
-    #logFilter:focus {
-      outline: none;
-      border-color: var(--accent);
-    }
-    #logFilter option {
-      background: #1e1e1e;
-      color: white;
-      padding: 8px;
-    }
-
-    /* WiFi List */
-    .wifi-list { margin-top: 10px; max-height: 150px; overflow-y: auto; }
-    .wifi-item { display: flex; justify-content: space-between; padding: 8px; border-bottom: 1px solid rgba(255,255,255,0.05); cursor: pointer; }
-    .wifi-item:hover { background: rgba(255,255,255,0.05); }
-
-    /* Info Rows */
-    .info-row { display: flex; justify-content: space-between; align-items: center; padding: 6px 0; border-bottom: 1px solid rgba(255,255,255,0.05); }
-    .info-label { font-size: 0.75rem; color: var(--text-muted); text-transform: uppercase; letter-spacing: 0.5px; }
-    .info-val { font-family: 'Courier New', monospace; color: var(--accent); font-size: 0.9rem; }
-
-    /* Interactive Map */
-    .globe-container { width: 100%; height: 350px; background: var(--map-water); border-radius: 8px; position: relative; overflow: hidden; touch-action: none; cursor: grab; }
-    .globe-container:active { cursor: grabbing; }
-    canvas { width: 100%; height: 100%; display: block; }
-    
-    .map-controls { position: absolute; bottom: 10px; right: 10px; display: flex; gap: 5px; }
-    .map-btn { width: 30px; height: 30px; background: rgba(30,30,30,0.9); border: 1px solid rgba(255,255,255,0.2); color: white; border-radius: 4px; font-weight: bold; cursor: pointer; display: flex; justify-content: center; align-items: center; transition: all 0.2s; }
-    .map-btn:hover { background: var(--accent); color: black; border-color: var(--accent); }
-    
-    .map-info-overlay { position: absolute; top: 10px; left: 10px; background: rgba(0,0,0,0.6); padding: 4px 8px; border-radius: 4px; font-size: 0.7rem; color: var(--text-muted); pointer-events: none; border: 1px solid rgba(255,255,255,0.1); }
-
-    /* Serial Logs */
-    .log-container { height: 350px; overflow-y: auto; background: rgba(0,0,0,0.3); border-radius: 8px; padding: 10px; font-family: 'Courier New', monospace; font-size: 0.75rem; border: 1px solid rgba(255,255,255,0.05); }
-    .log-container::-webkit-scrollbar { width: 8px; }
-    .log-container::-webkit-scrollbar-track { background: rgba(0,0,0,0.2); border-radius: 4px; }
-    .log-container::-webkit-scrollbar-thumb { background: rgba(255,255,255,0.2); border-radius: 4px; }
-    .log-container::-webkit-scrollbar-thumb:hover { background: rgba(255,255,255,0.3); }
-    .log-line { padding: 2px 0; border-bottom: 1px solid rgba(255,255,255,0.02); white-space: pre-wrap; word-wrap: break-word; }
-    .log-time { color: var(--text-muted); margin-right: 10px; }
-    .log-msg { color: var(--text-main); }
-    .log-controls { display: flex; gap: 8px; margin-bottom: 10px; }
-    .ws-status { display: flex; align-items: center; gap: 6px; font-size: 0.75rem; padding: 4px 10px; background: rgba(255,255,255,0.05); border-radius: 12px; }
-    .ws-dot { width: 8px; height: 8px; border-radius: 50%; background: var(--danger); box-shadow: 0 0 6px currentColor; }
-    .ws-dot.connected { background: var(--success); }
+// Everything the dashboard shows; served by /api/status and pushed over /ws/status
+static void buildStatusJson(JsonDocument& doc) {
+  GpsSnapshot snap;
+  readGpsSnapshot(snap);
 
-    @media (max-width: 800px) {
-      .big-value { font-size: 1.6rem; }
-      .dashboard { grid-template-columns: 1fr; }
-    }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <div class="header">
-      <h2>ESP32 GPS Dashboard</h2>
-      <a href="https://github.com/chvvkumar/ESP32-NINA-GPS" target="_blank" style="color: var(--accent); text-decoration: none; font-size: 0.9rem; border: 1px solid var(--accent); padding: 4px 10px; border-radius: 4px;">GitHub</a>
-    </div>
-
-    <div class="dashboard">
-      <div class="card">
-        <div class="card-title" style="display:flex; justify-content:space-between; align-items:center;">
-          <span>Position</span>
-          <div style="display:flex; gap:8px; align-items:center;">
-            <div class="status-badge" style="margin-left:8px;">
-                <div id="statusDot" class="status-dot"></div>
-                <span id="fixStatus">Initializing...</span>
-            </div>
-          </div>
-        </div>
-        <div class="coord-grid">
-          <div class="coord-item">
-            <span class="coord-label">LATITUDE</span>
-            <div class="big-value mono" id="lat">0.0000000</div>
-            <button class="copy-btn" onclick="copy('lat', this)">COPY</button>
-          </div>
-          <div class="coord-item">
-            <span class="coord-label">LONGITUDE</span>
-            <div class="big-value mono" id="lon">0.0000000</div>
-            <button class="copy-btn" onclick="copy('lon', this)">COPY</button>
-          </div>
-          <div class="coord-item">
-            <span class="coord-label">ALTITUDE</span>
-            <div class="big-value mono" id="alt">0.0 m</div>
-            <div class="sub-val-row">
-               <span><span class="sub-val-lbl">MIN</span><span class="sub-val-dat" id="altMin">--</span></span>
-               <span><span class="sub-val-lbl">MAX</span><span class="sub-val-dat" id="altMax">--</span></span>
-            </div>
-            <button class="copy-btn" onclick="copy('alt', this)">COPY</button>
-          </div>
-          
-          <div style="border-top: 1px solid rgba(255,255,255,0.1); padding-top: 1rem; margin-top: 0.5rem; display: flex; justify-content: space-between;">
-             <div><span class="coord-label">LOCAL TIME</span><span class="stat-val" id="localTime">--:--:--</span></div>
-             <div style="text-align: right;"><span class="coord-label">UTC TIME</span><span class="stat-val" id="time">--:--:--</span></div>
-          </div>
-        </div>
-      </div>
-
-      <div class="card">
-        <div class="card-title">Navigation</div>
-        <div class="nav-row">
-          <div class="compass-container">
-            <div class="compass-mark mark-n">N</div>
-            <div class="compass-mark mark-e">E</div>
-            <div class="compass-mark mark-s">S</div>
-            <div class="compass-mark mark-w">W</div>
-            <div class="needle" id="compassNeedle"></div>
-            <div class="heading-text" id="heading">0&deg;</div>
-          </div>
-          <div style="text-align: center;">
-            <div class="coord-label">SPEED</div>
-            <div class="big-value" id="speed">0.0</div>
-            <div class="unit">m/s</div>
-            <div class="sub-val-row">
-               <span><span class="sub-val-lbl">MAX</span><span class="sub-val-dat" id="speedMax">--</span></span>
-            </div>
-          </div>
-        </div>
-        <div class="stats-grid" style="margin-top: 1.5rem;">
-           <div class="stat-box">
-             <span class="stat-val" id="hAcc">0 m</span>
-             <span class="stat-lbl">H. Acc</span>
-             <div class="stat-sub">Min: <span id="hAccMin">--</span></div>
-           </div>
-           <div class="stat-box">
-             <span class="stat-val" id="vAcc">0 m</span>
-             <span class="stat-lbl">V. Acc</span>
-             <div class="stat-sub">Min: <span id="vAccMin">--</span></div>
-           </div>
-           <div class="stat-box">
-             <span class="stat-val" id="ttff">--</span>
-             <span class="stat-lbl">TTFF</span>
-           </div>
-        </div>
-      </div>
-
-
-      <div class="card">
-        <div class="card-title">Signal Quality</div>
-        
-        <div class="stats-grid" style="grid-template-columns: repeat(3, 1fr); margin-bottom: 10px;">
-          <div class="stat-box">
-            <span class="stat-val" id="satsUsed">--</span>
-            <span class="stat-lbl">Used Sats</span>
-            <div class="stat-sub">Max: <span id="satsMax">--</span></div>
-          </div>
-          <div class="stat-box">
-            <span class="stat-val" id="satsVisible">--</span>
-            <span class="stat-lbl">Visible Sats</span>
-            <div class="stat-sub">Max: <span id="satsVisibleMax">--</span></div>
-          </div>
-          <div class="stat-box">
-            <span class="stat-val" id="uptime">--</span>
-            <span class="stat-lbl">Uptime</span>
-          </div>
-        </div>
-
-        <div class="stats-grid">
-          <div class="stat-box">
-            <span class="stat-val" id="pdop">--</span>
-            <span class="stat-lbl">PDOP</span>
-            <div class="stat-sub">Min: <span id="pdopMin">--</span></div>
-          </div>
-          <div class="stat-box">
-            <span class="stat-val" id="hdop">--</span>
-            <span class="stat-lbl">HDOP</span>
-            <div class="stat-sub">Min: <span id="hdopMin">--</span></div>
-          </div>
-          <div class="stat-box">
-            <span class="stat-val" id="vdop">--</span>
-            <span class="stat-lbl">VDOP</span>
-            <div class="stat-sub">Min: <span id="vdopMin">--</span></div>
-          </div>
-        </div>
-        
-        <div style="margin-top: 1.5rem;">
-           <div class="card-title">Configuration</div>
-           <div style="display: grid; grid-template-columns: 1fr 1fr; gap: 10px;">
-             <div>
-                <label class="coord-label">LED MODE</label>
-                <select id="ledMode" onchange="setLed(this.value)">
-                  <option value="0">Off</option> <option value="1">On</option>
-                  <option value="2">Blink (Read)</option> <option value="3">Blink (Fix)</option>
-                  <option value="4">Blink (Move)</option>
-                </select>
-             </div>
-             <div>
-                <label class="coord-label">UPDATE RATE</label>
-                <select id="rate" onchange="setRate(this.value)">
-                  <option value="1000">1s</option> <option value="5000">5s</option>
-                  <option value="10000">10s</option> <option value="30000">30s</option>
-                </select>
-             </div>
-           </div>
-           
-           <div style="margin-top: 15px;">
-              <div class="info-row">
-                  <span class="info-label">STATION IP</span>
-                  <span class="info-val" id="stIp">--</span>
-              </div>
-              <div class="info-row">
-                  <span class="info-label">AP IP</span>
-                  <span class="info-val" id="apIp">--</span>
-              </div>
-              <div class="info-row">
-                  <span class="info-label">NINA TCP PORT</span>
-                  <span class="info-val" id="tcpPort">--</span>
-              </div>
-              <div class="info-row">
-                  <span class="info-label">CPU TEMP</span>
-                  <span class="info-val" id="cpuTemp">--</span>
-              </div>
-           </div>
-        </div>
-      </div>
-
-      <div class="card">
-        <div class="card-title">Map</div>
-        <div class="globe-container" id="mapContainer">
-           <canvas id="mapCanvas"></canvas>
-        </div>
-      </div>
-
-      <div class="card">
-        <div class="card-title">WiFi Setup</div>
-        <button class="btn btn-outline" id="scanBtn" onclick="scanWifi()">Scan Networks</button>
-        <div id="wifiList" class="wifi-list"></div>
-        <div style="margin-top: 1rem;">
-          <input type="text" id="ssid" placeholder="Network SSID">
-          <input type="password" id="pass" placeholder="Password">
-          <button class="btn btn-muted" id="saveBtn" style="margin-top: 10px; width: 100%;" onclick="saveWifi()">Connect & Save</button>
-          <button class="btn btn-muted" id="demoBtn" style="margin-top: 10px; width: 100%;" onclick="toggleDemoMode()">Demo Mode: <span id="demoStatus">OFF</span></button>
-        </div>
-      </div>
-
-      <div class="card">
-        <div class="card-title">System Settings</div>
-        
-        <div class="info-row" style="margin-bottom: 10px; border-bottom: none;">
-             <span class="info-label">WiFi MAC</span>
-             <span class="info-val" id="wifiMac" style="font-family: monospace; font-size: 0.9em;">--</span>
-        </div>
-        
-        <div class="info-row" style="margin-bottom: 10px; border-bottom: none;">
-             <span class="info-label">ESP-NOW STATUS</span>
-             <span class="info-val" id="enStatus">--</span>
-        </div>
-        <div class="info-row" style="margin-bottom: 15px;">
-             <span class="info-label">LAST ERROR</span>
-             <span class="info-val" id="enError" style="color: var(--danger);">--</span>
-        </div>
-        
-        <div id="espNowClients" style="margin-bottom: 15px;"></div>
-
-        <div style="display: grid; grid-template-columns: 1fr 1fr; gap: 10px; margin-bottom: 15px;">
-             <button class="btn btn-muted" onclick="clearRam()">Clear RAM Stats</button>
-             <button class="btn btn-muted" onclick="clearStorage()">Clear Flash Storage</button>
-        </div>
-        <div style="margin-bottom: 15px;">
-             <button class="btn btn-muted" style="width: 100%;" onclick="location.href='/update'">OTA Firmware Update</button>
-        </div>
-        <button class="btn btn-muted" style="width: 100%; border-color: rgba(213, 0, 0, 0.4); color: rgba(255, 100, 100, 0.8);" onclick="rebootEsp()">Reboot System</button>
-      </div>
-
-      <div class="card" style="grid-column: span 3;">
-        <div class="card-title" style="align-items: center;">
-          <span>Serial Logs</span>
-          <div class="ws-status">
-            <div class="ws-dot" id="wsDot"></div>
-            <span id="wsStatus">Disconnected</span>
-          </div>
-        </div>
-        <div class="log-controls">
-          <button class="btn-muted" style="flex: 1;" onclick="toggleAutoScroll()">
-            <span id="autoScrollText">Auto-Scroll: ON</span>
-          </button>
-          <button class="btn-muted" style="flex: 1;" onclick="copyLogs()">Copy Logs</button>
-          <button class="btn-muted" style="flex: 1;" onclick="clearLogs()">Clear Logs</button>
-          <select class="btn-muted" style="flex: 1; cursor: pointer;" id="logFilter" onchange="applyLogFilter()">
-            <option value="all">Show All</option>
-            <option value="no-gps">Hide GPS</option>
-            <option value="no-espnow">Hide ESP-NOW</option>
-            <option value="gps-only">GPS Only</option>
-            <option value="espnow-only">ESP-NOW Only</option>
-          </select>
-        </div>
-        <div class="log-container" id="logContainer"></div>
-      </div>
-    </div>
-  </div>
-
-  <script>
-    let intervalId = null;
-    let currentInterval = 5000;
-    let isEditing = false;
-    
-    function updateData() {
-      fetch('/api/status').then(r => r.json()).then(d => {
-        const ids = ['lat','lon','alt','speed','hAcc','vAcc','pdop','hdop','vdop','time','localTime','fixStatus'];
-        ids.forEach(id => {
-          const el = document.getElementById(id);
-          if(el) {
-             let val = d[id];
-             if(typeof val === 'number') {
-                if(id.includes('dop')) val = val.toFixed(2);
-                else if(id.includes('lat') || id.includes('lon')) val = val.toFixed(7);
-                else if(id.includes('Acc')) val = val.toFixed(1) + ' m';
-                else if(id === 'alt') val = val.toFixed(2) + ' m';
-                else val = val.toFixed(2);
-             }
-             el.textContent = val;
-          }
-        });
-        
-        // Min/Max updates
-        if(d.altMin < 90000) document.getElementById('altMin').textContent = d.altMin.toFixed(2);
-        if(d.altMax > -90000) document.getElementById('altMax').textContent = d.altMax.toFixed(2);
-        document.getElementById('speedMax').textContent = d.speedMax.toFixed(2);
-        document.getElementById('satsMax').textContent = d.satsMax;
-        document.getElementById('satsVisibleMax').textContent = d.satsVisibleMax;
-        
-        if(d.pdopMin < 100) document.getElementById('pdopMin').textContent = d.pdopMin.toFixed(2);
-        if(d.hdopMin < 100) document.getElementById('hdopMin').textContent = d.hdopMin.toFixed(2);
-        if(d.vdopMin < 100) document.getElementById('vdopMin').textContent = d.vdopMin.toFixed(2);
-
-        if(d.hAccMin < 90000) document.getElementById('hAccMin').textContent = d.hAccMin.toFixed(1) + ' m';
-        if(d.vAccMin < 90000) document.getElementById('vAccMin').textContent = d.vAccMin.toFixed(1) + ' m';
-
-        document.getElementById('ttff').textContent = d.ttff >= 0 ? d.ttff + 's' : '--';
-        document.getElementById('satsUsed').textContent = d.sats;
-        document.getElementById('satsVisible').textContent = d.satsVisible;
-        document.getElementById('uptime').innerHTML = d.uptime;
-        document.getElementById('stIp').textContent = d.stationIp;
-        document.getElementById('apIp').textContent = d.apIp;
-        document.getElementById('tcpPort').textContent = d.tcpPort;
-        if(d.cpuTemp !== undefined) document.getElementById('cpuTemp').innerHTML = d.cpuTemp.toFixed(1) + '&deg;C';
-        
-        document.getElementById('enStatus').textContent = d.enStatus;
-        document.getElementById('enError').textContent = d.enError;
-        
-        // Update MAC addresses
-        if(d.wifiMac) document.getElementById('wifiMac').textContent = d.wifiMac;
-        
-        // Update ESP-NOW client metrics
-        updateEspNowClients(d.enClients || []);
-
-        document.getElementById('heading').innerHTML = Math.round(d.heading) + '&deg;';
-        document.getElementById('compassNeedle').style.transform = `rotate(${d.heading}deg)`;
-        
-        const dot = document.getElementById('statusDot');
-        if(d.fixStatus.includes("3D") || d.fixStatus.includes("2D")) {
-            dot.style.background = "var(--success)";
-            dot.style.boxShadow = "0 0 10px var(--success)";
-        } else if(d.connected) {
-            dot.style.background = "var(--warning)";
-            dot.style.boxShadow = "0 0 10px var(--warning)";
-        } else {
-            dot.style.background = "var(--danger)";
-        }
-
-        // Update demo mode state from backend
-        if(d.demoMode !== undefined && d.demoMode !== demoModeActive) {
-            demoModeActive = d.demoMode;
-            updateDemoModeUI();
-        }
-
-        if(!isEditing) {
-            if(document.activeElement !== document.getElementById('ledMode')) 
-               document.getElementById('ledMode').value = d.ledMode;
-            
-            const rateEl = document.getElementById('rate');
-            if(document.activeElement !== rateEl && d.rate) {
-               rateEl.value = d.rate;
-               if(d.rate != currentInterval) {
-                   clearInterval(intervalId);
-                   currentInterval = d.rate;
-                   intervalId = setInterval(updateData, currentInterval);
-               }
-            }
-        }
-        if(window.updateMapPos) window.updateMapPos(d.lat, d.lon);
-      }).catch(e => console.log(e));
-    }
-
-    function setLed(v) { fetch('/api/set_led?mode='+v); }
-    function setRate(v) { 
-        fetch('/api/set_interval?interval='+v);
-        clearInterval(intervalId);
-        currentInterval = parseInt(v);
-        if(v > 0) intervalId = setInterval(updateData, v);
-    }
-    
-    function copy(id, btn) {
-        const val = document.getElementById(id).textContent;
-        if (navigator.clipboard && navigator.clipboard.writeText) {
-            navigator.clipboard.writeText(val).then(() => showCopyFeedback(btn))
-            .catch(err => copyFallback(val, btn));
-        } else {
-            copyFallback(val, btn);
-        }
-    }
-
-    function copyFallback(text, btn) {
-        const textArea = document.createElement("textarea");
-        textArea.value = text;
-        textArea.style.position = "fixed"; 
-        textArea.style.opacity = "0";
-        document.body.appendChild(textArea);
-        textArea.focus();
-        textArea.select();
-        try {
-            const successful = document.execCommand('copy');
-            if(successful) showCopyFeedback(btn);
-        } catch (err) { console.error('Copy failed'); }
-        document.body.removeChild(textArea);
-    }
-
-    function showCopyFeedback(btn) {
-        const orig = btn.textContent;
-        btn.textContent = "COPIED";
-        btn.style.borderColor = "var(--success)";
-        btn.style.color = "var(--success)";
-        setTimeout(() => {
-            btn.textContent = orig;
-            btn.style.borderColor = "";
-            btn.style.color = "";
-        }, 1500);
-    }
-
-    function scanWifi() {
-        const list = document.getElementById('wifiList');
-        const btn = document.getElementById('scanBtn');
-        btn.textContent = "Scanning..."; btn.disabled = true;
-        list.innerHTML = '';
-        fetch('/api/scan').then(r => r.json()).then(nets => {
-            btn.textContent = "Scan Networks"; btn.disabled = false;
-            nets.forEach(n => {
-                const div = document.createElement('div');
-                div.className = 'wifi-item';
-                div.innerHTML = `<span>${n.ssid}</span><span style="color:var(--text-muted)">${n.rssi}dB</span>`;
-                div.onclick = () => {
-                    document.getElementById('ssid').value = n.ssid;
-                    document.getElementById('pass').focus();
-                };
-                list.appendChild(div);
-            });
-        });
-    }
-
-    function saveWifi() {
-        const s = document.getElementById('ssid').value;
-        const p = document.getElementById('pass').value;
-        if(!s) return alert("SSID required");
-        const btn = document.getElementById('saveBtn');
-        btn.textContent = "Saving...";
-        fetch(`/api/save_wifi?ssid=${encodeURIComponent(s)}&pass=${encodeURIComponent(p)}`)
-        .then(r => { alert("Saved. Rebooting..."); location.reload(); });
-    }
-
-    let demoModeActive = false;
-    function toggleDemoMode() {
-        const newState = !demoModeActive;
-        console.log(`Demo Mode: ${newState ? 'ENABLING' : 'DISABLING'}...`);
-        fetch(`/api/set_demo_mode?enabled=${newState ? 1 : 0}`)
-        .then(r => r.text())
-        .then(() => {
-            demoModeActive = newState;
-            updateDemoModeUI();
-            console.log(`Demo Mode: ${newState ? 'ENABLED' : 'DISABLED'}`);
-        })
-        .catch(err => {
-            console.error('Failed to toggle demo mode:', err);
-        });
-    }
-
-    function updateDemoModeUI() {
-        const statusSpan = document.getElementById('demoStatus');
-        const btn = document.getElementById('demoBtn');
-        
-        if(demoModeActive) {
-            statusSpan.textContent = 'ON';
-            statusSpan.style.color = 'var(--success)';
-            btn.style.borderColor = 'var(--success)';
-            btn.style.background = 'rgba(0, 200, 83, 0.1)';
-        } else {
-            statusSpan.textContent = 'OFF';
-            statusSpan.style.color = 'var(--text-muted)';
-            btn.style.borderColor = '';
-            btn.style.background = '';
-        }
-    }
+  unsigned long now = millis();
+  doc["stationIp"] = WiFi.localIP().toString();
+  doc["apIp"] = WiFi.softAPIP().toString();
+  doc["tcpPort"] = TCP_PORT;
+  doc["cpuTemp"] = snap.cpuTemp;
+  
+  // Add MAC addresses
+  doc["wifiMac"] = WiFi.macAddress();
+  doc["espnowMac"] = WiFi.macAddress();  // ESP-NOW uses same MAC as WiFi
+  
+  doc["connected"] = snap.isConnected;
+  doc["fixStatus"] = snap.fixStatus;
+  doc["sats"] = snap.satellites;
+  doc["satsVisible"] = snap.satellitesVisible;
+  doc["ttff"] = snap.hadFirstFix ? snap.ttffSeconds : -1;
+  doc["pdop"] = snap.pdop;
+  doc["hdop"] = snap.hdop;
+  doc["vdop"] = snap.vdop;
+  doc["time"] = snap.timeStr;
+  doc["localTime"] = snap.localTimeStr;
+  doc["lat"] = snap.lat;
+  doc["lon"] = snap.lon;
+  doc["alt"] = snap.alt;
+  doc["altMin"] = snap.altMin;
+  doc["altMax"] = snap.altMax;
+  
+  doc["speed"] = snap.speed;
+  doc["speedMax"] = snap.speedMax;
+  
+  doc["heading"] = snap.heading;
+  doc["hAcc"] = snap.hAcc;
+  doc["vAcc"] = snap.vAcc;
+  doc["hAccMin"] = snap.hAccMin;
+  doc["vAccMin"] = snap.vAccMin;
+  
+  doc["satsMax"] = snap.satellitesMax;
+  doc["satsVisibleMax"] = snap.satellitesVisibleMax;
+  doc["pdopMin"] = snap.pdopMin;
+  doc["hdopMin"] = snap.hdopMin;
+  doc["vdopMin"] = snap.vdopMin;
+
+  doc["ledMode"] = (int)gpsData.ledMode;
+  doc["ledBlinkMs"] = LED_BLINK_DURATION_MS;
+  doc["rate"] = gpsData.gpsInterval;
+  doc["demoMode"] = gpsData.demoMode;
+  doc["i2cBytes"] = snap.i2cBytesPerEpoch;
+  doc["i2cTransactions"] = snap.i2cTransactionsPerEpoch;
+  doc["epoch"] = snap.version;
+
+  // Live status push
+  JsonObject push = doc["statusPush"].to<JsonObject>();
+  push["subscribers"] = statusPushStats.subscribers;
+  push["frames"] = statusPushStats.frames;
+  push["bytes"] = statusPushStats.lastBytes;
+  push["buildUs"] = statusPushStats.lastBuildUs;
+  push["buildMaxUs"] = statusPushStats.maxBuildUs;
+
+  // GNSS task acquisition timing
+  const GpsTaskStats& gpsTask = getGpsTaskStats();
+  JsonObject task = doc["gpsTask"].to<JsonObject>();
+  task["epochs"] = gpsTask.epochs;
+  task["overwritten"] = gpsTask.epochsOverwritten;
+  task["intervalMs"] = gpsTask.lastIntervalMs;
+  task["jitterUs"] = gpsTask.lastJitterUs;
+  task["jitterMaxUs"] = gpsTask.maxJitterUs;
+  task["jitterMeanUs"] = gpsTask.meanJitterUs;
+  task["stackFree"] = gpsTask.stackFree;
+  task["ppsEdges"] = gpsTask.ppsEdges;
+
+  // TCP broadcast cost
+  const TcpBroadcastStats& tcpStats = getTcpBroadcastStats();
+  JsonObject tcp = doc["tcp"].to<JsonObject>();
+  tcp["broadcasts"] = tcpStats.broadcasts;
+  tcp["frameBytes"] = tcpStats.lastFrameBytes;
+  tcp["bytes"] = tcpStats.lastBytes;
+  tcp["clients"] = tcpStats.lastClients;
+  tcp["backlogged"] = tcpStats.lastBacklogged;
+  tcp["allocs"] = tcpStats.lastAllocs;
+  tcp["allocsTotal"] = tcpStats.totalAllocs;
+  tcp["bytesTotal"] = tcpStats.totalBytes;
+  const TcpConnectStats& connStats = getTcpConnectStats();
+  tcp["connects"] = connStats.connects;
+  tcp["rejected"] = connStats.rejected;
+  tcp["connectsFromCache"] = connStats.servedFromCache;
+  tcp["firstByteUs"] = connStats.lastFirstByteUs;
+  tcp["firstByteMaxUs"] = connStats.maxFirstByteUs;
+
+  // UDP output
+  const UdpOutputStats& udpStats = getUdpOutputStats();
+  JsonObject udp = doc["udp"].to<JsonObject>();
+  udp["enabled"] = UDP_OUTPUT_ENABLED;
+  udp["port"] = UDP_PORT;
+  udp["seq"] = udpStats.sequence;
+  udp["datagrams"] = udpStats.datagrams;
+  udp["errors"] = udpStats.errors;
+  udp["bytes"] = udpStats.lastBytes;
+  udp["bytesTotal"] = udpStats.totalBytes;
+
+  // Raw UBX passthrough
+  UbxPassthroughStats ubxStats = getUbxPassthroughStats();
+  JsonObject ubx = doc["ubx"].to<JsonObject>();
+  ubx["enabled"] = UBX_RAW_ENABLED;
+  ubx["port"] = UBX_RAW_PORT;
+  ubx["clients"] = ubxStats.clients;
+  ubx["rejected"] = ubxStats.rejected;
+  ubx["bytesIn"] = ubxStats.bytesIn;
+  ubx["bytesOut"] = ubxStats.bytesOut;
+  ubx["dropped"] = ubxStats.bytesDropped;
+  ubx["cmdBytes"] = ubxStats.commandBytes;
+  ubx["cmdDropped"] = ubxStats.commandBytesDropped;
+
+  // RTCM correction ingest
+  const RtcmStats& rtcmStats = getRtcmStats();
+  JsonObject rtcm = doc["rtcm"].to<JsonObject>();
+  rtcm["enabled"] = RTCM_INPUT_ENABLED;
+  rtcm["inputConnected"] = rtcmStats.inputConnected;
+  rtcm["ntripConnected"] = rtcmStats.ntripConnected;
+  rtcm["ntripConnects"] = rtcmStats.ntripConnects;
+  rtcm["frames"] = rtcmStats.frames;
+  rtcm["crcErrors"] = rtcmStats.crcErrors;
+  rtcm["dropped"] = rtcmStats.dropped;
+  rtcm["pushed"] = rtcmStats.pushed;
+  rtcm["bytesTotal"] = rtcmStats.bytesPushed;
+  rtcm["bytesPerSec"] = rtcmStats.bytesPerSec;
+  rtcm["lastType"] = rtcmStats.lastMessageType;
+  if (rtcmStats.lastPushMs != 0) rtcm["ageMs"] = millis() - rtcmStats.lastPushMs; // Age of correction
+  else rtcm["ageMs"] = nullptr;
+  rtcm["latencyUs"] = rtcmStats.lastLatencyUs;
+  rtcm["latencyMaxUs"] = rtcmStats.maxLatencyUs;
+
+  // TCP per-client queues
+  TcpClientStats clientStats[TCP_MAX_CLIENTS];
+  size_t clientCount = getTcpClientStats(clientStats, TCP_MAX_CLIENTS);
+  JsonArray tcpClients = tcp["clientList"].to<JsonArray>();
+  for (size_t i = 0; i < clientCount; i++) {
+    JsonObject c = tcpClients.add<JsonObject>();
+    c["ip"] = clientStats[i].ip.toString();
+    c["port"] = clientStats[i].port;
+    c["gpsd"] = clientStats[i].isGpsd;
+    c["nmea"] = clientStats[i].nmea;
+    c["json"] = clientStats[i].json;
+    c["queued"] = clientStats[i].framesQueued;
+    c["sent"] = clientStats[i].framesSent;
+    c["dropped"] = clientStats[i].framesDropped;
+    c["pending"] = clientStats[i].pending;
+    c["lagMs"] = clientStats[i].lagMs;
+    c["cmds"] = clientStats[i].commands;
+    c["cmdsRejected"] = clientStats[i].commandsRejected;
+  }
 
-    function clearRam() {
-        if(confirm("Reset current session statistics (RAM)? This will restart tracking from now.")) {
-            fetch('/api/clear_ram').then(r => {
-                 resetDisplay();
-            });
-        }
-    }
-    
-    function clearStorage() {
-        if(confirm("Erase all saved statistics from Flash memory?")) {
-            fetch('/api/clear_storage').then(r => {
-                 alert("Storage cleared. Reboot to see effect or Clear RAM to reset display.");
-            });
-        }
+  doc["enStatus"] = gpsData.espNowStatus;
+  doc["enError"] = gpsData.espNowError;
+  
+  // ESP-NOW Per-Client Metrics
+  JsonArray clients = doc["enClients"].to<JsonArray>();
+  EspNowTxStats broadcastTx;
+  getEspNowTxStats(-1, broadcastTx);
+  for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+    // Skip uninitialized clients (check if MAC is all zeros)
+    bool isInitialized = false;
+    for (int j = 0; j < 6; j++) {
+      if (gpsData.espNowClients[i].macAddr[j] != 0) {
+        isInitialized = true;
+        break;
+      }
     }
     
-    function resetDisplay() {
-         ['altMin','altMax','speedMax','satsMax','satsVisibleMax','pdopMin','hdopMin','vdopMin','hAccMin','vAccMin']
-         .forEach(id => {
-             const el = document.getElementById(id);
-             if(el) el.textContent = "--";
-         });
-    }
-
-    function updateEspNowClients(clients) {
-        const container = document.getElementById('espNowClients');
-        if (!clients || clients.length === 0) {
-            container.innerHTML = '';
-            return;
-        }
-        
-        let html = '<div style="border-top: 1px solid rgba(255,255,255,0.1); padding-top: 10px; margin-top: 10px;">';
-        html += '<div class="coord-label" style="margin-bottom: 10px;">ESP-NOW CLIENTS</div>';
-        
-        clients.forEach((client, idx) => {
-            // Determine connection status based ONLY on pong response time
-            const pongSeconds = client.secondsSinceLastPong;
-            const isConnected = (pongSeconds < 30 && pongSeconds < 9999);
-            
-            // Format transmission time
-            const txSeconds = client.secondsSinceLastTx;
-            let txDisplay, txColor;
-            
-            if (txSeconds >= 9999) {
-                txDisplay = 'Never';
-                txColor = 'var(--text-muted)';
-            } else if (txSeconds < 60) {
-                txDisplay = txSeconds + 's';
-                txColor = txSeconds < 10 ? 'var(--success)' : (txSeconds < 30 ? 'var(--warning)' : 'var(--danger)');
-            } else if (txSeconds < 3600) {
-                const mins = Math.floor(txSeconds / 60);
-                const secs = txSeconds % 60;
-                txDisplay = mins + 'm ' + secs + 's';
-                txColor = 'var(--danger)';
-            } else {
-                const hours = Math.floor(txSeconds / 3600);
-                const mins = Math.floor((txSeconds % 3600) / 60);
-                txDisplay = hours + 'h ' + mins + 'm';
-                txColor = 'var(--danger)';
-            }
-            
-            // Format pong response time
-            let pongDisplay, pongColor;
-            
-            if (pongSeconds >= 9999) {
-                pongDisplay = 'Never';
-                pongColor = 'var(--text-muted)';
-            } else if (pongSeconds < 60) {
-                pongDisplay = pongSeconds + 's';
-                pongColor = pongSeconds < 10 ? 'var(--success)' : (pongSeconds < 30 ? 'var(--warning)' : 'var(--danger)');
-            } else if (pongSeconds < 3600) {
-                const mins = Math.floor(pongSeconds / 60);
-                const secs = pongSeconds % 60;
-                pongDisplay = mins + 'm ' + secs + 's';
-                pongColor = 'var(--danger)';
-            } else {
-                const hours = Math.floor(pongSeconds / 3600);
-                const mins = Math.floor((pongSeconds % 3600) / 60);
-                pongDisplay = hours + 'h ' + mins + 'm';
-                pongColor = 'var(--danger)';
-            }
-            
-            // Connection status indicator (based on pong only)
-            const statusColor = isConnected ? 'var(--success)' : 'var(--danger)';
-            const statusText = isConnected ? 'CONNECTED' : 'DISCONNECTED';
-            
-            html += '<div style="background: rgba(255,255,255,0.03); padding: 10px; border-radius: 8px; margin-bottom: 8px;">';
-            html += `<div style="display: flex; justify-content: space-between; align-items: center; margin-bottom: 5px;">`;
-            html += `<span style="font-family: 'Courier New', monospace; font-size: 0.8rem; color: var(--accent);">${client.mac}</span>`;
-            html += `<span style="font-size: 0.65rem; padding: 2px 6px; background: ${statusColor}20; color: ${statusColor}; border-radius: 3px; font-weight: bold;">${statusText}</span>`;
-            html += '</div>';
-            html += `<div style="display: flex; gap: 8px; font-size: 0.7rem;">`;
-            html += `<span style="flex: 1; padding: 3px 8px; background: rgba(255,255,255,0.05); color: ${txColor}; border-radius: 3px; text-align: center;">Last TX: ${txDisplay}</span>`;
-            html += `<span style="flex: 1; padding: 3px 8px; background: rgba(255,255,255,0.05); color: ${pongColor}; border-radius: 3px; text-align: center;">Last RX: ${pongDisplay}</span>`;
-            html += '</div>';
-            html += '</div>';
-        });
-        
-        html += '</div>';
-        container.innerHTML = html;
-    }
-
-    function rebootEsp() {
-        if(confirm("Are you sure you want to reboot the system?")) {
-            fetch('/api/reboot').then(r => {
-                alert("System is rebooting... Page will reload in 10 seconds.");
-                setTimeout(() => location.reload(), 10000);
-            });
-        }
-    }
-
-    document.getElementById('ledMode').addEventListener('focus', () => isEditing = true);
-    document.getElementById('ledMode').addEventListener('blur', () => isEditing = false);
-    intervalId = setInterval(updateData, 5000);
-    updateData();
-
-    // ==========================================
-    // HIGH FIDELITY VECTOR MAP ENGINE
-    // ==========================================
-    const canvas = document.getElementById('mapCanvas');
-    const ctx = canvas.getContext('2d');
-    let mapWidth, mapHeight;
+    if (!isInitialized) continue;
     
-    // Viewport State
-    let camX = 0, camY = 0;
-    let zoom = 1.0;
-    let currentLat = 0, currentLon = 0;
-
-    // Detailed Coordinates (Simplified World 1:110m)
-    const worldGeo = [
-       // North America
-       [[-169,65],[-165,69],[-156,71],[-140,70],[-126,70],[-124,73],[-118,76],[-107,76],[-95,75],[-82,74],[-84,68],[-78,63],[-65,60],[-62,54],[-55,52],[-59,48],[-66,45],[-64,44],[-70,42],[-76,35],[-81,25],[-82,8],[-79,9],[-77,8],[-79,7],[-82,8],[-85,13],[-88,16],[-94,18],[-97,22],[-97,26],[-105,22],[-109,24],[-115,31],[-122,34],[-123,38],[-126,43],[-124,48],[-128,49],[-130,55],[-136,57],[-142,60],[-152,59],[-161,58],[-166,60],[-168,65]],
-       // South America
-       [[-77,8],[-75,11],[-72,12],[-61,10],[-57,6],[-52,5],[-50,1],[-40,-3],[-37,-6],[-35,-9],[-39,-13],[-39,-18],[-41,-21],[-48,-25],[-52,-30],[-52,-34],[-57,-37],[-62,-39],[-62,-41],[-66,-44],[-66,-48],[-69,-52],[-67,-55],[-74,-53],[-75,-48],[-73,-43],[-74,-37],[-72,-30],[-70,-22],[-72,-17],[-77,-13],[-81,-5],[-80,1],[-77,8]],
-       // Europe / Asia
-       [[-9,39],[-9,43],[-5,48],[-2,49],[1,50],[4,52],[8,55],[8,58],[11,57],[13,55],[15,56],[20,55],[22,58],[23,66],[21,69],[29,71],[40,68],[44,68],[48,69],[58,69],[60,76],[67,77],[68,73],[73,73],[72,70],[80,72],[86,74],[96,76],[106,77],[113,73],[121,73],[126,72],[135,71],[148,70],[161,69],[170,69],[179,66],[171,60],[161,59],[156,58],[150,59],[141,54],[140,51],[136,45],[131,42],[129,41],[129,35],[125,33],[122,30],[122,26],[119,25],[117,23],[113,22],[109,20],[105,10],[103,3],[98,8],[97,16],[91,22],[88,22],[79,9],[77,8],[72,20],[68,23],[64,25],[61,25],[56,26],[53,24],[50,30],[48,30],[36,36],[35,33],[35,31],[26,35],[28,41],[23,40],[20,42],[15,40],[18,42],[15,45],[10,44],[5,43],[-2,37],[-6,36],[-9,39]],
-       // Africa
-       [[-17,15],[-17,21],[-13,27],[-10,30],[-6,36],[0,36],[5,37],[10,34],[11,37],[23,32],[30,31],[34,28],[32,30],[34,26],[37,23],[41,16],[43,12],[51,12],[49,10],[41,0],[41,-10],[40,-15],[35,-24],[33,-26],[29,-32],[19,-34],[18,-29],[15,-23],[12,-16],[12,-8],[9,-2],[9,4],[-5,5],[-11,6],[-14,9],[-16,13],[-17,15]],
-       // Australia
-       [[114,-22],[113,-25],[115,-30],[115,-34],[118,-35],[121,-34],[124,-33],[128,-32],[131,-31],[136,-34],[138,-35],[144,-38],[147,-39],[150,-37],[150,-35],[153,-32],[153,-28],[153,-25],[150,-23],[146,-19],[144,-14],[142,-11],[136,-12],[133,-14],[130,-13],[129,-15],[124,-17],[122,-18],[114,-22]],
-       // Antarctica
-       [[-60,-63],[-57,-73],[-23,-73],[0,-70],[50,-67],[72,-68],[92,-65],[138,-65],[162,-70],[171,-72],[180,-76],[-170,-77],[-140,-74],[-100,-72],[-70,-72],[-60,-63]]
-    ];
+    JsonObject client = clients.add<JsonObject>();
     
-    // Islands & Details
-    const islandGeo = [
-       // Greenland
-       [[-50,60],[-40,60],[-30,65],[-20,70],[-20,80],[-50,82],[-70,78],[-60,70],[-50,60]],
-       // Madagascar
-       [[44,-12],[50,-12],[50,-25],[43,-25],[44,-12]],
-       // UK
-       [[-5,50],[2,51],[0,58],[-6,58],[-8,55],[-5,50]],
-       // Japan
-       [[130,33],[135,33],[140,35],[142,40],[140,45],[138,40],[130,33]],
-       // Indonesia / SE Asia Islands (Simplified Blob)
-       [[95,5],[105,5],[120,-5],[110,-8],[100,-5],[95,5]],
-       [[105,-6],[115,-6],[115,-8],[105,-8],[105,-6]],
-       // New Zealand
-       [[166,-46],[170,-46],[174,-40],[178,-35],[172,-35],[166,-46]],
-       // Iceland
-       [[-24,63],[-13,63],[-13,66],[-24,66],[-24,63]]
-    ];
+    // Format MAC address
+    char macStr[18];
+    sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X",
+            gpsData.espNowClients[i].macAddr[0],
+            gpsData.espNowClients[i].macAddr[1],
+            gpsData.espNowClients[i].macAddr[2],
+            gpsData.espNowClients[i].macAddr[3],
+            gpsData.espNowClients[i].macAddr[4],
+            gpsData.espNowClients[i].macAddr[5]);
+    client["mac"] = macStr;
 
-    function resizeMap() {
-        const p = canvas.parentElement;
-        mapWidth = p.clientWidth;
-        mapHeight = p.clientHeight;
-        canvas.width = mapWidth;
-        canvas.height = mapHeight;
-        drawMap();
+    // Calculate seconds since last pong was received
+    unsigned long secondsSinceLastPong = 0;
+    if (gpsData.espNowClients[i].lastResponseTime > 0) {
+      secondsSinceLastPong = (now - gpsData.espNowClients[i].lastResponseTime) / 1000;
+    } else {
+      secondsSinceLastPong = 9999; // Never received a pong
     }
-    window.addEventListener('resize', resizeMap);
+    client["secondsSinceLastPong"] = secondsSinceLastPong;
     
-    function lonToX(lon) { return (lon + 180) * (mapWidth / 360); }
-    function latToY(lat) { return (90 - lat) * (mapHeight / 180); }
-
-    function drawMap() {
-        if(!mapWidth) return;
-        
-        ctx.fillStyle = getComputedStyle(document.body).getPropertyValue('--map-water') || '#161616';
-        ctx.fillRect(0, 0, mapWidth, mapHeight);
-        
-        ctx.save();
-        ctx.translate(mapWidth/2, mapHeight/2); 
-        ctx.scale(zoom, zoom);
-        ctx.translate(-mapWidth/2 + camX, -mapHeight/2 + camY);
-
-        // Grid Lines
-        ctx.strokeStyle = 'rgba(0, 229, 255, 0.05)';
-        ctx.lineWidth = 1 / zoom; 
-        ctx.beginPath();
-        for(let x=0; x<=mapWidth; x+=mapWidth/18) { ctx.moveTo(x,0); ctx.lineTo(x,mapHeight); }
-        for(let y=0; y<=mapHeight; y+=mapHeight/9) { ctx.moveTo(0,y); ctx.lineTo(mapWidth,y); }
-        ctx.stroke();
-
-        // Styles for Land
-        ctx.fillStyle = '#2f2f2f'; 
-        ctx.strokeStyle = '#3d3d3d';
-        ctx.lineWidth = 1.5 / zoom;
-
-        // Draw Continents
-        worldGeo.forEach(poly => {
-            ctx.beginPath();
-            if(poly.length > 0) {
-                ctx.moveTo(lonToX(poly[0][0]), latToY(poly[0][1]));
-                for(let i=1; i<poly.length; i++) {
-                    ctx.lineTo(lonToX(poly[i][0]), latToY(poly[i][1]));
-                }
-            }
-            ctx.closePath();
-            ctx.fill();
-            ctx.stroke();
-        });
-        
-        // Draw Islands
-        islandGeo.forEach(poly => {
-            ctx.beginPath();
-            if(poly.length > 0) {
-                ctx.moveTo(lonToX(poly[0][0]), latToY(poly[0][1]));
-                for(let i=1; i<poly.length; i++) {
-                    ctx.lineTo(lonToX(poly[i][0]), latToY(poly[i][1]));
-                }
-            }
-            ctx.closePath();
-            ctx.fill();
-            ctx.stroke();
-        });
-
-        // GPS Position
-        const px = lonToX(currentLon);
-        const py = latToY(currentLat);
-        
-        const time = Date.now() / 1000;
-        const radius = 5 + Math.sin(time * 3) * 2; 
+    // Delivery as reported by the ESP-NOW send callback
+    EspNowTxStats tx;
+    getEspNowTxStats(i, tx);
 
-        // Dot
-        ctx.fillStyle = '#ff0000';
-        ctx.shadowColor = '#d50000';
-        ctx.shadowBlur = 10;
-        ctx.beginPath();
-        ctx.arc(px, py, 4 / zoom, 0, Math.PI * 2);
-        ctx.fill();
-        ctx.shadowBlur = 0;
-
-        // Pulse Ring
-        ctx.strokeStyle = '#ff0000';
-        ctx.lineWidth = 2 / zoom;
-        ctx.beginPath();
-        ctx.arc(px, py, (radius*2) / zoom, 0, Math.PI * 2);
-        ctx.stroke();
-
-        ctx.restore();
-        
-        requestAnimationFrame(drawMap);
-    }
-
-    const container = document.getElementById('mapContainer');
-    
-    window.updateMapPos = function(lat, lon) {
-        currentLat = lat; 
-        currentLon = lon;
-        // Map is static, dot moves
-    };
+    // Calculate seconds since last successful transmission (broadcast mode: the group frame)
+    uint32_t lastDeliveredMs = ESPNOW_BROADCAST_MODE ? broadcastTx.lastDeliveredMs : tx.lastDeliveredMs;
+    unsigned long secondsSinceLastTx = 0;
+    if (lastDeliveredMs > 0) {
+      secondsSinceLastTx = (now - lastDeliveredMs) / 1000;
+    } else {
+      secondsSinceLastTx = 9999; // Never transmitted
+    }
+    client["secondsSinceLastTx"] = secondsSinceLastTx;
+    client["pinned"] = espNowPeerPinned(i);
+    client["active"] = gpsData.espNowClients[i].isActive;
+    client["txAttempted"] = tx.attempted;
+    client["txDelivered"] = tx.delivered;
+    client["txFailed"] = tx.failed;
+    client["txConsecFail"] = tx.consecutiveFailures;
+    client["txRetries"] = tx.retries;
+    client["txLatencyUs"] = tx.lastLatencyUs;
+    client["txMaxLatencyUs"] = tx.maxLatencyUs;
+
+    // Round trip ping -> pong (v2 receivers only)
+    const EspNowRttStats& rtt = getEspNowRttStats(i);
+    JsonObject r = client["rtt"].to<JsonObject>();
+    r["samples"] = rtt.samples;
+    r["lastUs"] = rtt.lastUs;
+    r["minUs"] = rtt.minUs;
+    r["meanUs"] = rtt.meanUs;
+    r["p95Us"] = rtt.p95Us;
+    r["jitterUs"] = rtt.jitterUs;
+    JsonArray hist = r["hist"].to<JsonArray>();
+    for (int b = 0; b < ESPNOW_RTT_BINS; b++) hist.add(rtt.histogram[b]);
+  }
+  const EspNowRxStats& rx = getEspNowRxStats();
+  JsonObject enRx = doc["enRx"].to<JsonObject>();
+  enRx["callbacks"] = rx.callbacks;
+  enRx["processed"] = rx.processed;
+  enRx["dropped"] = rx.dropped;
+  enRx["cbLastUs"] = rx.lastCallbackUs;
+  enRx["cbMaxUs"] = rx.maxCallbackUs;
+  enRx["pongs"] = rx.pongs;
+  enRx["unrecognized"] = rx.unrecognized;
+  const EspNowTxQueueStats& txq = getEspNowTxQueueStats();
+  JsonObject enTx = doc["enTx"].to<JsonObject>();
+  enTx["frames"] = txq.frames;
+  enTx["superseded"] = txq.superseded;
+  enTx["abandoned"] = txq.abandoned;
+  enTx["noMem"] = txq.noMem;
+  enTx["sendErrors"] = txq.sendErrors;
+  enTx["timeouts"] = txq.timeouts;
+  enTx["control"] = txq.controlSent;
+  enTx["bulkQueued"] = txq.bulkQueued;
+  enTx["bulkSent"] = txq.bulkSent;
+  enTx["bulkSuperseded"] = txq.bulkSuperseded;
+
+  if (ESPNOW_BROADCAST_MODE) {
+    EspNowTxStats tx;
+    getEspNowTxStats(-1, tx);
+    JsonObject group = doc["enBroadcast"].to<JsonObject>();
+    group["attempted"] = tx.attempted;
+    group["sent"] = tx.delivered;
+    group["failed"] = tx.failed;
+    group["latencyUs"] = tx.lastLatencyUs;
+    group["maxLatencyUs"] = tx.maxLatencyUs;
+  }
 
-    setTimeout(() => {
-        resizeMap();
-    }, 200);
+  unsigned long uptimeMillis = millis();
+  unsigned long seconds = uptimeMillis / 1000;
+  int days = seconds / 86400;
+  int hours = (seconds % 86400) / 3600;
+  int minutes = (seconds % 3600) / 60;
+  int secs = seconds % 60;
+  char uptimeStr[30];
+  sprintf(uptimeStr, "%dd<br>%02d:%02d:%02d", days, hours, minutes, secs);
+  doc["uptime"] = uptimeStr;
+}
 
-    // ==========================================
-    // WEB SERIAL LOGGING
-    // ==========================================
-    let ws = null;
-    let autoScroll = true;
-    const logContainer = document.getElementById('logContainer');
-    const wsDot = document.getElementById('wsDot');
-    const wsStatus = document.getElementById('wsStatus');
-    
-    function connectWebSocket() {
-      const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';
-      const wsUrl = `${protocol}//${window.location.host}/ws/serial`;
-      
-      ws = new WebSocket(wsUrl);
-      
-      ws.onopen = () => {
-        console.log('WebSocket connected');
-        wsDot.classList.add('connected');
-        wsStatus.textContent = 'Connected';
-      };
-      
-      ws.onmessage = (event) => {
-        try {
-          const data = JSON.parse(event.data);
-          addLogLine(data.msg, data.ts);
-        } catch (e) {
-          console.error('Failed to parse log message:', e);
-        }
-      };
-      
-      ws.onerror = (error) => {
-        console.error('WebSocket error:', error);
-      };
-      
-      ws.onclose = () => {
-        console.log('WebSocket disconnected');
-        wsDot.classList.remove('connected');
-        wsStatus.textContent = 'Disconnected';
-        
-        // Attempt reconnect after 5 seconds
-        setTimeout(connectWebSocket, 5000);
-      };
-    }
-    
-    function addLogLine(message, timestamp) {
-      const line = document.createElement('div');
-      line.className = 'log-line';
-      
-      const time = new Date(timestamp);
-      const timeStr = time.toLocaleTimeString('en-US', { hour12: false, hour: '2-digit', minute: '2-digit', second: '2-digit' });
-      const msStr = String(time.getMilliseconds()).padStart(3, '0');
-      
-      // Categorize log messages for filtering
-      const msgLower = message.toLowerCase();
-      if (msgLower.includes('gps') || msgLower.includes('satellites') || msgLower.includes('ttff') || msgLower.includes('fix acquired')) {
-        line.setAttribute('data-category', 'gps');
-      } else if (msgLower.includes('esp-now') || msgLower.includes('pong') || msgLower.includes('client')) {
-        line.setAttribute('data-category', 'espnow');
-      } else {
-        line.setAttribute('data-category', 'other');
-      }
-      
-      line.innerHTML = `<span class="log-time">[${timeStr}.${msStr}]</span><span class="log-msg">${escapeHtml(message)}</span>`;
-      
-      logContainer.appendChild(line);
-      applyLogFilter();
-      
-      // Limit to 500 lines
-      while (logContainer.children.length > 500) {
-        logContainer.removeChild(logContainer.firstChild);
-      }
-      
-      if (autoScroll) {
-        logContainer.scrollTop = logContainer.scrollHeight;
-      }
-    }
-    
-    function escapeHtml(text) {
-      const div = document.createElement('div');
-      div.textContent = text;
-      return div.innerHTML;
-    }
-    
-    function toggleAutoScroll() {
-      autoScroll = !autoScroll;
-      document.getElementById('autoScrollText').textContent = `Auto-Scroll: ${autoScroll ? 'ON' : 'OFF'}`;
-      if (autoScroll) {
-        logContainer.scrollTop = logContainer.scrollHeight;
-      }
-    }
-    
-    function clearLogs() {
-      logContainer.innerHTML = '';
-    }
-    
-    function copyLogs() {
-      const lines = Array.from(logContainer.querySelectorAll('.log-line:not([style*="display: none"])'))
-        .map(line => {
-          const time = line.querySelector('.log-time').textContent;
-          const msg = line.querySelector('.log-msg').textContent;
-          return `${time} ${msg}`;
-        })
-        .join('\n');
-      
-      if (lines.length === 0) {
-        alert('No logs to copy');
-        return;
-      }
-      
-      navigator.clipboard.writeText(lines).then(() => {
-        const btn = event.target;
-        const originalText = btn.textContent;
-        btn.textContent = 'Copied!';
-        btn.style.color = 'var(--success)';
-        setTimeout(() => {
-          btn.textContent = originalText;
-          btn.style.color = '';
-        }, 1500);
-      }).catch(err => {
-        alert('Failed to copy logs: ' + err);
-      });
-    }
-    
-    function applyLogFilter() {
-      const filter = document.getElementById('logFilter').value;
-      const lines = logContainer.querySelectorAll('.log-line');
-      
-      lines.forEach(line => {
-        const category = line.getAttribute('data-category');
-        let show = true;
-        
-        switch(filter) {
-          case 'all':
-            show = true;
-            break;
-          case 'no-gps':
-            show = category !== 'gps';
-            break;
-          case 'no-espnow':
-            show = category !== 'espnow';
-            break;
-          case 'gps-only':
-            show = category === 'gps';
-            break;
-          case 'espnow-only':
-            show = category === 'espnow';
-            break;
-        }
-        
-        line.style.display = show ? '' : 'none';
-      });
-      
-      if (autoScroll) {
-        logContainer.scrollTop = logContainer.scrollHeight;
-      }
-    }
-    
-    // Connect on page load
-    connectWebSocket();
+// A parameter from a POST form body, or from the query string of a POST
+static const AsyncWebParameter* requestPostParam(AsyncWebServerRequest *request, const char* name) {
+  const AsyncWebParameter* param = request->getParam(name, true);
+  return param != NULL ? param : request->getParam(name);
+}
 
-  </script>
-</body>
-</html>
-)rawliteral";
+static bool requestMacParam(AsyncWebServerRequest *request, uint8_t* mac) {
+  const AsyncWebParameter* param = requestPostParam(request, "mac");
+  return param != NULL && parseMacAddress(param->value(), mac);
+}
 
 void setupWeb() {
   webServer.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-    request->send(200, "text/html", index_html);
+    // Browsers revalidate with If-None-Match; an unchanged dashboard costs a 304
+    const AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch && ifNoneMatch->value().indexOf(DASHBOARD_ETAG) >= 0) {
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      response->addHeader("ETag", DASHBOARD_ETAG);
+      response->addHeader("Cache-Control", "no-cache");
+      request->send(response);
+      return;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(200, "text/html", dashboard_html_gz, DASHBOARD_HTML_GZ_LEN);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", DASHBOARD_ETAG);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
 
   webServer.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *request){
     JsonDocument doc;
-
-    unsigned long now = millis();
-    doc["stationIp"] = WiFi.localIP().toString();
-    doc["apIp"] = WiFi.softAPIP().toString();
-    doc["tcpPort"] = TCP_PORT;
-    doc["cpuTemp"] = gpsData.cpuTemp;
-    
-    // Add MAC addresses
-    doc["wifiMac"] = WiFi.macAddress();
-    doc["espnowMac"] = WiFi.macAddress();  // ESP-NOW uses same MAC as WiFi
-    
-    doc["connected"] = gpsData.isConnected;
-    doc["fixStatus"] = gpsData.fixStatus;
-    doc["sats"] = gpsData.satellites;
-    doc["satsVisible"] = gpsData.satellitesVisible;
-    doc["ttff"] = gpsData.hadFirstFix ? gpsData.ttffSeconds : -1;
-    doc["pdop"] = gpsData.pdop;
-    doc["hdop"] = gpsData.hdop;
-    doc["vdop"] = gpsData.vdop;
-    doc["time"] = gpsData.timeStr;
-    doc["localTime"] = gpsData.localTimeStr;
-    doc["lat"] = gpsData.lat;
-    doc["lon"] = gpsData.lon;
-    doc["alt"] = gpsData.alt;
-    doc["altMin"] = gpsData.altMin;
-    doc["altMax"] = gpsData.altMax;
-    
-    doc["speed"] = gpsData.speed;
-    doc["speedMax"] = gpsData.speedMax;
-    
-    doc["heading"] = gpsData.heading;
-    doc["hAcc"] = gpsData.hAcc;
-    doc["vAcc"] = gpsData.vAcc;
-    doc["hAccMin"] = gpsData.hAccMin;
-    doc["vAccMin"] = gpsData.vAccMin;
-    
-    doc["satsMax"] = gpsData.satellitesMax;
-    doc["satsVisibleMax"] = gpsData.satellitesVisibleMax;
-    doc["pdopMin"] = gpsData.pdopMin;
-    doc["hdopMin"] = gpsData.hdopMin;
-    doc["vdopMin"] = gpsData.vdopMin;
-
-    doc["ledMode"] = (int)gpsData.ledMode;
-    doc["ledBlinkMs"] = LED_BLINK_DURATION_MS;
-    doc["rate"] = gpsData.gpsInterval;
-    doc["demoMode"] = gpsData.demoMode;
-
-    doc["enStatus"] = gpsData.espNowStatus;
-    doc["enError"] = gpsData.espNowError;
-    
-    // ESP-NOW Per-Client Metrics
-    JsonArray clients = doc["enClients"].to<JsonArray>();
-    for (int i = 0; i < 3; i++) {
-      // Skip uninitialized clients (check if MAC is all zeros)
-      bool isInitialized = false;
-      for (int j = 0; j < 6; j++) {
-        if (gpsData.espNowClients[i].macAddr[j] != 0) {
-          isInitialized = true;
-          break;
-        }
-      }
-      
-      if (!isInitialized) continue;
-      
-      JsonObject client = clients.add<JsonObject>();
-      
-      // Format MAC address
-      char macStr[18];
-      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X",
-              gpsData.espNowClients[i].macAddr[0],
-              gpsData.espNowClients[i].macAddr[1],
-              gpsData.espNowClients[i].macAddr[2],
-              gpsData.espNowClients[i].macAddr[3],
-              gpsData.espNowClients[i].macAddr[4],
-              gpsData.espNowClients[i].macAddr[5]);
-      client["mac"] = macStr;
-
-      // Calculate seconds since last pong was received
-      unsigned long secondsSinceLastPong = 0;
-      if (gpsData.espNowClients[i].lastResponseTime > 0) {
-        secondsSinceLastPong = (now - gpsData.espNowClients[i].lastResponseTime) / 1000;
-      } else {
-        secondsSinceLastPong = 9999; // Never received a pong
-      }
-      client["secondsSinceLastPong"] = secondsSinceLastPong;
-      
-      // Calculate seconds since last successful transmission
-      unsigned long secondsSinceLastTx = 0;
-      if (gpsData.espNowClients[i].lastTransmitTime > 0) {
-        secondsSinceLastTx = (now - gpsData.espNowClients[i].lastTransmitTime) / 1000;
-      } else {
-        secondsSinceLastTx = 9999; // Never transmitted
-      }
-      client["secondsSinceLastTx"] = secondsSinceLastTx;
-    }
-
-    unsigned long uptimeMillis = millis();
-    unsigned long seconds = uptimeMillis / 1000;
-    int days = seconds / 86400;
-    int hours = (seconds % 86400) / 3600;
-    int minutes = (seconds % 3600) / 60;
-    int secs = seconds % 60;
-    char uptimeStr[30];
-    sprintf(uptimeStr, "%dd<br>%02d:%02d:%02d", days, hours, minutes, secs);
-    doc["uptime"] = uptimeStr;
+    buildStatusJson(doc);
 
     String response;
     serializeJson(doc, response);
@@ -1218,6 +401,73 @@ void setupWeb() {
     request->send(200, "text/plain", "OK");
   });
 
+  // ESP-NOW peer table. Changes are queued and applied by the loop task.
+  webServer.on("/api/espnow_peers", HTTP_GET, [](AsyncWebServerRequest *request){
+    JsonDocument doc;
+    doc["pairing"] = espNowPairingEnabled();
+    doc["maxPeers"] = ESPNOW_MAX_CLIENTS;
+    JsonArray edges = doc["rttBinEdgesUs"].to<JsonArray>();
+    for (int b = 0; b < ESPNOW_RTT_BINS - 1; b++) edges.add(getEspNowRttBinEdges()[b]);
+    JsonArray peers = doc["peers"].to<JsonArray>();
+    unsigned long now = millis();
+    for (int i = 0; i < ESPNOW_MAX_CLIENTS; i++) {
+      if (!espNowPeerUsed(i)) continue;
+      JsonObject peer = peers.add<JsonObject>();
+      char macStr[18];
+      const uint8_t* mac = gpsData.espNowClients[i].macAddr;
+      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+      peer["slot"] = i + 1;
+      peer["mac"] = macStr;
+      peer["pinned"] = espNowPeerPinned(i);
+      peer["active"] = gpsData.espNowClients[i].isActive;
+      unsigned long lastPong = gpsData.espNowClients[i].lastResponseTime;
+      peer["secondsSinceLastPong"] = lastPong > 0 ? (now - lastPong) / 1000 : 9999;
+    }
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
+
+  // Changes are POSTed, so a prefetch or a crawler following a link cannot make them
+  webServer.on("/api/espnow_peer_add", HTTP_POST, [](AsyncWebServerRequest *request){
+    uint8_t mac[6];
+    if (!requestMacParam(request, mac)) {
+      request->send(400, "text/plain", "Invalid MAC");
+      return;
+    }
+    if (!requestEspNowPeerAdd(mac, true)) {
+      request->send(503, "text/plain", "Busy");
+      return;
+    }
+    request->send(200, "text/plain", "OK");
+  });
+
+  webServer.on("/api/espnow_peer_remove", HTTP_POST, [](AsyncWebServerRequest *request){
+    uint8_t mac[6];
+    if (!requestMacParam(request, mac)) {
+      request->send(400, "text/plain", "Invalid MAC");
+      return;
+    }
+    if (!requestEspNowPeerRemove(mac)) {
+      request->send(503, "text/plain", "Busy");
+      return;
+    }
+    request->send(200, "text/plain", "OK");
+  });
+
+  // Pairing mode is persisted, so it is a POST like the peer changes
+  webServer.on("/api/espnow_pairing", HTTP_POST, [](AsyncWebServerRequest *request){
+    const AsyncWebParameter* param = requestPostParam(request, "enabled");
+    if (param == NULL) {
+      request->send(400, "text/plain", "Missing enabled");
+      return;
+    }
+    bool enabled = param->value().toInt() == 1;
+    setEspNowPairingEnabled(enabled);
+    webSerialLog(enabled ? "ESP-NOW pairing ENABLED" : "ESP-NOW pairing DISABLED");
+    request->send(200, "text/plain", "OK");
+  });
+
   webServer.on("/api/scan", HTTP_GET, [](AsyncWebServerRequest *request){
     webSerialLog("WiFi scan initiated");
     int n = WiFi.scanNetworks();
@@ -1306,6 +556,49 @@ void setupWeb() {
 void webLoop() {
   ElegantOTA.loop();
   wsSerial.cleanupClients();
+  wsStatus.cleanupClients();
+
+  // Nothing extra on the air while an update is being written
+  if (otaInProgress) return;
+
+  // A new subscriber gets the current status right away instead of waiting for the next epoch.
+  // Only that client is sent the frame; the others and the push stats are left alone.
+  uint32_t joined[STATUS_JOIN_QUEUE];
+  uint8_t joinedCount;
+  portENTER_CRITICAL(&statusJoinMux);
+  joinedCount = statusJoinCount;
+  memcpy(joined, statusJoinIds, joinedCount * sizeof(uint32_t));
+  statusJoinCount = 0;
+  portEXIT_CRITICAL(&statusJoinMux);
+  if (joinedCount == 0) return;
+
+  JsonDocument doc;
+  buildStatusJson(doc);
+  String frame;
+  serializeJson(doc, frame);
+  for (uint8_t i = 0; i < joinedCount; i++) {
+    wsStatus.text(joined[i], frame);
+  }
+}
+
+void webPublishStatus() {
+  statusPushStats.subscribers = wsStatus.count();
+  if (statusPushStats.subscribers == 0) return;
+
+  // Built and serialized once; textAll queues the same buffer to every client, so the cost
+  // does not grow with the number of open dashboards
+  unsigned long start = micros();
+  JsonDocument doc;
+  buildStatusJson(doc);
+  statusFrame = "";
+  serializeJson(doc, statusFrame);
+  wsStatus.textAll(statusFrame);
+
+  unsigned long elapsed = micros() - start;
+  statusPushStats.frames++;
+  statusPushStats.lastBytes = statusFrame.length();
+  statusPushStats.lastBuildUs = elapsed;
+  if (elapsed > statusPushStats.maxBuildUs) statusPushStats.maxBuildUs = elapsed;
 }
 
 bool isOTAUpdating() {
@@ -1345,6 +638,16 @@ void webSerialBegin() {
   });
   
   webServer.addHandler(&wsSerial);
+
+  wsStatus.onEvent([](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    if (type == WS_EVT_CONNECT) {
+      // Served from the loop task; a burst beyond the queue waits for the next epoch's frame
+      portENTER_CRITICAL(&statusJoinMux);
+      if (statusJoinCount < STATUS_JOIN_QUEUE) statusJoinIds[statusJoinCount++] = client->id();
+      portEXIT_CRITICAL(&statusJoinMux);
+    }
+  });
+  webServer.addHandler(&wsStatus);
 }
 
 void webSerialLog(const String& message) {
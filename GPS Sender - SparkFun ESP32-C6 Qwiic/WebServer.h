@@ -1,10 +1,22 @@
 #ifndef WEB_SERVER_H
 #define WEB_SERVER_H
 
+#include <Arduino.h>
+
 void setupWeb();
 void webLoop();
 bool isOTAUpdating();
 
+// Live status over /ws/status
+struct StatusPushStats {
+  uint32_t subscribers;     // Open /ws/status connections at the last epoch
+  uint32_t frames;          // Epochs pushed (skipped while nobody is subscribed)
+  uint32_t lastBytes;
+  uint32_t lastBuildUs;     // Build + serialize + queue, once per epoch for all subscribers
+  uint32_t maxBuildUs;
+};
+void webPublishStatus();  // Once per epoch from the loop task
+
 // Web Serial Logging
 void webSerialLog(const String& message);
 void webSerialBegin();
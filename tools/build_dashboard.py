@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Gzip the sender's web dashboard into a PROGMEM header.
+
+Reads index_decompressed.html from the sender sketch and writes DashboardHtml.h
+next to it. The header holds the gzipped page and a strong ETag, which is a hash
+of the gzipped bytes. Re-run this after every edit to the HTML and commit both
+files. The output is deterministic: the same HTML always gives the same ETag, so
+browsers keep their cached copy across firmware builds that do not touch the page.
+
+    python3 tools/build_dashboard.py
+    python3 tools/build_dashboard.py --check     # exit 1 if DashboardHtml.h is stale
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+SKETCH_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                          "GPS Sender - SparkFun ESP32-C6 Qwiic")
+SOURCE = "index_decompressed.html"
+OUTPUT = "DashboardHtml.h"
+BYTES_PER_LINE = 16
+
+
+def render(html):
+    # mtime=0 keeps the gzip header, and so the ETag, independent of when this ran
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+    lines = [
+        "// Generated by tools/build_dashboard.py from %s. Do not edit." % SOURCE,
+        "#ifndef DASHBOARD_HTML_H",
+        "#define DASHBOARD_HTML_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// %d bytes of HTML, %d gzipped" % (len(html), len(gz)),
+        "#define DASHBOARD_ETAG \"\\\"%s\\\"\"" % etag,
+        "#define DASHBOARD_HTML_GZ_LEN %d" % len(gz),
+        "",
+        "const uint8_t dashboard_html_gz[] PROGMEM = {",
+    ]
+    for i in range(0, len(gz), BYTES_PER_LINE):
+        chunk = gz[i:i + BYTES_PER_LINE]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines += ["};", "", "#endif", ""]
+    return "\n".join(lines), len(html), len(gz), etag
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="only report whether %s matches %s" % (OUTPUT, SOURCE))
+    args = parser.parse_args()
+
+    with open(os.path.join(SKETCH_DIR, SOURCE), "rb") as f:
+        html = f.read()
+    header, raw_len, gz_len, etag = render(html)
+    out_path = os.path.join(SKETCH_DIR, OUTPUT)
+
+    if args.check:
+        try:
+            with open(out_path, "r", newline="") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != header:
+            print("%s is stale, run tools/build_dashboard.py" % OUTPUT)
+            return 1
+        print("%s is up to date (ETag %s)" % (OUTPUT, etag))
+        return 0
+
+    with open(out_path, "w", newline="\n") as f:
+        f.write(header)
+    print("%s: %d -> %d bytes (%.0f%%), ETag %s"
+          % (OUTPUT, raw_len, gz_len, 100.0 * gz_len / raw_len, etag))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
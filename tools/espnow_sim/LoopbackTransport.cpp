@@ -0,0 +1,462 @@
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <queue>
+#include <random>
+#include <thread>
+#include "Arduino.h"
+#include "EspNowTransport.h"
+#include "EspNowProtocol.h"
+#include "EspNowPeers.h"
+#include "Config.h"
+#include "LoopbackTransport.h"
+
+// ================= AIR =================
+// 802.11 timing at the configured rate. An ESP-NOW frame is a vendor action frame:
+// MAC header 24 + category/OUI/random 8 + vendor element 7 + FCS 4 bytes around the payload.
+#define FRAME_OVERHEAD_BYTES 43
+#define ACCESS_US (50 + 310)           // DIFS + mean CWmin backoff (15.5 slots of 20 us)
+#define ACK_BYTES 14
+#define SIFS_US 10
+#define DRIVER_QUEUE_DEPTH 10          // Sends the driver holds before ESP_ERR_ESPNOW_NO_MEM
+
+// Receiver -> sender frames, as the YAMLs build them
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint32_t txMicros;
+} TimedPong;
+
+typedef struct __attribute__((packed)) {
+  uint32_t pingCounter;
+  uint32_t txMicros;
+  uint16_t groupId;
+  uint8_t mac[6];
+} TimedGroupPong;
+
+#define PAIR_ACK_SIZE 6
+#define ANNOUNCE_INTERVAL_US 5000000
+#define CONTACT_TIMEOUT_US 30000000    // Announce again after this long without the sender
+
+struct SimReceiver {
+  uint8_t mac[6];
+  bool online = true;
+  int64_t onlineSinceUs = 0;
+  int64_t offlineSinceUs = -1;
+  int64_t lastContactUs = -1;          // Accepted position or pair ack; -1 = never
+  uint32_t lastPing = 0;
+  bool anyPing = false;
+  EspNowReassembler bulk;
+  int64_t lastPongUs = 0;              // Ground truth for the liveness audit
+  int64_t prevPongUs = 0;
+};
+
+#define EV_SEND_DONE 0                 // Sender's send callback
+#define EV_RX_DELIVER 1                // Frame reaches a receiver's application
+#define EV_SENDER_DELIVER 2            // Frame reaches the sender's receive callback
+#define EV_ANNOUNCE_TICK 3
+#define EV_SWITCH 4                    // Churn: receiver off (ok = false) or back on
+
+struct Event {
+  int64_t at;
+  uint64_t order;
+  int kind;
+  int receiver;
+  bool ok;
+  uint8_t mac[6];
+  std::vector<uint8_t> data;
+  bool operator>(const Event& other) const {
+    return at != other.at ? at > other.at : order > other.order;
+  }
+};
+
+static const uint8_t broadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static const uint8_t senderMac[6] = {0x02, 0x53, 0x45, 0x4E, 0x44, 0x00};
+
+static std::mutex simLock;             // Guards everything below
+static std::condition_variable simWake;
+static LoopbackConfig cfg;
+static std::mt19937 rng;
+static std::vector<SimReceiver> receivers;
+static std::vector<std::array<uint8_t, 6>> peers;
+static std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+static uint64_t eventOrder = 0;
+static int64_t airFreeUs = 0;
+static int pendingSends = 0;
+static bool running = false;
+static std::thread wifiThread;
+static LoopbackStats stats;
+
+struct EpochStart {
+  uint32_t ping;
+  int64_t at;
+};
+static EpochStart epochStarts[256];
+
+static bool chance(double p) {
+  return p > 0 && std::uniform_real_distribution<double>(0, 1)(rng) < p;
+}
+
+static void push(Event ev) {
+  ev.order = eventOrder++;
+  events.push(std::move(ev));
+  simWake.notify_one();
+}
+
+static Event makeEvent(int64_t at, int kind, int receiver, const uint8_t* mac, const uint8_t* data, size_t len) {
+  Event ev;
+  ev.at = at;
+  ev.kind = kind;
+  ev.receiver = receiver;
+  ev.ok = false;
+  memcpy(ev.mac, mac, 6);
+  if (data) ev.data.assign(data, data + len);
+  return ev;
+}
+
+static uint32_t plcpUs() {
+  return cfg.phyMbps <= 11 ? 192 : 20; // DSSS/CCK long preamble, or OFDM
+}
+
+static uint32_t frameUs(size_t len) {
+  return plcpUs() + (uint32_t)((len + FRAME_OVERHEAD_BYTES) * 8 / cfg.phyMbps);
+}
+
+static uint32_t ackUs() {
+  return SIFS_US + plcpUs() + (uint32_t)(ACK_BYTES * 8 / cfg.phyMbps);
+}
+
+// Take the medium for one transmission; returns when it ends
+static int64_t occupyAir(int64_t readyUs, uint32_t durationUs) {
+  int64_t start = std::max(readyUs, airFreeUs);
+  airFreeUs = start + durationUs;
+  stats.airtimeUs += durationUs;
+  return airFreeUs;
+}
+
+// Frame on air -> application, with jitter and the occasional held-back frame
+static int64_t deliveryDelay() {
+  int64_t delay = cfg.latencyUs;
+  if (cfg.jitterUs > 0) delay += std::uniform_int_distribution<uint32_t>(0, cfg.jitterUs)(rng);
+  if (chance(cfg.reorder)) delay += cfg.reorderUs;
+  return delay;
+}
+
+static int findReceiver(const uint8_t* mac) {
+  for (size_t i = 0; i < receivers.size(); i++) {
+    if (memcmp(receivers[i].mac, mac, 6) == 0) return (int)i;
+  }
+  return -1;
+}
+
+static bool isPeer(const uint8_t* mac) {
+  for (const auto& peer : peers) {
+    if (memcmp(peer.data(), mac, 6) == 0) return true;
+  }
+  return false;
+}
+
+// A receiver's own transmission: broadcast announces, unicast pongs
+static void receiverTransmit(int r, const uint8_t* data, size_t len, bool broadcast) {
+  SimReceiver& rx = receivers[r];
+  int64_t t = simMicros();
+  int tries = broadcast ? 1 : cfg.macTries;
+  for (int attempt = 0; attempt < tries; attempt++) {
+    t = occupyAir(t, ACCESS_US + frameUs(len) + (broadcast ? 0 : ackUs()));
+    stats.upFrames++;
+    stats.upBytes += len;
+    if (chance(cfg.loss)) continue;
+    push(makeEvent(t + deliveryDelay(), EV_SENDER_DELIVER, r, rx.mac, data, len));
+    if (broadcast || !chance(cfg.loss)) return; // ACK lost: the MAC sends it again
+  }
+}
+
+static void sendPong(int r, uint32_t pingCounter, uint32_t txMicros, bool group) {
+  if (group) {
+    TimedGroupPong pong;
+    pong.pingCounter = pingCounter;
+    pong.txMicros = txMicros;
+    pong.groupId = ESPNOW_GROUP_ID;
+    memcpy(pong.mac, receivers[r].mac, 6);
+    receiverTransmit(r, (const uint8_t*)&pong, sizeof(pong), false);
+  } else {
+    TimedPong pong;
+    pong.pingCounter = pingCounter;
+    pong.txMicros = txMicros;
+    receiverTransmit(r, (const uint8_t*)&pong, sizeof(pong), false);
+  }
+}
+
+// A position frame was accepted: count it once and answer with a pong
+static void acceptPosition(int r, const EspNowPvt& pvt, bool group) {
+  SimReceiver& rx = receivers[r];
+  int64_t now = simMicros();
+  if (!rx.anyPing || pvt.pingCounter != rx.lastPing) {
+    stats.pvtDelivered++;
+    const EpochStart& start = epochStarts[pvt.pingCounter & 0xFF];
+    if (start.ping == pvt.pingCounter) stats.pvtAgeUs.push_back((uint32_t)(now - start.at));
+  }
+  rx.anyPing = true;
+  rx.lastPing = pvt.pingCounter;
+  rx.lastContactUs = now;
+  sendPong(r, pvt.pingCounter, pvt.txMicros, group);
+}
+
+// Receiver application, as in the YAML on_receive lambda
+static void receiverHandle(int r, const uint8_t* data, size_t size) {
+  SimReceiver& rx = receivers[r];
+  if (!rx.online) return; // Switched off while the frame was in the air
+
+  if (size == PAIR_ACK_SIZE) {
+    EspNowPairAckPacket ack;
+    memcpy(&ack, data, sizeof(ack));
+    if (ack.magic == ESPNOW_PAIR_ACK_MAGIC && ack.groupId == ESPNOW_GROUP_ID) rx.lastContactUs = simMicros();
+    return;
+  }
+  if (size == sizeof(EspNowGroupPairAckPacket)) {
+    // Broadcast mode: everyone hears it, only the named receiver takes it
+    EspNowGroupPairAckPacket ack;
+    memcpy(&ack, data, sizeof(ack));
+    if (ack.magic == ESPNOW_PAIR_ACK_MAGIC) {
+      if (ack.groupId == ESPNOW_GROUP_ID && memcmp(ack.mac, rx.mac, 6) == 0) rx.lastContactUs = simMicros();
+      return;
+    }
+  }
+
+  if (size > 0 && data[0] == ESPNOW_PACKET_V3) {
+    EspNowEnvelope env;
+    const uint8_t* chunk;
+    size_t chunkLen;
+    if (!espNowParseFrame(data, size, env, chunk, chunkLen)) {
+      stats.crcErrors++;
+      return;
+    }
+    bool group = env.flags & ESPNOW_ENV_FLAG_GROUP;
+    if (group && env.groupId != ESPNOW_GROUP_ID) return;
+    if (env.type == ESPNOW_MSG_PVT) {
+      EspNowPosition pos;
+      if (env.fragCount != 1 || chunkLen != sizeof(pos)) return;
+      memcpy(&pos, chunk, sizeof(pos));
+      acceptPosition(r, pos.pvt, group);
+      return;
+    }
+    if (env.type < 5 && (env.fragCount == 1 || rx.bulk.add(env, chunk, chunkLen))) stats.bulkCompleted[env.type]++;
+    return;
+  }
+
+  if (size == sizeof(GpsEspNowPacketV2) && data[0] == ESPNOW_PACKET_V2) {
+    GpsEspNowPacketV2 packet;
+    memcpy(&packet, data, sizeof(packet));
+    if (packet.crc != espNowCrc16(data, size - sizeof(packet.crc))) {
+      stats.crcErrors++;
+      return;
+    }
+    bool group = packet.flags & ESPNOW_V2_FLAG_GROUP;
+    if (group && packet.groupId != ESPNOW_GROUP_ID) return;
+    acceptPosition(r, packet.pvt, group);
+  }
+  // v1 frames are not modelled
+}
+
+static void announceTick(int r) {
+  SimReceiver& rx = receivers[r];
+  int64_t now = simMicros();
+  push(makeEvent(now + ANNOUNCE_INTERVAL_US, EV_ANNOUNCE_TICK, r, rx.mac, NULL, 0));
+  if (!rx.online || (rx.lastContactUs >= 0 && now - rx.lastContactUs <= CONTACT_TIMEOUT_US)) return;
+  EspNowAnnouncePacket announce;
+  announce.magic = ESPNOW_ANNOUNCE_MAGIC;
+  announce.groupId = ESPNOW_GROUP_ID;
+  memcpy(announce.mac, rx.mac, 6);
+  announce.reserved = 0;
+  receiverTransmit(r, (const uint8_t*)&announce, sizeof(announce), true);
+}
+
+// The sender's callbacks run without simLock, like driver callbacks outside the driver
+static void runSenderCallback(std::unique_lock<std::mutex>& guard, const Event& ev) {
+  guard.unlock();
+  int64_t start = simThreadCpuMicros();
+  if (ev.kind == EV_SEND_DONE) onEspNowSendComplete(ev.mac, ev.ok);
+  else onEspNowFrameReceived(ev.mac, ev.data.data(), (int)ev.data.size());
+  int64_t used = simThreadCpuMicros() - start;
+  guard.lock();
+  stats.callbackCpuUs += used;
+  stats.callbacks++;
+}
+
+static void wifiTask() {
+  std::unique_lock<std::mutex> guard(simLock);
+  while (running) {
+    if (events.empty()) {
+      simWake.wait(guard);
+      continue;
+    }
+    if (events.top().at > simMicros()) {
+      simWake.wait_until(guard, simHostDeadline(events.top().at));
+      continue;
+    }
+    Event ev = events.top();
+    events.pop();
+    switch (ev.kind) {
+      case EV_SEND_DONE:
+        pendingSends--;
+        runSenderCallback(guard, ev);
+        break;
+      case EV_RX_DELIVER:
+        receiverHandle(ev.receiver, ev.data.data(), ev.data.size());
+        break;
+      case EV_SENDER_DELIVER: {
+        size_t size = ev.data.size();
+        if (size == sizeof(TimedPong) || size == sizeof(TimedGroupPong)) {
+          SimReceiver& rx = receivers[ev.receiver];
+          rx.prevPongUs = rx.lastPongUs;
+          rx.lastPongUs = simMicros();
+          stats.pongsDelivered++;
+        }
+        runSenderCallback(guard, ev);
+        break;
+      }
+      case EV_ANNOUNCE_TICK:
+        announceTick(ev.receiver);
+        break;
+      case EV_SWITCH: {
+        SimReceiver& rx = receivers[ev.receiver];
+        rx.online = ev.ok;
+        rx.onlineSinceUs = ev.ok ? simMicros() : -1;
+        rx.offlineSinceUs = ev.ok ? -1 : simMicros();
+        break;
+      }
+    }
+  }
+}
+
+// ================= EspNowTransport =================
+bool espNowTransportBegin() {
+  std::lock_guard<std::mutex> guard(simLock);
+  running = true;
+  wifiThread = std::thread(wifiTask);
+  return true;
+}
+
+esp_err_t espNowTransportSend(const uint8_t* mac, const uint8_t* data, size_t len) {
+  std::lock_guard<std::mutex> guard(simLock);
+  esp_err_t err = ESP_OK;
+  if (!running) err = ESP_ERR_ESPNOW_NOT_INIT;
+  else if (len == 0 || len > ESP_NOW_MAX_DATA_LEN) err = ESP_ERR_ESPNOW_ARG;
+  else if (!isPeer(mac)) err = ESP_ERR_ESPNOW_NOT_FOUND;
+  else if (pendingSends >= DRIVER_QUEUE_DEPTH) err = ESP_ERR_ESPNOW_NO_MEM;
+  if (err != ESP_OK) {
+    stats.sendRefused++;
+    return err;
+  }
+  pendingSends++;
+
+  int64_t t = simMicros();
+  bool broadcast = memcmp(mac, broadcastMac, 6) == 0;
+  bool acked = broadcast;
+  if (broadcast) {
+    t = occupyAir(t, ACCESS_US + frameUs(len));
+    stats.downFrames++;
+    stats.downBytes += len;
+    for (size_t r = 0; r < receivers.size(); r++) {
+      if (receivers[r].online && !chance(cfg.loss)) {
+        push(makeEvent(t + deliveryDelay(), EV_RX_DELIVER, (int)r, senderMac, data, len));
+      }
+    }
+  } else {
+    int r = findReceiver(mac);
+    bool delivered = false;
+    for (int attempt = 0; attempt < cfg.macTries && !acked; attempt++) {
+      t = occupyAir(t, ACCESS_US + frameUs(len) + ackUs());
+      stats.downFrames++;
+      stats.downBytes += len;
+      if (r < 0 || !receivers[r].online || chance(cfg.loss)) continue;
+      if (!delivered) push(makeEvent(t + deliveryDelay(), EV_RX_DELIVER, r, senderMac, data, len));
+      delivered = true;
+      acked = !chance(cfg.loss);
+    }
+  }
+  Event done = makeEvent(t, EV_SEND_DONE, -1, mac, NULL, 0);
+  done.ok = acked;
+  push(std::move(done));
+  return ESP_OK;
+}
+
+bool espNowTransportAddPeer(const uint8_t* mac) {
+  std::lock_guard<std::mutex> guard(simLock);
+  if (isPeer(mac)) return true;
+  if ((int)peers.size() >= cfg.peerLimit) return false;
+  std::array<uint8_t, 6> peer;
+  memcpy(peer.data(), mac, 6);
+  peers.push_back(peer);
+  return true;
+}
+
+void espNowTransportRemovePeer(const uint8_t* mac) {
+  std::lock_guard<std::mutex> guard(simLock);
+  peers.erase(std::remove_if(peers.begin(), peers.end(),
+                             [mac](const std::array<uint8_t, 6>& peer) { return memcmp(peer.data(), mac, 6) == 0; }),
+              peers.end());
+}
+
+// ================= SIMULATION CONTROL =================
+void loopbackConfigure(const LoopbackConfig& config) {
+  std::lock_guard<std::mutex> guard(simLock);
+  cfg = config;
+  rng.seed(cfg.seed);
+  receivers.assign(cfg.receivers, SimReceiver());
+  std::vector<int> order;
+  for (int r = 0; r < cfg.receivers; r++) {
+    SimReceiver& rx = receivers[r];
+    const uint8_t mac[6] = {0x02, 0x52, 0x58, 0x00, (uint8_t)(r >> 8), (uint8_t)r};
+    memcpy(rx.mac, mac, 6);
+    // Receivers boot at random moments within one announce interval
+    push(makeEvent(std::uniform_int_distribution<int64_t>(0, ANNOUNCE_INTERVAL_US)(rng), EV_ANNOUNCE_TICK, r, rx.mac, NULL, 0));
+    order.push_back(r);
+  }
+  std::shuffle(order.begin(), order.end(), rng);
+  int switched = (int)(cfg.churn * cfg.receivers + 0.5);
+  for (int i = 0; i < switched; i++) {
+    Event off = makeEvent(cfg.churnAtUs, EV_SWITCH, order[i], receivers[order[i]].mac, NULL, 0);
+    push(off);
+    Event on = makeEvent(cfg.churnAtUs + cfg.churnForUs, EV_SWITCH, order[i], receivers[order[i]].mac, NULL, 0);
+    on.ok = true;
+    push(on);
+  }
+}
+
+void loopbackStop() {
+  {
+    std::lock_guard<std::mutex> guard(simLock);
+    running = false;
+    simWake.notify_all();
+  }
+  if (wifiThread.joinable()) wifiThread.join();
+}
+
+void loopbackEpochStarted(uint32_t pingCounter) {
+  std::lock_guard<std::mutex> guard(simLock);
+  epochStarts[pingCounter & 0xFF] = {pingCounter, simMicros()};
+  for (const SimReceiver& rx : receivers) {
+    if (rx.online) stats.pvtExpected++;
+  }
+}
+
+int loopbackFindReceiver(const uint8_t* mac) {
+  std::lock_guard<std::mutex> guard(simLock);
+  return findReceiver(mac);
+}
+
+LoopbackTruth loopbackTruth(int receiver) {
+  std::lock_guard<std::mutex> guard(simLock);
+  const SimReceiver& rx = receivers[receiver];
+  return {rx.lastPongUs, rx.prevPongUs, rx.onlineSinceUs, rx.offlineSinceUs};
+}
+
+LoopbackStats loopbackStats() {
+  std::lock_guard<std::mutex> guard(simLock);
+  return stats;
+}
+
+int loopbackRegisteredPeers() {
+  std::lock_guard<std::mutex> guard(simLock);
+  return (int)peers.size();
+}
@@ -0,0 +1,58 @@
+#ifndef LOOPBACK_TRANSPORT_H
+#define LOOPBACK_TRANSPORT_H
+
+#include <stdint.h>
+#include <vector>
+
+// EspNowTransport on one simulated channel. Every frame, the sender's and the receivers',
+// takes its airtime on a shared medium at the configured PHY rate; receivers behave like
+// the ESPHome YAMLs (announce until paired, pong every position frame, reassemble the
+// v3 bulk messages). Callbacks into the sender run on a "wifi" thread, as on the board.
+struct LoopbackConfig {
+  int receivers = 100;
+  double loss = 0.0;             // Per frame and direction; unicast frames are also retried by the MAC
+  uint32_t latencyUs = 1000;     // Frame on air -> application sees it
+  uint32_t jitterUs = 4000;      // Uniform extra delay on top (ESPHome loop, Wi-Fi task scheduling)
+  double reorder = 0.0;          // Share of frames held back by reorderUs, so later frames overtake them
+  uint32_t reorderUs = 20000;
+  int peerLimit = 20;            // ESP_NOW_MAX_TOTAL_PEER_NUM on the real driver
+  int macTries = 5;              // Unicast transmissions before the driver reports failure
+  double phyMbps = 1.0;          // ESP-NOW default rate
+  double churn = 0.0;            // Share of receivers switched off at churnAtUs for churnForUs
+  int64_t churnAtUs = 0;
+  int64_t churnForUs = 0;
+  uint32_t seed = 1;
+};
+
+struct LoopbackStats {
+  uint64_t downFrames = 0, downBytes = 0;   // Sender -> air, MAC retries included
+  uint64_t upFrames = 0, upBytes = 0;       // Receivers -> air (pongs, announces)
+  uint64_t airtimeUs = 0;
+  uint64_t pvtDelivered = 0;                // Position frames accepted by an online receiver (first copy)
+  uint64_t pvtExpected = 0;                 // Epochs x receivers online at that epoch
+  uint64_t pongsDelivered = 0;              // Pongs handed to onEspNowFrameReceived
+  uint64_t bulkCompleted[5] = {0};          // By v3 message type
+  uint64_t crcErrors = 0;
+  uint64_t sendRefused = 0;                 // espNowTransportSend errors
+  int64_t callbackCpuUs = 0;                // Host CPU inside the sender's two callbacks
+  uint64_t callbacks = 0;
+  std::vector<uint32_t> pvtAgeUs;           // Epoch start -> receiver accepted its position
+};
+
+// What the sender should believe about one receiver, from the pongs it was handed
+struct LoopbackTruth {
+  int64_t lastPongUs;                       // 0 = none yet
+  int64_t prevPongUs;
+  int64_t onlineSinceUs;                    // -1 while switched off
+  int64_t offlineSinceUs;                   // -1 while on
+};
+
+void loopbackConfigure(const LoopbackConfig& config);
+void loopbackStop();
+void loopbackEpochStarted(uint32_t pingCounter);  // Before sendGpsDataViaEspNow
+int loopbackFindReceiver(const uint8_t* mac);     // -1 for a MAC that is not simulated
+LoopbackTruth loopbackTruth(int receiver);
+LoopbackStats loopbackStats();                    // Copy of the running totals
+int loopbackRegisteredPeers();
+
+#endif
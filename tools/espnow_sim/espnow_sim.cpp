@@ -0,0 +1,446 @@
+// Runs the sender's ESP-NOW code (EspNowSender.cpp, EspNowPeers.cpp, GpsSnapshot.cpp,
+// unmodified) against LoopbackTransport with many simulated receivers, and reports:
+//   - host CPU per epoch on the loop task, the TX task and in the driver callbacks
+//   - whether checkEspNowClientTimeouts() agrees with the pongs the sender was handed
+//   - airtime, bytes and delivery as the receiver count grows
+// Send mode and packet version are build flags (see README.md). Exit status 1 = a
+// liveness mismatch was found.
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+#include "Arduino.h"
+#include "Preferences.h"
+#include "Context.h"
+#include "GpsLogic.h"
+#include "GpsSnapshot.h"
+#include "EspNowSender.h"
+#include "EspNowPeers.h"
+#include "EspNowProtocol.h"
+#include "LoopbackTransport.h"
+
+GPSData gpsData;
+
+void webSerialLog(const String& message) {
+  simCountLogLine();
+  if (simVerbose()) printf("[web] %s\n", message.c_str());
+}
+
+const GpsTaskStats& getGpsTaskStats() {
+  static GpsTaskStats stats;
+  return stats;
+}
+
+struct Options {
+  LoopbackConfig link;
+  double durationS = 120;
+  double rateHz = 1;
+  double warmupS = 10;
+  double timeScale = 1;
+  uint32_t loopUs = 1000;
+  bool defaultPeers = false;
+};
+
+static void usage() {
+  printf("usage: espnow_sim [options]\n"
+         "  --receivers N       simulated receivers (100)\n"
+         "  --duration S        simulated seconds (120)\n"
+         "  --rate HZ           navigation rate (1)\n"
+         "  --loss P            frame loss per direction, 0..1 (0)\n"
+         "  --latency-ms MS     air -> application delay (1)\n"
+         "  --jitter-ms MS      uniform extra delay (4)\n"
+         "  --reorder P         share of frames held back (0)\n"
+         "  --reorder-ms MS     hold-back time (20)\n"
+         "  --peer-limit N      ESP-NOW driver peer slots (20)\n"
+         "  --mac-tries N       unicast transmissions per send (5)\n"
+         "  --phy-mbps R        PHY rate (1)\n"
+         "  --churn P           share of receivers switched off (0.1)\n"
+         "  --churn-at S        ... at this time (30)\n"
+         "  --churn-for S       ... for this long (45)\n"
+         "  --warmup S          left out of the per-epoch figures (10)\n"
+         "  --loop-ms MS        loop() pass period (1)\n"
+         "  --time-scale X      run X times faster than real time (1)\n"
+         "  --default-peers     start from the compiled-in receivers instead of an empty table\n"
+         "  --seed N            random seed (1)\n"
+         "  --verbose           print Serial and web log lines\n");
+}
+
+static bool parseOptions(int argc, char** argv, Options& opt) {
+  opt.link.churn = 0.1;
+  opt.link.churnAtUs = 30000000;
+  opt.link.churnForUs = 45000000;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--verbose") { simSetVerbose(true); continue; }
+    if (arg == "--default-peers") { opt.defaultPeers = true; continue; }
+    if (i + 1 >= argc) return false;
+    double v = atof(argv[++i]);
+    if (arg == "--receivers") opt.link.receivers = (int)v;
+    else if (arg == "--duration") opt.durationS = v;
+    else if (arg == "--rate") opt.rateHz = v;
+    else if (arg == "--loss") opt.link.loss = v;
+    else if (arg == "--latency-ms") opt.link.latencyUs = (uint32_t)(v * 1000);
+    else if (arg == "--jitter-ms") opt.link.jitterUs = (uint32_t)(v * 1000);
+    else if (arg == "--reorder") opt.link.reorder = v;
+    else if (arg == "--reorder-ms") opt.link.reorderUs = (uint32_t)(v * 1000);
+    else if (arg == "--peer-limit") opt.link.peerLimit = (int)v;
+    else if (arg == "--mac-tries") opt.link.macTries = (int)v;
+    else if (arg == "--phy-mbps") opt.link.phyMbps = v;
+    else if (arg == "--churn") opt.link.churn = v;
+    else if (arg == "--churn-at") opt.link.churnAtUs = (int64_t)(v * 1e6);
+    else if (arg == "--churn-for") opt.link.churnForUs = (int64_t)(v * 1e6);
+    else if (arg == "--warmup") opt.warmupS = v;
+    else if (arg == "--loop-ms") opt.loopUs = (uint32_t)(v * 1000);
+    else if (arg == "--time-scale") opt.timeScale = v;
+    else if (arg == "--seed") opt.link.seed = (uint32_t)v;
+    else return false;
+  }
+  return opt.link.receivers > 0 && opt.rateHz > 0 && opt.durationS > 0;
+}
+
+// A fixed position with a live clock and a 24-satellite sky
+static void updateGps(uint32_t epoch) {
+  gpsData.isConnected = true;
+  gpsData.hasFix = true;
+  gpsData.fixType = 3;
+  gpsData.satellites = 18;
+  gpsData.satellitesVisible = 24;
+  gpsData.latE7 = 473977420 + (int32_t)(epoch % 100);
+  gpsData.lonE7 = 85455940;
+  gpsData.heightMm = 430000;
+  gpsData.pdopE2 = 140;
+  gpsData.hdopE2 = 80;
+  gpsData.vdopE2 = 110;
+  gpsData.hAccMm = 1500;
+  gpsData.vAccMm = 2500;
+  int64_t now = esp_timer_get_time();
+  gpsData.utcEpoch = 1767225600 + (uint32_t)(now / 1000000);
+  gpsData.utcMillis = (uint16_t)((now / 1000) % 1000);
+  gpsData.utcRefMicros = now;
+  gpsData.satCount = 24;
+  for (int i = 0; i < gpsData.satCount; i++) {
+    SatInfo& sat = gpsData.sats[i];
+    sat.gnssId = i / 8;
+    sat.svId = 1 + i;
+    sat.cno = 30 + i % 15;
+    sat.elev = 10 + i * 3;
+    sat.azim = i * 15;
+    sat.quality = 7;
+    sat.health = 1;
+    sat.used = i < gpsData.satellites;
+  }
+}
+
+struct Summary {
+  double mean = 0;
+  int64_t p95 = 0;
+  int64_t max = 0;
+};
+
+template <typename T>
+static Summary summarize(std::vector<T> values) {
+  Summary s;
+  if (values.empty()) return s;
+  std::sort(values.begin(), values.end());
+  double total = 0;
+  for (T v : values) total += v;
+  s.mean = total / values.size();
+  s.p95 = values[(values.size() * 95) / 100 < values.size() ? (values.size() * 95) / 100 : values.size() - 1];
+  s.max = values.back();
+  return s;
+}
+
+// ================= LIVENESS AUDIT =================
+struct Audit {
+  uint64_t checks = 0;
+  uint64_t staleActive = 0;            // Active, but no pong within the timeout
+  uint64_t missedPong = 0;             // Inactive, although a pong arrived within the timeout
+  uint64_t linkFailing = 0;            // Inactive on unicast delivery failures: explained
+  std::vector<int64_t> detectLagUs;    // Switched off -> marked inactive
+  std::vector<int64_t> firstActiveUs;  // Start -> first marked active
+  std::vector<int64_t> reconnectUs;    // Switched back on -> active again
+  std::vector<bool> wasActive;
+  std::vector<bool> everActive;
+  std::vector<int64_t> slotSinceUs;    // Pass that gave the receiver its slot; -1 = none
+  int peerCount = -1;
+  int maxTracked = 0;
+};
+
+static bool expectActive(int64_t pongUs, int64_t nowUs) {
+  return pongUs > 0 && (unsigned long)(nowUs / 1000 - pongUs / 1000) <= gpsData.espNowTimeoutMs;
+}
+
+#define AUDIT_MARGIN_US 500   // Pong vs. loop pass ordering the audit cannot resolve: accept either
+
+// After serviceEspNowPeers(): note when each receiver got its slot. A receiver's first
+// pong only requests the slot, so liveness counts pongs from then on.
+static void trackSlots(Audit& audit, int64_t passStartUs) {
+  int peers = countEspNowPeers();
+  if (peers == audit.peerCount) return;
+  audit.peerCount = peers;
+  std::vector<bool> present(audit.slotSinceUs.size(), false);
+  for (int slot = 0; slot < ESPNOW_MAX_CLIENTS; slot++) {
+    if (!espNowPeerUsed(slot)) continue;
+    int r = loopbackFindReceiver(gpsData.espNowClients[slot].macAddr);
+    if (r < 0) continue;
+    present[r] = true;
+    if (audit.slotSinceUs[r] < 0) audit.slotSinceUs[r] = passStartUs;
+  }
+  for (size_t r = 0; r < present.size(); r++) {
+    if (!present[r]) audit.slotSinceUs[r] = -1;
+  }
+}
+
+// Runs right after checkEspNowClientTimeouts(). checkStartUs/checkEndUs bracket its
+// millis(); pongs handed over after the last serviceEspNowReceive() may not be applied yet.
+static void auditLiveness(Audit& audit, int64_t checkStartUs, int64_t checkEndUs, int64_t lastServiceUs) {
+  int tracked = 0;
+  for (int slot = 0; slot < ESPNOW_MAX_CLIENTS; slot++) {
+    if (!espNowPeerUsed(slot)) continue;
+    bool active = gpsData.espNowClients[slot].isActive;
+    int r = loopbackFindReceiver(gpsData.espNowClients[slot].macAddr);
+    if (r < 0) {
+      // A compiled-in receiver that does not exist here
+      audit.checks++;
+      if (active) audit.staleActive++;
+      continue;
+    }
+    tracked++;
+    LoopbackTruth truth = loopbackTruth(r);
+    std::vector<int64_t> pongs = {truth.lastPongUs};
+    if (truth.lastPongUs >= lastServiceUs - AUDIT_MARGIN_US) pongs.push_back(truth.prevPongUs);
+    std::vector<int64_t> candidates;
+    for (int64_t pong : pongs) {
+      // A pong from before the slot existed only asked for it
+      if (pong >= audit.slotSinceUs[r] - AUDIT_MARGIN_US) candidates.push_back(pong);
+      if (pong < audit.slotSinceUs[r] + AUDIT_MARGIN_US) candidates.push_back(0);
+    }
+
+    bool consistent = false;
+    for (int64_t pong : candidates) {
+      for (int64_t now : {checkStartUs, checkEndUs}) {
+        if (expectActive(pong, now) == active) consistent = true;
+      }
+    }
+    audit.checks++;
+    if (!consistent && !active && !ESPNOW_BROADCAST_MODE) {
+      EspNowTxStats tx;
+      getEspNowTxStats(slot, tx);
+      if (tx.consecutiveFailures >= ESPNOW_FAILURE_THRESHOLD) {
+        audit.linkFailing++;
+        consistent = true;
+      }
+    }
+    if (!consistent) {
+      if (active) audit.staleActive++;
+      else audit.missedPong++;
+      if (audit.staleActive + audit.missedPong <= 5) {
+        printf("  mismatch: receiver %d %s at %.3f s, last pong %.3f s\n", r, active ? "active" : "inactive",
+               checkEndUs / 1e6, truth.lastPongUs / 1e6);
+      }
+    }
+
+    if (audit.wasActive[r] && !active && truth.offlineSinceUs >= 0) {
+      audit.detectLagUs.push_back(checkEndUs - truth.offlineSinceUs);
+    } else if (!audit.wasActive[r] && active) {
+      if (!audit.everActive[r]) audit.firstActiveUs.push_back(checkEndUs);
+      else if (truth.onlineSinceUs > 0) audit.reconnectUs.push_back(checkEndUs - truth.onlineSinceUs);
+      audit.everActive[r] = true;
+    }
+    audit.wasActive[r] = active;
+  }
+  audit.maxTracked = std::max(audit.maxTracked, tracked);
+}
+
+// ================= PER-EPOCH FIGURES =================
+struct EpochSamples {
+  std::vector<int64_t> epochCpuUs, serviceCpuUs, txCpuUs, callbackCpuUs, airtimeUs, downBytes, upBytes, logLines;
+};
+
+int main(int argc, char** argv) {
+  Options opt;
+  if (!parseOptions(argc, argv, opt)) {
+    usage();
+    return 2;
+  }
+  if (opt.link.receivers > 0xFFFF) opt.link.receivers = 0xFFFF;
+  simSetTimeScale(opt.timeScale);
+
+  if (!opt.defaultPeers) {
+    // A board whose peer table was cleared: every receiver has to pair
+    Preferences prefs;
+    prefs.begin("espnow_peers", false);
+    prefs.putBytes("peers", "", 0);
+    prefs.end();
+  }
+
+  printf("ESP-NOW simulator: %d receivers, %s, packet v%d, %.0f Hz, %.0f s (time scale %.0f)\n",
+         opt.link.receivers, ESPNOW_BROADCAST_MODE ? "broadcast" : "unicast", ESPNOW_PACKET_VERSION,
+         opt.rateHz, opt.durationS, opt.timeScale);
+  printf("Channel: loss %.1f%%, latency %.1f ms + 0-%.1f ms, reorder %.1f%% by %.0f ms, %d peer slots, %.0f Mbps\n",
+         opt.link.loss * 100, opt.link.latencyUs / 1e3, opt.link.jitterUs / 1e3, opt.link.reorder * 100,
+         opt.link.reorderUs / 1e3, opt.link.peerLimit, opt.link.phyMbps);
+
+  loopbackConfigure(opt.link);
+  updateGps(0);
+  publishGpsSnapshot();
+  setupEspNow();
+
+  Audit audit;
+  audit.wasActive.assign(opt.link.receivers, false);
+  audit.everActive.assign(opt.link.receivers, false);
+  audit.slotSinceUs.assign(opt.link.receivers, -1);
+  EpochSamples samples;
+
+  int64_t periodUs = (int64_t)(1e6 / opt.rateHz);
+  int64_t endUs = (int64_t)(opt.durationS * 1e6);
+  int64_t warmupUs = (int64_t)(opt.warmupS * 1e6);
+  int64_t nextEpochUs = periodUs;
+  int64_t lastServiceUs = 0;
+  uint32_t epoch = 0;
+
+  // Running totals at the start of the current epoch
+  int64_t epochCpu = 0;    // sendGpsDataViaEspNow + checkEspNowClientTimeouts
+  int64_t serviceCpu = 0;  // serviceEspNowReceive + serviceEspNowPeers, every pass
+  int64_t txCpuMark = simTaskCpuMicros("espnow_tx");
+  LoopbackStats linkMark = loopbackStats();
+  uint32_t logMark = simLogLines();
+  int64_t epochStartUs = 0;
+
+  while (simMicros() < endUs) {
+    int64_t now = simMicros();
+    if (now >= nextEpochUs) {
+      nextEpochUs += periodUs;
+
+      // Close the epoch that just ended
+      int64_t txCpu = simTaskCpuMicros("espnow_tx");
+      LoopbackStats link = loopbackStats();
+      uint32_t logs = simLogLines();
+      if (epoch > 0 && epochStartUs >= warmupUs) {
+        samples.epochCpuUs.push_back(epochCpu);
+        samples.serviceCpuUs.push_back(serviceCpu);
+        samples.txCpuUs.push_back(txCpu - txCpuMark);
+        samples.callbackCpuUs.push_back(link.callbackCpuUs - linkMark.callbackCpuUs);
+        samples.airtimeUs.push_back(link.airtimeUs - linkMark.airtimeUs);
+        samples.downBytes.push_back(link.downBytes - linkMark.downBytes);
+        samples.upBytes.push_back(link.upBytes - linkMark.upBytes);
+        samples.logLines.push_back(logs - logMark);
+      }
+      epochCpu = 0;
+      serviceCpu = 0;
+      txCpuMark = txCpu;
+      linkMark = link;
+      logMark = logs;
+      epochStartUs = now;
+
+      // What loop() does with a new epoch
+      updateGps(++epoch);
+      publishGpsSnapshot();
+      loopbackEpochStarted(gpsData.espNowPingCounter + 1);
+      int64_t cpuStart = simThreadCpuMicros();
+      sendGpsDataViaEspNow();
+      int64_t checkStartUs = simMicros();
+      checkEspNowClientTimeouts();
+      int64_t checkEndUs = simMicros();
+      epochCpu += simThreadCpuMicros() - cpuStart;
+      auditLiveness(audit, checkStartUs, checkEndUs, lastServiceUs);
+    }
+
+    lastServiceUs = simMicros();
+    int64_t cpuStart = simThreadCpuMicros();
+    serviceEspNowReceive();
+    serviceEspNowPeers();
+    serviceCpu += simThreadCpuMicros() - cpuStart;
+    trackSlots(audit, lastServiceUs);
+    simSleepMicros(opt.loopUs);
+  }
+  loopbackStop();
+
+  // ================= REPORT =================
+  LoopbackStats link = loopbackStats();
+  const EspNowTxQueueStats& txq = getEspNowTxQueueStats();
+  const EspNowRxStats& rxs = getEspNowRxStats();
+  uint32_t retries = 0;
+  double rttMeanSum = 0;
+  uint32_t rttPeers = 0, rttWorstP95 = 0;
+  for (int slot = -1; slot < ESPNOW_MAX_CLIENTS; slot++) {
+    if (slot >= 0 && !espNowPeerUsed(slot)) continue;
+    EspNowTxStats tx;
+    getEspNowTxStats(slot, tx);
+    retries += tx.retries;
+    if (slot < 0) continue;
+    const EspNowRttStats& rtt = getEspNowRttStats(slot);
+    if (rtt.samples == 0) continue;
+    rttMeanSum += rtt.meanUs;
+    rttPeers++;
+    rttWorstP95 = std::max(rttWorstP95, rtt.p95Us);
+  }
+
+  Summary firstActive = summarize(audit.firstActiveUs);
+  Summary detectLag = summarize(audit.detectLagUs);
+  Summary reconnect = summarize(audit.reconnectUs);
+  Summary epochCpuS = summarize(samples.epochCpuUs);
+  Summary serviceCpuS = summarize(samples.serviceCpuUs);
+  Summary txCpuS = summarize(samples.txCpuUs);
+  Summary cbCpuS = summarize(samples.callbackCpuUs);
+  Summary airS = summarize(samples.airtimeUs);
+  Summary downS = summarize(samples.downBytes);
+  Summary upS = summarize(samples.upBytes);
+  Summary logS = summarize(samples.logLines);
+  Summary ageS = summarize(link.pvtAgeUs);
+  double delivery = link.pvtExpected ? 100.0 * link.pvtDelivered / link.pvtExpected : 0;
+
+  printf("\nPeers\n");
+  printf("  tracked (most at once)    %d of %d receivers, %d driver peer slots used\n", audit.maxTracked,
+         opt.link.receivers, loopbackRegisteredPeers());
+  printf("  first marked active       %zu receivers, mean %.1f s, max %.1f s after start\n",
+         audit.firstActiveUs.size(), firstActive.mean / 1e6, firstActive.max / 1e6);
+
+  printf("Liveness (checkEspNowClientTimeouts vs pongs handed to the sender)\n");
+  printf("  slot checks               %llu\n", (unsigned long long)audit.checks);
+  printf("  mismatches                %llu (active without pong: %llu, inactive despite pong: %llu)\n",
+         (unsigned long long)(audit.staleActive + audit.missedPong), (unsigned long long)audit.staleActive,
+         (unsigned long long)audit.missedPong);
+  printf("  inactive on failing link  %llu\n", (unsigned long long)audit.linkFailing);
+  printf("  switched off -> inactive  n=%zu, mean %.1f s, max %.1f s (pong timeout %lu s)\n", audit.detectLagUs.size(),
+         detectLag.mean / 1e6, detectLag.max / 1e6, gpsData.espNowTimeoutMs / 1000);
+  printf("  back on -> active         n=%zu, mean %.1f s, max %.1f s\n", audit.reconnectUs.size(),
+         reconnect.mean / 1e6, reconnect.max / 1e6);
+
+  printf("Per epoch (%zu epochs after %.0f s warm-up; host CPU)\n", samples.epochCpuUs.size(), opt.warmupS);
+  printf("  send + timeout check      mean %.0f us, p95 %lld us, max %lld us\n", epochCpuS.mean,
+         (long long)epochCpuS.p95, (long long)epochCpuS.max);
+  printf("  receive + peer servicing  mean %.0f us, p95 %lld us, max %lld us (includes idle passes)\n",
+         serviceCpuS.mean, (long long)serviceCpuS.p95, (long long)serviceCpuS.max);
+  printf("  TX task CPU               mean %.0f us, p95 %lld us, max %lld us\n", txCpuS.mean,
+         (long long)txCpuS.p95, (long long)txCpuS.max);
+  printf("  driver callbacks CPU      mean %.0f us, p95 %lld us, max %lld us\n", cbCpuS.mean,
+         (long long)cbCpuS.p95, (long long)cbCpuS.max);
+  printf("  log lines                 mean %.0f, max %lld\n", logS.mean, (long long)logS.max);
+  printf("  airtime                   mean %.1f ms (%.1f%% of the epoch), max %.1f ms\n", airS.mean / 1e3,
+         100.0 * airS.mean / periodUs, airS.max / 1e3);
+  printf("  bytes on air              sender %.0f, receivers %.0f (payload only)\n", downS.mean, upS.mean);
+
+  printf("Delivery\n");
+  printf("  position frames           %.1f%% of online receiver-epochs, age mean %.1f ms, p95 %.1f ms, max %.1f ms\n",
+         delivery, ageS.mean / 1e3, ageS.p95 / 1e3, ageS.max / 1e3);
+  printf("  bulk messages completed   sats %llu, stats %llu, health %llu (queued %u, sent %u, superseded %u)\n",
+         (unsigned long long)link.bulkCompleted[ESPNOW_MSG_SATS], (unsigned long long)link.bulkCompleted[ESPNOW_MSG_STATS],
+         (unsigned long long)link.bulkCompleted[ESPNOW_MSG_HEALTH], txq.bulkQueued, txq.bulkSent, txq.bulkSuperseded);
+  printf("  pongs                     %llu handed to the sender, %u dropped (RX ring full)\n",
+         (unsigned long long)link.pongsDelivered, rxs.dropped);
+  printf("  round trip                mean %.1f ms over %u peers, worst p95 %.1f ms\n",
+         rttPeers ? rttMeanSum / rttPeers / 1e3 : 0.0, rttPeers, rttWorstP95 / 1e3);
+  printf("  TX queue                  frames %u, superseded %u, abandoned %u, retries %u, timeouts %u, refused %llu\n",
+         txq.frames, txq.superseded, txq.abandoned, retries, txq.timeouts, (unsigned long long)link.sendRefused);
+  printf("  CRC errors                %llu\n", (unsigned long long)link.crcErrors);
+
+  // One line per run, for sweeps
+  printf("\nRESULT receivers=%d mode=%s version=%d tracked=%d mismatches=%llu epoch_cpu_us=%.0f service_cpu_us=%.0f tx_cpu_us=%.0f "
+         "cb_cpu_us=%.0f airtime_ms=%.2f delivery_pct=%.1f age_p95_ms=%.1f rx_dropped=%u\n",
+         opt.link.receivers, ESPNOW_BROADCAST_MODE ? "broadcast" : "unicast", ESPNOW_PACKET_VERSION, audit.maxTracked,
+         (unsigned long long)(audit.staleActive + audit.missedPong), epochCpuS.mean, serviceCpuS.mean, txCpuS.mean, cbCpuS.mean,
+         airS.mean / 1e3, delivery, ageS.p95 / 1e3, rxs.dropped);
+  // The sender's TX task never returns: leave without running static destructors under it
+  fflush(stdout);
+  _exit(audit.staleActive + audit.missedPong > 0 ? 1 : 0);
+}
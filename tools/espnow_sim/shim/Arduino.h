@@ -0,0 +1,86 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Just enough of the Arduino core for EspNowSender, EspNowPeers and GpsSnapshot
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "SimClock.h"
+
+typedef uint8_t byte;
+
+#define DEC 10
+#define HEX 16
+
+class String {
+public:
+  String() {}
+  String(const char* text) : s(text ? text : "") {}
+  String(const std::string& text) : s(text) {}
+  String(char c) : s(1, c) {}
+  String(int value, unsigned char base = DEC) : s(format(value < 0, value < 0 ? -(long long)value : value, base)) {}
+  String(long value, unsigned char base = DEC) : s(format(value < 0, value < 0 ? -(long long)value : value, base)) {}
+  String(unsigned int value, unsigned char base = DEC) : s(format(false, value, base)) {}
+  String(unsigned long value, unsigned char base = DEC) : s(format(false, value, base)) {}
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  String& operator+=(const String& other) { s += other.s; return *this; }
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator!=(const String& other) const { return s != other.s; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+
+private:
+  static std::string format(bool negative, unsigned long long value, unsigned char base) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), base == HEX ? "%s%llX" : "%s%llu", negative ? "-" : "", value);
+    return buf;
+  }
+  std::string s;
+};
+
+class IPAddress {
+public:
+  IPAddress() : addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  operator uint32_t() const { return addr; }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr & 0xFF, (addr >> 8) & 0xFF, (addr >> 16) & 0xFF, addr >> 24);
+    return String(buf);
+  }
+private:
+  uint32_t addr;
+};
+
+class SimSerial {
+public:
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  void print(const char* text);
+  void print(const String& text) { print(text.c_str()); }
+  void println(const char* text = "");
+  void println(const String& text) { println(text.c_str()); }
+};
+extern SimSerial Serial;
+
+class SimEsp {
+public:
+  uint32_t getFreeHeap() { return 200000; }
+};
+extern SimEsp ESP;
+
+inline unsigned long millis() { return (unsigned long)(simMicros() / 1000); }
+inline unsigned long micros() { return (unsigned long)simMicros(); }
+inline void delay(uint32_t ms) { simSleepMicros((int64_t)ms * 1000); }
+inline void yield() {}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+#include <chrono>
+
+// The simulated board's clock. millis(), esp_timer and FreeRTOS ticks all read it, and
+// it runs timeScale times faster than the host clock so long timeouts (30 s pong
+// liveness) can be exercised quickly. CPU time is measured on the host clock, unscaled.
+void simSetTimeScale(double scale);
+int64_t simMicros();
+void simSleepMicros(int64_t us);
+std::chrono::steady_clock::time_point simHostDeadline(int64_t simUs); // Host time at which simMicros() reaches simUs
+
+// Host CPU time of the calling thread, and of a task started with xTaskCreate
+int64_t simThreadCpuMicros();
+int64_t simTaskCpuMicros(const char* name);
+
+// Serial and webSerialLog output is counted, and printed only when verbose
+void simSetVerbose(bool verbose);
+bool simVerbose();
+void simCountLogLine();
+uint32_t simLogLines();
+
+#endif
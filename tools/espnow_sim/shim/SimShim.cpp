@@ -0,0 +1,261 @@
+// Host implementations behind the shim headers: clock, FreeRTOS tasks/queues/notifications,
+// Serial, WiFi and Preferences
+#include <stdarg.h>
+#include <pthread.h>
+#include <time.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+#include "Preferences.h"
+
+// ================= CLOCK =================
+static const std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+static double timeScale = 1.0;
+
+void simSetTimeScale(double scale) {
+  timeScale = scale > 0 ? scale : 1.0;
+}
+
+int64_t simMicros() {
+  auto host = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostStart);
+  return (int64_t)(host.count() * timeScale);
+}
+
+std::chrono::steady_clock::time_point simHostDeadline(int64_t simUs) {
+  return hostStart + std::chrono::microseconds((int64_t)(simUs / timeScale));
+}
+
+void simSleepMicros(int64_t us) {
+  if (us > 0) std::this_thread::sleep_until(simHostDeadline(simMicros() + us));
+}
+
+static int64_t cpuClockMicros(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int64_t simThreadCpuMicros() {
+  return cpuClockMicros(CLOCK_THREAD_CPUTIME_ID);
+}
+
+// ================= LOGGING =================
+static bool verbose = false;
+static std::atomic<uint32_t> logLines(0);
+
+void simSetVerbose(bool enabled) { verbose = enabled; }
+bool simVerbose() { return verbose; }
+void simCountLogLine() { logLines++; }
+uint32_t simLogLines() { return logLines.load(); }
+
+SimSerial Serial;
+SimEsp ESP;
+SimWiFi WiFi;
+
+void SimSerial::printf(const char* format, ...) {
+  simCountLogLine();
+  if (!verbose) return;
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+void SimSerial::print(const char* text) {
+  if (verbose) fputs(text, stdout);
+}
+
+void SimSerial::println(const char* text) {
+  simCountLogLine();
+  if (verbose) puts(text);
+}
+
+String SimWiFi::macAddress() {
+  return String("02:53:45:4E:44:00");
+}
+
+// ================= TASKS =================
+struct SimTask {
+  std::string name;
+  TaskFunction_t fn;
+  void* param;
+  pthread_t thread;
+  std::mutex lock;
+  std::condition_variable cv;
+  uint32_t value = 0;
+  bool pending = false;
+};
+
+static std::mutex taskListLock;
+static std::vector<SimTask*> tasks;
+static thread_local SimTask* currentTask = nullptr;
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t, void* param, UBaseType_t, TaskHandle_t* handle) {
+  SimTask* task = new SimTask();
+  task->name = name;
+  task->fn = fn;
+  task->param = param;
+  {
+    std::lock_guard<std::mutex> guard(taskListLock);
+    tasks.push_back(task);
+  }
+  if (handle) *handle = task;
+  std::thread thread([task]() {
+    currentTask = task;
+    task->fn(task->param);
+  });
+  task->thread = thread.native_handle();
+  thread.detach();
+  return pdPASS;
+}
+
+int64_t simTaskCpuMicros(const char* name) {
+  std::lock_guard<std::mutex> guard(taskListLock);
+  for (SimTask* task : tasks) {
+    if (task->name != name) continue;
+    clockid_t clock;
+    if (pthread_getcpuclockid(task->thread, &clock) != 0) return 0;
+    return cpuClockMicros(clock);
+  }
+  return 0;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+  if (task == nullptr) return pdFALSE;
+  std::lock_guard<std::mutex> guard(task->lock);
+  if (action == eSetBits) task->value |= value;
+  else if (action == eIncrement) task->value++;
+  else if (action != eNoAction) task->value = value;
+  task->pending = true;
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t wait) {
+  SimTask* task = currentTask;
+  std::unique_lock<std::mutex> guard(task->lock);
+  if (!task->pending) {
+    task->value &= ~clearOnEntry;
+    if (wait == portMAX_DELAY) {
+      task->cv.wait(guard, [task] { return task->pending; });
+    } else {
+      auto deadline = simHostDeadline(simMicros() + (int64_t)wait * 1000);
+      task->cv.wait_until(guard, deadline, [task] { return task->pending; });
+    }
+  }
+  if (value) *value = task->value;
+  if (!task->pending) return pdFALSE;
+  task->value &= ~clearOnExit;
+  task->pending = false;
+  return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)(simMicros() / 1000);
+}
+
+void vTaskDelay(TickType_t ticks) {
+  simSleepMicros((int64_t)ticks * 1000);
+}
+
+// ================= QUEUES =================
+struct SimQueue {
+  std::mutex lock;
+  std::condition_variable cv;
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  SimQueue* queue = new SimQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+static bool waitFor(SimQueue* queue, std::unique_lock<std::mutex>& guard, TickType_t wait, bool (*ready)(SimQueue*)) {
+  if (ready(queue) || wait == 0) return ready(queue);
+  auto pred = [queue, ready] { return ready(queue); };
+  if (wait == portMAX_DELAY) {
+    queue->cv.wait(guard, pred);
+    return true;
+  }
+  return queue->cv.wait_until(guard, simHostDeadline(simMicros() + (int64_t)wait * 1000), pred);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+  std::unique_lock<std::mutex> guard(queue->lock);
+  if (!waitFor(queue, guard, wait, [](SimQueue* q) { return q->items.size() < q->length; })) return pdFALSE;
+  const uint8_t* bytes = (const uint8_t*)item;
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  queue->cv.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+  std::lock_guard<std::mutex> guard(queue->lock);
+  const uint8_t* bytes = (const uint8_t*)item;
+  queue->items.clear();
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  queue->cv.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+  std::unique_lock<std::mutex> guard(queue->lock);
+  if (!waitFor(queue, guard, wait, [](SimQueue* q) { return !q->items.empty(); })) return pdFALSE;
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  queue->cv.notify_all();
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> guard(queue->lock);
+  return queue->items.size();
+}
+
+// ================= PREFERENCES =================
+static std::mutex nvsLock;
+static std::map<std::string, std::vector<uint8_t>> nvs; // "namespace/key" -> value
+
+bool Preferences::begin(const char* name, bool) {
+  ns = name;
+  return true;
+}
+
+bool Preferences::isKey(const char* key) {
+  std::lock_guard<std::mutex> guard(nvsLock);
+  return nvs.count(ns + "/" + key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  std::lock_guard<std::mutex> guard(nvsLock);
+  const uint8_t* bytes = (const uint8_t*)value;
+  nvs[ns + "/" + key].assign(bytes, bytes + len);
+  return len;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  std::lock_guard<std::mutex> guard(nvsLock);
+  auto it = nvs.find(ns + "/" + key);
+  if (it == nvs.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::putBool(const char* key, bool value) {
+  uint8_t byteValue = value ? 1 : 0;
+  return putBytes(key, &byteValue, 1);
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue) {
+  uint8_t byteValue;
+  return getBytes(key, &byteValue, 1) == 1 ? byteValue != 0 : defaultValue;
+}
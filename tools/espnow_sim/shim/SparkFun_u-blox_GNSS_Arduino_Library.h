@@ -0,0 +1,9 @@
+#ifndef SIM_SPARKFUN_UBLOX_H
+#define SIM_SPARKFUN_UBLOX_H
+
+// Only the names Context.h and GpsLogic.h mention; the simulator has no GNSS module
+class SFE_UBLOX_GNSS {};
+typedef struct {} UBX_NAV_PVT_data_t;
+typedef struct {} UBX_NAV_DOP_data_t;
+
+#endif
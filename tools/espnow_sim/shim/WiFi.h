@@ -0,0 +1,18 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+
+// A station that is always associated
+class SimWiFi {
+public:
+  wl_status_t status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(192, 168, 1, 100); }
+  int8_t RSSI() { return -55; }
+  String macAddress();
+};
+extern SimWiFi WiFi;
+
+#endif
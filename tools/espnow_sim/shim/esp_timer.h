@@ -0,0 +1,8 @@
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include "SimClock.h"
+
+inline int64_t esp_timer_get_time() { return simMicros(); }
+
+#endif
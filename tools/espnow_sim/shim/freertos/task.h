@@ -0,0 +1,20 @@
+#ifndef SIM_FREERTOS_TASK_H
+#define SIM_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+struct SimTask;
+typedef SimTask* TaskHandle_t;
+
+enum eNotifyAction { eNoAction, eSetBits, eIncrement, eSetValueWithOverwrite, eSetValueWithoutOverwrite };
+
+// Each task is a detached host thread; priority and stack size are ignored
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackSize, void* param,
+                       UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t wait);
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+
+#endif
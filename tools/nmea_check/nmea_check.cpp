@@ -0,0 +1,326 @@
+// Host check for the sender's NmeaEncoder.
+//
+// Renders RMC, GGA, GSA, VTG and ZDA from randomized epochs (plus edge cases: zero, poles,
+// antimeridian, minute carry, rounding ties, negative altitude) and compares each sentence with
+// two references built from the same GpsSnapshot:
+//
+//   exact   snprintf over the integer UBX fields, rounded the same way (halves away from zero).
+//           Must match byte for byte: digits, padding, signs, carries, layout and checksum.
+//   legacy  the float renderer the firmware used before NmeaEncoder ("%07.4f" minutes,
+//           speed * 1.94384, ...). The encoder is not byte-identical to it. A field may only
+//           differ in one of the documented ways (README, NMEA Output):
+//             tie        the exact value is halfway between two outputs; the encoder rounds
+//                        away from zero, legacy went whichever way the binary double fell
+//             knots      legacy's 1.94384 is short of 1852 m/nmi; one unit in the last place
+//             float      heading is a float in GpsSnapshot, so near a tie legacy rounded the
+//                        float instead of the UBX value
+//             zero       legacy printed "-0.00" for values just below zero
+//             carry      legacy printed "60.0000" minutes instead of carrying into the degree
+//           Any other difference, including one unit outside a tie, fails.
+//
+//   S="../../GPS Sender - SparkFun ESP32-C6 Qwiic"
+//   g++ -std=gnu++17 -O2 -Wall -I../espnow_sim/shim -I"$S" nmea_check.cpp "$S/NmeaEncoder.cpp" -o nmea_check
+//   ./nmea_check [epochs] [seed]           # default 2000000 epochs; exit status 1 on any mismatch
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "NmeaEncoder.h"
+
+static uint64_t rngState = 1;
+
+static uint32_t rnd() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (uint32_t)rngState;
+}
+
+static int32_t rndRange(int32_t lo, int32_t hi) {
+  return lo + (int32_t)(rnd() % (uint32_t)((int64_t)hi - lo + 1));
+}
+
+// ================= REFERENCES =================
+static std::string withChecksum(const std::string& body) {
+  uint8_t cs = 0;
+  for (char c : body) cs ^= (uint8_t)c;
+  char tail[8];
+  snprintf(tail, sizeof(tail), "*%02X\r\n", cs);
+  return "$" + body + tail;
+}
+
+// Halves away from zero, or with tiesDown halves toward zero (den > 0)
+static int64_t roundDiv(int64_t num, int64_t den, bool tiesDown = false) {
+  int64_t half = tiesDown ? (den - 1) / 2 : den / 2;
+  return num >= 0 ? (num + half) / den : -((-num + half) / den);
+}
+
+static std::string fixed2(int64_t hundredths) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%s%lld.%02lld", hundredths < 0 ? "-" : "",
+           (long long)(llabs(hundredths) / 100), (long long)(llabs(hundredths) % 100));
+  return buf;
+}
+
+static std::string exactCoord(int32_t degE7, bool isLon, bool tiesDown) {
+  // Whole value in 1e-4 minutes first, then split - a different route to the same digits
+  int64_t totalE4 = roundDiv(llabs((int64_t)degE7) * 6, 100, tiesDown);
+  char buf[24];
+  snprintf(buf, sizeof(buf), isLon ? "%03lld%02lld.%04lld" : "%02lld%02lld.%04lld",
+           (long long)(totalE4 / 600000), (long long)(totalE4 % 600000 / 10000), (long long)(totalE4 % 10000));
+  return buf;
+}
+
+static std::string legacyCoord(double deg, bool isLon) {
+  int d = (int)fabs(deg);
+  double m = (fabs(deg) - d) * 60.0;
+  char buf[24];
+  snprintf(buf, sizeof(buf), isLon ? "%03d%07.4f" : "%02d%07.4f", d, m);
+  return buf;
+}
+
+struct Fields {
+  std::string lat, lon, knots, kmh, heading, alt, pdop, hdop, vdop;
+};
+
+// tiesDown gives the other rounding of every exact tie, which legacy may have printed
+static Fields exactFields(const GpsSnapshot& s, bool tiesDown = false) {
+  Fields f;
+  f.lat = exactCoord(s.latE7, false, tiesDown);
+  f.lon = exactCoord(s.lonE7, true, tiesDown);
+  f.knots = fixed2(roundDiv((int64_t)s.gSpeedMmS * 36000, 185200, tiesDown));
+  f.kmh = fixed2(roundDiv((int64_t)s.gSpeedMmS * 36, 100, tiesDown));
+  f.heading = fixed2(roundDiv(s.headMotE5, 1000, tiesDown));
+  f.alt = fixed2(roundDiv(s.heightMm, 10, tiesDown));
+  f.pdop = fixed2(s.pdopE2);
+  f.hdop = fixed2(s.hdopE2);
+  f.vdop = fixed2(s.vdopE2);
+  return f;
+}
+
+// The exact fields, except heading rounded from GpsSnapshot's float as legacy did
+static Fields floatHeadingFields(const GpsSnapshot& s) {
+  Fields f = exactFields(s);
+  f.heading = fixed2(llrint((double)s.heading * 100)); // Exact ties to even, as printf does
+  return f;
+}
+
+static Fields legacyFields(const GpsSnapshot& s) {
+  char buf[32];
+  Fields f;
+  f.lat = legacyCoord(s.lat, false);
+  f.lon = legacyCoord(s.lon, true);
+  snprintf(buf, sizeof(buf), "%.2f", s.speed * 1.94384); f.knots = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.speed * 3.6); f.kmh = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.heading); f.heading = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.alt); f.alt = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.pdop); f.pdop = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.hdop); f.hdop = buf;
+  snprintf(buf, sizeof(buf), "%.2f", s.vdop); f.vdop = buf;
+  return f;
+}
+
+static std::vector<std::string> referenceSentences(const GpsSnapshot& s, const Fields& f) {
+  char t[16], d[16], z[32];
+  snprintf(t, sizeof(t), "%02u%02u%02u.00", s.hour, s.minute, s.second);
+  snprintf(d, sizeof(d), "%02u%02u%02u", s.day, s.month, s.year % 100);
+  snprintf(z, sizeof(z), "%02u,%02u,%04u", s.day, s.month, s.year);
+  std::string ns = s.latE7 >= 0 ? "N" : "S", ew = s.lonE7 >= 0 ? "E" : "W";
+  int mode = s.fixType == 2 ? 2 : s.fixType == 3 ? 3 : 1;
+  std::string pos = f.lat + "," + ns + "," + f.lon + "," + ew;
+  return {
+    withChecksum("GPRMC," + std::string(t) + "," + (s.hasFix ? "A" : "V") + "," + pos + "," + f.knots + "," +
+                 f.heading + "," + d + ",,,"),
+    withChecksum("GPGGA," + std::string(t) + "," + pos + "," + (s.hasFix ? "1" : "0") + "," +
+                 std::to_string(s.satellites) + "," + f.hdop + "," + f.alt + ",M,0.0,M,,"),
+    withChecksum("GPGSA,A," + std::to_string(mode) + ",,,,,,,,,,,,," + f.pdop + "," + f.hdop + "," + f.vdop),
+    withChecksum("GPVTG," + f.heading + ",T,,M," + f.knots + ",N," + f.kmh + ",K," + (s.hasFix ? "A" : "N")),
+    withChecksum("GPZDA," + std::string(t) + "," + z + ",00,00"),
+  };
+}
+
+static std::vector<std::string> encoderSentences(const GpsSnapshot& s) {
+  void (*const renderers[])(NmeaWriter&, const GpsSnapshot&) = {nmeaRMC, nmeaGGA, nmeaGSA, nmeaVTG, nmeaZDA};
+  std::vector<std::string> out;
+  for (auto render : renderers) {
+    char buf[128];
+    NmeaWriter w(buf, sizeof(buf));
+    render(w, s);
+    out.emplace_back(buf, w.length());
+  }
+  return out;
+}
+
+// ================= LEGACY TOLERANCE =================
+static std::vector<std::string> splitFields(const std::string& sentence) {
+  std::vector<std::string> fields;
+  std::string body = sentence.substr(1, sentence.find('*') - 1);
+  size_t start = 0, comma;
+  while ((comma = body.find(',', start)) != std::string::npos) {
+    fields.push_back(body.substr(start, comma - start));
+    start = comma + 1;
+  }
+  fields.push_back(body.substr(start));
+  return fields;
+}
+
+static double coordDegrees(const std::string& field) {
+  size_t dot = field.find('.');
+  double minutes = atof(field.c_str() + dot - 2);
+  return atoi(field.substr(0, dot - 2).c_str()) + minutes / 60.0;
+}
+
+// Legacy "%07.4f" minutes of 59.99995 and up came out as "60.0000" instead of carrying
+static bool isMinuteCarry(const std::string& got, const std::string& legacy) {
+  size_t dot = legacy.find('.');
+  return dot != std::string::npos && dot >= 2 && legacy.compare(dot - 2, 7, "60.0000") == 0 &&
+         fabs(coordDegrees(got) - coordDegrees(legacy)) < 1e-9;
+}
+
+// Sentence field that carries knots, which is the only one compared with a tolerance
+static int knotsFieldIndex(size_t sentence) {
+  if (sentence == 0) return 7; // RMC
+  if (sentence == 3) return 5; // VTG
+  return -1;
+}
+
+enum LegacyDiff { DIFF_TIE, DIFF_FLOAT, DIFF_KNOTS, DIFF_ZERO, DIFF_CARRY, DIFF_COUNT };
+
+// Classify each field where the encoder differs from legacy. Returns the number of
+// differences outside the documented ones; counts the documented ones in diffs.
+static int legacyMismatches(const std::string& got, const std::string& legacy, const std::string& tiesDown,
+                            const std::string& floatHeading, int knotsField, uint64_t diffs[DIFF_COUNT],
+                            std::string& detail) {
+  std::vector<std::string> a = splitFields(got), b = splitFields(legacy), t = splitFields(tiesDown);
+  std::vector<std::string> h = splitFields(floatHeading);
+  if (a.size() != b.size() || a.size() != t.size() || a.size() != h.size()) {
+    detail = "field count";
+    return 1;
+  }
+  int bad = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i] == b[i]) continue;
+    if (b[i] == t[i]) {
+      diffs[DIFF_TIE]++;
+    } else if (b[i] == h[i]) {
+      diffs[DIFF_FLOAT]++;
+    } else if ((int)i == knotsField && fabs(atof(a[i].c_str()) - atof(b[i].c_str())) < 0.01 * 1.001) {
+      diffs[DIFF_KNOTS]++;
+    } else if (b[i] == "-0.00" && a[i] == "0.00") {
+      diffs[DIFF_ZERO]++;
+    } else if (isMinuteCarry(a[i], b[i])) {
+      diffs[DIFF_CARRY]++;
+    } else {
+      bad++;
+      detail = a[i] + " vs " + b[i];
+    }
+  }
+  return bad;
+}
+
+// ================= EPOCHS =================
+static void setEpoch(GpsSnapshot& s, int32_t latE7, int32_t lonE7, int32_t heightMm, int32_t speedMmS,
+                     int32_t headE5, uint16_t pdop, uint16_t hdop, uint16_t vdop) {
+  // Float fields derived as applyGpsEpoch() does, for the legacy reference
+  s.latE7 = latE7;
+  s.lonE7 = lonE7;
+  s.heightMm = heightMm;
+  s.gSpeedMmS = speedMmS;
+  s.headMotE5 = headE5;
+  s.pdopE2 = pdop;
+  s.hdopE2 = hdop;
+  s.vdopE2 = vdop;
+  s.lat = latE7 / 10000000.0;
+  s.lon = lonE7 / 10000000.0;
+  s.alt = heightMm / 1000.0;
+  s.speed = speedMmS / 1000.0;
+  s.heading = headE5 / 100000.0;
+  s.pdop = pdop / 100.0;
+  s.hdop = hdop / 100.0;
+  s.vdop = vdop / 100.0;
+}
+
+static void randomEpoch(GpsSnapshot& s, uint32_t n) {
+  int32_t lat = rndRange(-900000000, 900000000);
+  int32_t lon = rndRange(-1800000000, 1800000000);
+  // Every 8th epoch sits just below a whole degree, to exercise the minute carry
+  if (n % 8 == 0) lat = (lat / 10000000) * 10000000 + (lat < 0 ? -1 : 1) * rndRange(9999990, 9999999);
+  if (n % 8 == 1) lon = (lon / 10000000) * 10000000 + (lon < 0 ? -1 : 1) * rndRange(9999990, 9999999);
+  setEpoch(s, lat, lon, rndRange(-500000, 9000000), rndRange(0, 500000), rndRange(0, 35999999),
+           rndRange(0, 9999), rndRange(0, 9999), rndRange(0, 9999));
+  s.hasFix = rnd() & 1;
+  s.fixType = rnd() % 5;
+  s.satellites = rnd() % 40;
+  s.hour = rnd() % 24;
+  s.minute = rnd() % 60;
+  s.second = rnd() % 60;
+  s.day = 1 + rnd() % 31;
+  s.month = 1 + rnd() % 12;
+  s.year = 2000 + rnd() % 100;
+}
+
+static std::vector<GpsSnapshot> edgeEpochs() {
+  std::vector<GpsSnapshot> edges;
+  const int32_t coords[] = {0, 1, -1, 5, -5, 9999999, -9999999, 9999991, 10000000, 899999999, 900000000,
+                            -900000000, 1799999999, 1800000000, -1800000000, 474999917, -474999916};
+  const int32_t speeds[] = {0, 1, 231, 232, 463, 4630, 2315, 2777, 1000000};
+  const int32_t heights[] = {0, 5, -5, 4, -4, 15, -15, -1, 1, -123456};
+  for (int32_t c : coords) {
+    for (int32_t v : speeds) {
+      for (int32_t h : heights) {
+        GpsSnapshot s;
+        setEpoch(s, c, c, h, v, v * 10, 0, 99, 100);
+        s.hasFix = true;
+        s.fixType = 3;
+        edges.push_back(s);
+      }
+    }
+  }
+  return edges;
+}
+
+int main(int argc, char** argv) {
+  uint32_t epochs = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 2000000;
+  rngState = argc > 2 ? strtoull(argv[2], NULL, 10) : 1;
+  if (rngState == 0) rngState = 1;
+
+  std::vector<GpsSnapshot> edges = edgeEpochs();
+  uint64_t sentences = 0, exactFailures = 0, legacyFailures = 0, legacyDiffering = 0;
+  uint64_t diffs[DIFF_COUNT] = {0, 0, 0, 0, 0};
+  for (uint32_t n = 0; n < edges.size() + epochs; n++) {
+    GpsSnapshot s;
+    if (n < edges.size()) s = edges[n];
+    else randomEpoch(s, n);
+
+    std::vector<std::string> got = encoderSentences(s);
+    std::vector<std::string> exact = referenceSentences(s, exactFields(s));
+    std::vector<std::string> legacy = referenceSentences(s, legacyFields(s));
+    std::vector<std::string> tiesDown = referenceSentences(s, exactFields(s, true));
+    std::vector<std::string> floatHeading = referenceSentences(s, floatHeadingFields(s));
+    for (size_t i = 0; i < got.size(); i++) {
+      sentences++;
+      if (got[i] != exact[i] && exactFailures++ < 10) {
+        printf("exact mismatch\n  got  %s  want %s", got[i].c_str(), exact[i].c_str());
+      }
+      if (got[i] == legacy[i]) continue;
+      legacyDiffering++;
+      std::string detail;
+      if (legacyMismatches(got[i], legacy[i], tiesDown[i], floatHeading[i], knotsFieldIndex(i), diffs, detail) > 0 &&
+          legacyFailures++ < 10) {
+        printf("legacy mismatch (%s)\n  got    %s  legacy %s", detail.c_str(), got[i].c_str(), legacy[i].c_str());
+      }
+    }
+  }
+
+  printf("%llu epochs, %llu sentences: %llu exact mismatches, %llu legacy mismatches\n",
+         (unsigned long long)(edges.size() + epochs), (unsigned long long)sentences,
+         (unsigned long long)exactFailures, (unsigned long long)legacyFailures);
+  printf("%llu sentences differ from legacy, all in documented ways: %llu rounding ties, "
+         "%llu float heading, %llu knots constant, %llu negative zero, %llu minute carries (fields)\n",
+         (unsigned long long)legacyDiffering, (unsigned long long)diffs[DIFF_TIE], (unsigned long long)diffs[DIFF_FLOAT],
+         (unsigned long long)diffs[DIFF_KNOTS], (unsigned long long)diffs[DIFF_ZERO],
+         (unsigned long long)diffs[DIFF_CARRY]);
+  return exactFailures || legacyFailures ? 1 : 0;
+}
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""Stand-in RTCM3 source for testing the GPS sender's correction input.
+
+Generates RTCM3 frames with valid CRC-24Q (a 1005 station message plus MSM7-sized
+observation frames every second) and either serves them as a minimal NTRIP 1.0
+caster or pushes them to the sender's raw RTCM input port.
+
+    python3 rtcm_caster.py                              # NTRIP caster on :2101, mountpoint TEST
+    python3 rtcm_caster.py --user rover --password pw   # require Basic auth
+    python3 rtcm_caster.py --push 192.168.1.100:2102    # push to RTCM_INPUT_PORT
+    python3 rtcm_caster.py --push 192.168.1.100:2102 --corrupt-every 10 --split
+    python3 rtcm_caster.py --push 192.168.1.100:2102 --corrupt-every 7 --corrupt length
+
+--corrupt-every N damages every Nth frame and --corrupt picks how:
+  crc      flip a bit in the CRC (the sender counts one crcErrors per frame)
+  payload  flip a bit in the payload (likewise)
+  length   change the 10-bit length, so the frame appears to end early or late and
+           swallows the start of the next one; the frames after it must still arrive
+  mixed    any of the above, chosen at random per frame
+--split writes frames in small random pieces to exercise reassembly across TCP segments.
+"""
+
+import argparse
+import base64
+import os
+import random
+import socket
+import socketserver
+import struct
+import threading
+import time
+
+
+def crc24q(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte << 16
+        for _ in range(8):
+            crc <<= 1
+            if crc & 0x1000000:
+                crc ^= 0x1864CFB
+    return crc & 0xFFFFFF
+
+
+def rtcm_frame(payload):
+    header = bytes([0xD3, (len(payload) >> 8) & 0x03, len(payload) & 0xFF])
+    body = header + payload
+    return body + struct.pack(">I", crc24q(body))[1:]
+
+
+def corrupt(frame, mode):
+    if mode == "mixed":
+        mode = random.choice(("crc", "payload", "length"))
+    data = bytearray(frame)
+    if mode == "crc":
+        data[-1 - random.randrange(3)] ^= 1 << random.randrange(8)
+    elif mode == "payload":
+        data[3 + random.randrange(len(data) - 6)] ^= 1 << random.randrange(8)
+    else:
+        length = ((data[1] & 0x03) << 8) | data[2]
+        bad = random.choice([n for n in (length // 2, length - 1, length + 1, length * 2, 1023) if 0 <= n <= 1023 and n != length])
+        data[1] = (data[1] & 0xFC) | (bad >> 8)
+        data[2] = bad & 0xFF
+    return bytes(data)
+
+
+def message(msg_type, length):
+    # 12-bit message number, then filler standing in for the real fields
+    first = bytes([(msg_type >> 4) & 0xFF, (msg_type & 0x0F) << 4])
+    return first + os.urandom(length - 2)
+
+
+class FrameSource:
+    """One second of corrections per call, with optional corruption."""
+
+    def __init__(self, corrupt_every, corrupt_mode):
+        self.corrupt_every = corrupt_every
+        self.corrupt_mode = corrupt_mode
+        self.count = 0
+
+    def epoch(self):
+        frames = [rtcm_frame(message(1005, 19))]
+        for msg_type, length in ((1077, 400), (1087, 300), (1097, 350), (1127, 250)):
+            frames.append(rtcm_frame(message(msg_type, length + random.randint(-40, 40))))
+        out = []
+        for frame in frames:
+            self.count += 1
+            if self.corrupt_every and self.count % self.corrupt_every == 0:
+                frame = corrupt(frame, self.corrupt_mode)
+            out.append(frame)
+        return out
+
+
+def stream(sock, source, rate, split, stop):
+    sent_frames = sent_bytes = 0
+    while not stop.is_set():
+        start = time.monotonic()
+        for frame in source.epoch():
+            if split:
+                pos = 0
+                while pos < len(frame):
+                    step = random.randint(1, 64)
+                    sock.sendall(frame[pos:pos + step])
+                    pos += step
+            else:
+                sock.sendall(frame)
+            sent_frames += 1
+            sent_bytes += len(frame)
+        print("sent %d frames, %d bytes" % (sent_frames, sent_bytes))
+        time.sleep(max(0.0, 1.0 / rate - (time.monotonic() - start)))
+
+
+def push(args):
+    host, _, port = args.push.rpartition(":")
+    sock = socket.create_connection((host, int(port)))
+    print("pushing to %s" % args.push)
+    try:
+        stream(sock, FrameSource(args.corrupt_every, args.corrupt), args.rate, args.split, threading.Event())
+    except (KeyboardInterrupt, BrokenPipeError, ConnectionResetError):
+        pass
+
+
+class NtripHandler(socketserver.StreamRequestHandler):
+    def handle(self):
+        args = self.server.args
+        request = self.rfile.readline().decode("latin-1").strip()
+        headers = {}
+        while True:
+            line = self.rfile.readline().decode("latin-1").strip()
+            if not line:
+                break
+            name, _, value = line.partition(":")
+            headers[name.strip().lower()] = value.strip()
+        print("%s: %s" % (self.client_address[0], request))
+
+        parts = request.split()
+        mount = parts[1].lstrip("/") if len(parts) > 1 else ""
+        if mount != args.mountpoint:
+            table = "STR;%s;Stand-in;RTCM 3.3;1005,1077,1087,1097,1127;2;GNSS;TEST;XXX;0;0;0;0;none;N;N;0;\r\n" % args.mountpoint
+            self.wfile.write(("SOURCETABLE 200 OK\r\nContent-Length: %d\r\n\r\n%sENDSOURCETABLE\r\n"
+                              % (len(table), table)).encode())
+            return
+        if args.user:
+            expected = base64.b64encode(("%s:%s" % (args.user, args.password)).encode()).decode()
+            if headers.get("authorization") != "Basic " + expected:
+                self.wfile.write(b"HTTP/1.0 401 Unauthorized\r\n\r\n")
+                return
+
+        self.wfile.write(b"ICY 200 OK\r\n\r\n")
+        stop = threading.Event()
+        reader = threading.Thread(target=self.read_gga, args=(stop,), daemon=True)
+        reader.start()
+        try:
+            stream(self.connection, FrameSource(args.corrupt_every, args.corrupt), args.rate, args.split, stop)
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+        stop.set()
+        print("%s: disconnected" % self.client_address[0])
+
+    def read_gga(self, stop):
+        # Rovers report their position as GGA sentences
+        while not stop.is_set():
+            line = self.rfile.readline()
+            if not line:
+                stop.set()
+                break
+            print("%s: %s" % (self.client_address[0], line.decode("latin-1").strip()))
+
+
+class Caster(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=2101, help="caster port")
+    parser.add_argument("--mountpoint", default="TEST")
+    parser.add_argument("--user", default="")
+    parser.add_argument("--password", default="")
+    parser.add_argument("--push", metavar="HOST:PORT", help="push frames to a raw RTCM input port instead")
+    parser.add_argument("--rate", type=float, default=1.0, help="epochs per second")
+    parser.add_argument("--corrupt-every", type=int, default=0, metavar="N")
+    parser.add_argument("--corrupt", choices=("crc", "payload", "length", "mixed"), default="crc",
+                        help="how every Nth frame is damaged")
+    parser.add_argument("--split", action="store_true", help="send frames in small random pieces")
+    args = parser.parse_args()
+
+    if args.push:
+        push(args)
+        return
+
+    server = Caster(("", args.port), NtripHandler)
+    server.args = args
+    print("NTRIP caster on port %d, mountpoint /%s" % (args.port, args.mountpoint))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+// Host check for the sender's RtcmFramer.
+//
+// Builds a stream of valid RTCM3 frames (random lengths, 1005/MSM-like message numbers)
+// and corrupts some of them the ways a link does:
+//
+//   crc      a CRC byte flipped
+//   payload  a payload byte flipped
+//   length   the 10-bit length changed, shorter or longer, so the frame's end is misplaced
+//   garbage  junk (with stray 0xD3 bytes) between frames
+//
+// The stream is fed in random pieces. Every intact frame must come out whole, in order,
+// and nothing else may. Two passes: with only crc and payload damage the frame boundaries
+// survive, so crcErrors must equal the corrupted count exactly. With every kind mixed in,
+// recovery must still be exact. The count is only reported: a misplaced end hides the
+// frames it swallows from the count, and stray preambles in junk add to it.
+//
+//   S="../../GPS Sender - SparkFun ESP32-C6 Qwiic"
+//   g++ -std=gnu++17 -O2 -Wall -I../espnow_sim/shim -I"$S" rtcm_check.cpp "$S/RtcmFramer.cpp" -o rtcm_check
+//   ./rtcm_check [frames] [seed]           # default 200000 frames; exit status 1 on any mismatch
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "RtcmFramer.h"
+
+static uint64_t rngState = 1;
+
+static uint32_t rnd() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (uint32_t)rngState;
+}
+
+static uint32_t rndRange(uint32_t lo, uint32_t hi) {
+  return lo + rnd() % (hi - lo + 1);
+}
+
+typedef std::vector<uint8_t> Bytes;
+
+static Bytes makeFrame() {
+  static const uint16_t types[] = {1005, 1077, 1087, 1097, 1127, 1230};
+  size_t payloadLen = rndRange(2, 1023);
+  uint16_t type = types[rnd() % 6];
+  Bytes frame;
+  frame.push_back(RTCM_PREAMBLE);
+  frame.push_back((payloadLen >> 8) & 0x03);
+  frame.push_back(payloadLen & 0xFF);
+  frame.push_back(type >> 4);
+  frame.push_back((type & 0x0F) << 4);
+  for (size_t i = 2; i < payloadLen; i++) frame.push_back(rnd() & 0xFF);
+  uint32_t crc = crc24q(frame.data(), frame.size());
+  frame.push_back(crc >> 16);
+  frame.push_back(crc >> 8);
+  frame.push_back(crc);
+  return frame;
+}
+
+static std::vector<Bytes> received;
+
+static void onFrame(RtcmFramer& f) {
+  const uint8_t* frame = f.msg + RTCM_MSG_PREFIX;
+  received.push_back(Bytes(frame, frame + f.need));
+}
+
+static long runPass(const char* name, long count, bool boundariesIntact) {
+  static RtcmFramer framer;
+  framer = RtcmFramer();
+  framer.onFrame = &onFrame;
+  received.clear();
+
+  Bytes stream;
+  std::vector<Bytes> expected;
+  long corrupted[4] = {0, 0, 0, 0}; // crc, payload, length, garbage
+  for (long n = 0; n < count; n++) {
+    Bytes frame = makeFrame();
+    uint32_t roll = rnd() % 100;
+    if (boundariesIntact && roll >= 8) roll = 50; // No length damage, no junk
+    if (roll < 4) {
+      frame[frame.size() - 1 - rnd() % RTCM_CRC_LEN] ^= 1 << (rnd() % 8);
+      corrupted[0]++;
+    } else if (roll < 8) {
+      frame[RTCM_HEADER_LEN + rnd() % (frame.size() - RTCM_HEADER_LEN - RTCM_CRC_LEN)] ^= 1 << (rnd() % 8);
+      corrupted[1]++;
+    } else if (roll < 12) {
+      uint16_t len = ((frame[1] & 0x03) << 8) | frame[2];
+      uint16_t bad;
+      do bad = rnd() % 1024; while (bad == len);
+      frame[1] = (bad >> 8) & 0x03;
+      frame[2] = bad & 0xFF;
+      corrupted[2]++;
+    } else {
+      expected.push_back(frame);
+    }
+    if (roll >= 96) {
+      // Line noise between frames; it may contain 0xD3 but never completes a frame
+      size_t junk = rndRange(1, 64);
+      for (size_t i = 0; i < junk; i++) stream.push_back(rnd() % 4 == 0 ? RTCM_PREAMBLE : rnd() & 0xFF);
+      corrupted[3]++;
+    }
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+  // Flush: zeros complete any candidate still open at the end without forming a frame
+  stream.insert(stream.end(), RTCM_MAX_FRAME, 0);
+
+  size_t pos = 0;
+  while (pos < stream.size()) {
+    size_t step = rnd() % 3 == 0 ? rndRange(1, 8) : rndRange(1, 1460);
+    if (step > stream.size() - pos) step = stream.size() - pos;
+    rtcmFeed(framer, stream.data() + pos, step);
+    pos += step;
+  }
+
+  long mismatches = 0;
+  size_t matched = 0;
+  size_t e = 0;
+  size_t missing = 0;
+  for (size_t r = 0; r < received.size(); r++) {
+    // Look a little way ahead, so one lost frame does not throw off the rest
+    size_t k = e;
+    while (k < expected.size() && k - e < 64 && received[r] != expected[k]) k++;
+    if (k < expected.size() && received[r] == expected[k]) {
+      missing += k - e;
+      matched++;
+      e = k + 1;
+    } else {
+      // Never sent intact: a false positive or out of order
+      if (mismatches < 10) printf("unexpected frame %zu (%zu bytes)\n", r, received[r].size());
+      mismatches++;
+    }
+  }
+  missing += expected.size() - e;
+  if (missing > 0) {
+    printf("missing %zu intact frames\n", missing);
+    mismatches += missing;
+  }
+  long bad = corrupted[0] + corrupted[1] + corrupted[2];
+  if (boundariesIntact && (long)framer.crcErrors != bad) {
+    printf("crcErrors %u, expected %ld\n", framer.crcErrors, bad);
+    mismatches++;
+  }
+
+  printf("%s: %ld frames (%zu bytes), %zu intact delivered of %zu; corrupted crc %ld payload %ld length %ld, "
+         "junk runs %ld; crcErrors %u\n",
+         name, count, stream.size(), matched, expected.size(), corrupted[0], corrupted[1], corrupted[2],
+         corrupted[3], framer.crcErrors);
+  return mismatches;
+}
+
+int main(int argc, char** argv) {
+  long count = argc > 1 ? atol(argv[1]) : 200000;
+  rngState = argc > 2 ? strtoull(argv[2], NULL, 0) : 0x5EED5EEDULL;
+  if (rngState == 0) rngState = 1;
+
+  long mismatches = runPass("crc/payload", count, true);
+  mismatches += runPass("all kinds", count, false);
+  printf("RESULT %s: %ld mismatches\n", mismatches ? "FAIL" : "PASS", mismatches);
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Listen for the GPS sender's UDP output and report sequence gaps.
+
+Each datagram starts with a sequence number: a "$PESPU,<seq>*CS" sentence for
+NMEA datagrams or a {"class":"SEQ","seq":<seq>} line for gpsd JSON datagrams.
+NMEA checksums are verified as well.
+
+    python3 udp_listener.py                      # subnet broadcast on 10110
+    python3 udp_listener.py --group 239.192.0.1  # multicast
+    python3 udp_listener.py -v                   # also print every datagram
+"""
+
+import argparse
+import json
+import socket
+import struct
+import time
+
+
+def nmea_checksum_ok(sentence):
+    if not sentence.startswith("$") or "*" not in sentence:
+        return False
+    body, _, cs = sentence[1:].partition("*")
+    calc = 0
+    for ch in body:
+        calc ^= ord(ch)
+    return cs[:2].upper() == "%02X" % calc
+
+
+def parse_sequence(first_line):
+    if first_line.startswith("$PESPU,"):
+        return int(first_line[7:].split("*")[0])
+    if first_line.startswith("{"):
+        obj = json.loads(first_line)
+        if obj.get("class") == "SEQ":
+            return int(obj["seq"])
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=10110)
+    parser.add_argument("--group", help="multicast group to join (default: broadcast)")
+    parser.add_argument("--interval", type=float, default=10.0, help="seconds between summaries")
+    parser.add_argument("-v", "--verbose", action="store_true")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", args.port))
+    if args.group:
+        mreq = struct.pack("4s4s", socket.inet_aton(args.group), socket.inet_aton("0.0.0.0"))
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+    sock.settimeout(1.0)
+    print("Listening on UDP port %d%s" % (args.port, " group " + args.group if args.group else ""))
+
+    expected = None
+    received = lost = reordered = bad_checksums = unsequenced = 0
+    last_summary = time.monotonic()
+
+    while True:
+        try:
+            data, addr = sock.recvfrom(4096)
+        except socket.timeout:
+            data = None
+        except KeyboardInterrupt:
+            break
+
+        if data:
+            received += 1
+            lines = data.decode("ascii", errors="replace").splitlines()
+            seq = parse_sequence(lines[0]) if lines else None
+            if seq is None:
+                unsequenced += 1
+            elif expected is None or seq == expected:
+                expected = seq + 1
+            elif seq > expected:
+                lost += seq - expected
+                print("gap: expected %d, got %d (%d lost)" % (expected, seq, seq - expected))
+                expected = seq + 1
+            else:
+                reordered += 1
+                print("late/duplicate: %d (expected %d)" % (seq, expected))
+
+            for line in lines:
+                if line.startswith("$") and not nmea_checksum_ok(line):
+                    bad_checksums += 1
+                    print("bad checksum: %s" % line)
+
+            if args.verbose:
+                print("--- %s seq=%s (%d bytes)" % (addr[0], seq, len(data)))
+                for line in lines:
+                    print(line)
+
+        now = time.monotonic()
+        if now - last_summary >= args.interval:
+            last_summary = now
+            print("received=%d lost=%d late=%d bad_checksum=%d unsequenced=%d" %
+                  (received, lost, reordered, bad_checksums, unsequenced))
+
+    print("received=%d lost=%d late=%d bad_checksum=%d unsequenced=%d" %
+          (received, lost, reordered, bad_checksums, unsequenced))
+
+
+if __name__ == "__main__":
+    main()